@@ -261,6 +261,9 @@ bool
 gem5Component::clockTick(SST::Cycle_t currentCycle)
 {
     // what to do in a SST's cycle
+    // hand the responses received from SST since the last cycle to gem5
+    for (auto port: sstPorts)
+        port->deliverResponses();
     gem5::GlobalSimLoopExitEvent *event = simulateGem5(currentCycle);
     clocksProcessed++;
     // gem5 exits due to reasons other than reaching simulation limit
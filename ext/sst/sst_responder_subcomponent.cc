@@ -36,7 +36,7 @@
 
 SSTResponderSubComponent::SSTResponderSubComponent(SST::ComponentId_t id,
                                                    SST::Params& params)
-    : SubComponent(id)
+    : SubComponent(id), respRetryPending(false)
 {
     sstResponder = new SSTResponder(this);
     gem5SimObjectName = params.find<std::string>("response_receiver_name", "");
@@ -96,18 +96,28 @@ SSTResponderSubComponent::handleTimingReq(
     return true;
 }
 
+void
+SSTResponderSubComponent::handleTimingReqs(
+    const std::vector<SST::Interfaces::StandardMem::Request*>& requests)
+{
+    for (auto request: requests)
+        memoryInterface->send(request);
+}
+
 void
 SSTResponderSubComponent::init(unsigned phase)
 {
     if (phase == 1) {
-        for (auto p: responseReceiver->getInitData()) {
-            gem5::Addr addr = p.first;
-            std::vector<uint8_t> data = p.second;
-            SST::Interfaces::StandardMem::Request* request = \
-                new SST::Interfaces::StandardMem::Write(
-                    addr, data.size(), data);
-            memoryInterface->sendUntimedData(request);
-        }
+        // Contiguous writes are coalesced in the image, so this sends one
+        // request per contiguous block of initialized memory.
+        responseReceiver->getInitImage().forEachRecord(
+            [this](gem5::Addr addr, const uint8_t* data, uint64_t size) {
+                std::vector<uint8_t> bytes(data, data + size);
+                SST::Interfaces::StandardMem::Request* request = \
+                    new SST::Interfaces::StandardMem::Write(
+                        addr, size, bytes);
+                memoryInterface->sendUntimedData(request);
+            });
     }
     memoryInterface->init(phase);
 }
@@ -149,8 +159,7 @@ SSTResponderSubComponent::handleSwapReqResponse(
     );
     pkt->makeAtomicResponse();
     pkt->headerDelay = pkt->payloadDelay = 0;
-    if (blocked() || !responseReceiver->sendTimingResp(pkt))
-        responseQueue.push(pkt);
+    responseQueue.push(pkt);
 
     // step 2
     (*(pkt->getAtomicOp()))(data.data()); // apply the atomic op
@@ -196,9 +205,9 @@ SSTResponderSubComponent::portEventHandler(
 
         Translator::inplaceSSTRequestToGem5PacketPtr(pkt, request);
 
-        if (blocked() || !(responseReceiver->sendTimingResp(pkt))) {
-            responseQueue.push(pkt);
-        }
+        // The response is sent to gem5 with the others received in this
+        // cycle by deliverResponses().
+        responseQueue.push(pkt);
     } else {
         // we can handle unexpected invalidates, but nothing else.
         if (SST::Interfaces::StandardMem::Read* test =
@@ -233,9 +242,22 @@ SSTResponderSubComponent::portEventHandler(
 void
 SSTResponderSubComponent::handleRecvRespRetry()
 {
-    while (blocked() &&
-           responseReceiver->sendTimingResp(responseQueue.front()))
+    respRetryPending = false;
+    deliverResponses();
+}
+
+void
+SSTResponderSubComponent::deliverResponses()
+{
+    if (respRetryPending)
+        return;
+    while (blocked()) {
+        if (!responseReceiver->sendTimingResp(responseQueue.front())) {
+            respRetryPending = true;
+            return;
+        }
         responseQueue.pop();
+    }
 }
 
 void
@@ -61,6 +61,8 @@ class SSTResponderSubComponent: public SST::SubComponent
     SST::TimeConverter* timeConverter;
     SST::Output* output;
     std::queue<gem5::PacketPtr> responseQueue;
+    // gem5 refused a response and has not asked for a retry yet
+    bool respRetryPending;
 
     std::vector<SST::Interfaces::StandardMem::Request*> initRequests;
 
@@ -85,6 +87,11 @@ class SSTResponderSubComponent: public SST::SubComponent
     bool findCorrespondingSimObject(gem5::Root* gem5_root);
 
     bool handleTimingReq(SST::Interfaces::StandardMem::Request* request);
+    void handleTimingReqs(
+        const std::vector<SST::Interfaces::StandardMem::Request*>& requests);
+    // Send the responses received since the last call to gem5, until
+    // gem5 refuses one.
+    void deliverResponses();
     void handleRecvRespRetry();
     void handleRecvFunctional(gem5::PacketPtr pkt);
     void handleSwapReqResponse(SST::Interfaces::StandardMem::Request* request);
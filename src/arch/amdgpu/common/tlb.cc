@@ -512,8 +512,7 @@ namespace X86ISA
                                 tc->pcState().instAddr());
 
                         Process *p = tc->getProcessPtr();
-                        const EmulationPageTable::Entry *pte =
-                            p->pTable->lookup(vaddr);
+                        auto pte = p->pTable->lookup(vaddr);
 
                         if (!pte && mode != BaseMMU::Execute) {
                             // penalize a "page fault" more
@@ -966,7 +965,7 @@ namespace X86ISA
             Addr alignedVaddr = p->pTable->pageAlign(vaddr);
             assert(alignedVaddr == virtPageAddr);
 
-            const EmulationPageTable::Entry *pte = p->pTable->lookup(vaddr);
+            auto pte = p->pTable->lookup(vaddr);
             if (!pte && sender_state->tlbMode != BaseMMU::Execute &&
                     p->fixupFault(vaddr)) {
                 pte = p->pTable->lookup(vaddr);
@@ -1170,8 +1169,7 @@ namespace X86ISA
                 Addr alignedVaddr = p->pTable->pageAlign(vaddr);
                 assert(alignedVaddr == virt_page_addr);
 
-                const EmulationPageTable::Entry *pte =
-                        p->pTable->lookup(vaddr);
+                auto pte = p->pTable->lookup(vaddr);
                 if (!pte && sender_state->tlbMode != BaseMMU::Execute &&
                         p->fixupFault(vaddr)) {
                     pte = p->pTable->lookup(vaddr);
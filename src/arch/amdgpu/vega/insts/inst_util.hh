@@ -296,6 +296,87 @@ namespace VegaISA
         return (VecElemU32)(result >> 64) ? 1 : 0;
     }
 
+    /**
+     * whole-wavefront lane kernels. these evaluate an element-wise op for
+     * every lane in a flat loop with no per-lane exec mask test, so the
+     * host compiler is free to vectorize it. inactive lanes are computed
+     * but never committed: VecOperand::write() only stores lanes that are
+     * active in the exec mask, and vecLaneCmp() masks its result with the
+     * exec mask. the op must therefore be free of side effects and must
+     * not trap for any input (e.g., no integer division, no float to int
+     * conversion), since inactive lanes may hold arbitrary values.
+     */
+    template<typename Dst, typename Src, typename Op>
+    inline void
+    vecLaneOp(Dst &vdst, const Src &src, Op op)
+    {
+        typename Src::ElemType a[NumVecElemPerVecReg];
+        src.readLanes(a);
+
+        auto *d = vdst.lanes();
+        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+            d[lane] = op(a[lane]);
+        }
+    }
+
+    template<typename Dst, typename Src0, typename Src1, typename Op>
+    inline void
+    vecLaneOp(Dst &vdst, const Src0 &src0, const Src1 &src1, Op op)
+    {
+        typename Src0::ElemType a[NumVecElemPerVecReg];
+        typename Src1::ElemType b[NumVecElemPerVecReg];
+        src0.readLanes(a);
+        src1.readLanes(b);
+
+        auto *d = vdst.lanes();
+        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+            d[lane] = op(a[lane], b[lane]);
+        }
+    }
+
+    template<typename Dst, typename Src0, typename Src1, typename Src2,
+             typename Op>
+    inline void
+    vecLaneOp(Dst &vdst, const Src0 &src0, const Src1 &src1,
+              const Src2 &src2, Op op)
+    {
+        typename Src0::ElemType a[NumVecElemPerVecReg];
+        typename Src1::ElemType b[NumVecElemPerVecReg];
+        typename Src2::ElemType c[NumVecElemPerVecReg];
+        src0.readLanes(a);
+        src1.readLanes(b);
+        src2.readLanes(c);
+
+        auto *d = vdst.lanes();
+        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+            d[lane] = op(a[lane], b[lane], c[lane]);
+        }
+    }
+
+    /**
+     * evaluate a compare for every lane and return the result as a lane
+     * mask, with the bits of lanes inactive in exec cleared. this is the
+     * same value a per-lane setBit() loop leaves in a zero-initialized
+     * scalar destination.
+     */
+    template<typename Src0, typename Src1, typename Op>
+    inline ScalarRegU64
+    vecLaneCmp(const VectorMask &exec, const Src0 &src0, const Src1 &src1,
+               Op op)
+    {
+        typename Src0::ElemType a[NumVecElemPerVecReg];
+        typename Src1::ElemType b[NumVecElemPerVecReg];
+        src0.readLanes(a);
+        src1.readLanes(b);
+
+        ScalarRegU64 mask = 0;
+        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+            mask |= ScalarRegU64(op(a[lane], b[lane]) ? 1 : 0) << lane;
+        }
+
+        return mask & exec.to_ullong();
+    }
+
     /**
      * dppInstImpl is a helper function that performs the inputted operation
      * on the inputted vector register lane.  The returned output lane
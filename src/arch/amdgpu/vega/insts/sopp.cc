@@ -84,8 +84,7 @@ namespace VegaISA
         ComputeUnit *cu = gpuDynInst->computeUnit();
 
         // delete extra instructions fetched for completed work-items
-        wf->instructionBuffer.erase(wf->instructionBuffer.begin() + 1,
-            wf->instructionBuffer.end());
+        wf->flushInstBuffer(1);
 
         if (wf->pendingFetch) {
             wf->dropFetch = true;
@@ -111,11 +111,7 @@ namespace VegaISA
                 }
             }
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src[lane];
-                }
-            }
+            vecLaneOp(vdst, src, [](auto a) { return a; });
         }
 
         vdst.write();
@@ -228,7 +224,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F64_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -237,11 +232,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return (VecElemF64)a; });
 
         vdst.write();
     } // execute
@@ -263,7 +254,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -272,11 +262,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return (VecElemF32)a; });
 
         vdst.write();
     } // execute
@@ -298,7 +284,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -307,11 +292,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return (VecElemF32)a; });
 
         vdst.write();
     } // execute
@@ -624,7 +605,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -633,11 +613,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return (VecElemF32)a; });
 
         vdst.write();
     } // execute
@@ -659,7 +635,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F64_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -668,11 +643,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return (VecElemF64)a; });
 
         vdst.write();
     } // execute
@@ -885,7 +856,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F64_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -894,11 +864,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return (VecElemF64)a; });
 
         vdst.write();
     } // execute
@@ -920,7 +886,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_TRUNC_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -929,11 +894,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::trunc(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return std::trunc(a); });
 
         vdst.write();
     } // execute
@@ -956,7 +917,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CEIL_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -965,11 +925,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::ceil(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return std::ceil(a); });
 
         vdst.write();
     } // execute
@@ -1027,7 +983,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_FLOOR_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -1036,11 +991,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::floor(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return std::floor(a); });
 
         vdst.write();
     } // execute
@@ -1098,7 +1049,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_TRUNC_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst (gpuDynInst, instData.VDST);
 
@@ -1107,11 +1057,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::trunc(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return std::trunc(a); });
 
         vdst.write();
     } // execute
@@ -1134,7 +1080,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CEIL_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -1143,11 +1088,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::ceil(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return std::ceil(a); });
 
         vdst.write();
     } // execute
@@ -1205,7 +1146,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_FLOOR_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -1214,11 +1154,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::floor(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return std::floor(a); });
 
         vdst.write();
     } // execute
@@ -1310,7 +1246,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_RCP_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -1319,11 +1254,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = 1.0 / src[lane];
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return 1.0 / a; });
 
         vdst.write();
     } // execute
@@ -1347,7 +1278,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_RCP_IFLAG_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -1356,11 +1286,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = 1.0 / src[lane];
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return 1.0 / a; });
 
         vdst.write();
     } // execute
@@ -1382,7 +1308,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_RSQ_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -1391,11 +1316,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = 1.0 / std::sqrt(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return 1.0 / std::sqrt(a); });
 
         vdst.write();
     } // execute
@@ -1510,7 +1431,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_SQRT_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -1519,11 +1439,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::sqrt(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return std::sqrt(a); });
 
         vdst.write();
     } // execute
@@ -1545,7 +1461,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_SQRT_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -1554,11 +1469,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::sqrt(src[lane]);
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return std::sqrt(a); });
 
         vdst.write();
     } // execute
@@ -1666,7 +1577,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_NOT_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
 
@@ -1675,11 +1585,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = ~src[lane];
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return ~a; });
 
         vdst.write();
     } // execute
@@ -2069,7 +1975,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_MOV_B64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU64 src(gpuDynInst, instData.SRC0);
         VecOperandU64 vdst(gpuDynInst, instData.VDST);
 
@@ -2078,11 +1983,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src[lane];
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return a; });
 
         vdst.write();
     } // execute
@@ -2581,11 +2482,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src[lane];
-            }
-        }
+        vecLaneOp(vdst, src, [](auto a) { return a; });
 
         vdst.write();
     } // execute
@@ -132,11 +132,7 @@ namespace VegaISA
                 }
             }
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] + src1[lane];
-                }
-            }
+            vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return a + b; });
         }
 
         vdst.write();
@@ -160,7 +156,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUB_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -171,11 +166,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return a - b; });
 
         vdst.write();
     } // execute
@@ -198,7 +189,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUBREV_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -209,11 +199,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return b - a; });
 
         vdst.write();
     } // execute
@@ -235,7 +221,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MUL_LEGACY_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -246,11 +231,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return a * b; });
 
         vdst.write();
     } // execute
@@ -499,7 +480,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -510,11 +490,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return std::fmin(a, b); });
 
         vdst.write();
     } // execute
@@ -536,7 +513,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -547,11 +523,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return std::fmax(a, b); });
 
         vdst.write();
     } // execute
@@ -572,7 +545,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, instData.VSRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -583,11 +555,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     } // execute
@@ -608,7 +577,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, instData.VSRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -619,11 +587,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     } // execute
@@ -644,7 +609,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -655,11 +619,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     } // execute
@@ -680,7 +641,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -691,11 +651,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     } // execute
@@ -718,7 +675,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_LSHRREV_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -729,11 +685,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return b >> bits(a, 4, 0); });
 
         vdst.write();
     } // execute
@@ -756,7 +709,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_ASHRREV_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, instData.VSRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -767,11 +719,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return b >> bits(a, 4, 0); });
 
         vdst.write();
     } // execute
@@ -843,11 +792,8 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src1[lane] << bits(src0[lane], 4, 0);
-                }
-            }
+            vecLaneOp(vdst, src0, src1,
+                [](auto a, auto b) { return b << bits(a, 4, 0); });
         }
 
         vdst.write();
@@ -905,11 +851,7 @@ namespace VegaISA
                 }
             }
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] & src1[lane];
-                }
-            }
+            vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return a & b; });
         }
 
         vdst.write();
@@ -982,11 +924,7 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] | src1[lane];
-                }
-            }
+            vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return a | b; });
         }
 
         vdst.write();
@@ -1009,7 +947,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_XOR_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -1020,11 +957,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] ^ src1[lane];
-            }
-        }
+        vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return a ^ b; });
 
         vdst.write();
     } // execute
@@ -1085,11 +1018,8 @@ namespace VegaISA
                 }
             }
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = std::fma(src0[lane], src1[lane], vdst[lane]);
-                }
-            }
+            vecLaneOp(vdst, src0, src1, vdst,
+                [](auto a, auto b, auto c) { return std::fma(a, b, c); });
         }
 
         vdst.write();
@@ -1674,7 +1604,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_ADD_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1685,11 +1614,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return a + b; });
 
         vdst.write();
     } // execute
@@ -1711,7 +1636,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUB_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1722,11 +1646,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return a - b; });
 
         vdst.write();
     } // execute
@@ -1749,7 +1669,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUBREV_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1760,11 +1679,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return b - a; });
 
         vdst.write();
     } // execute
@@ -1786,7 +1701,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MUL_LO_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1797,11 +1711,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return a * b; });
 
         vdst.write();
     } // execute
@@ -1823,7 +1733,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_LSHLREV_B16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1834,11 +1743,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 3, 0);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return b << bits(a, 3, 0); });
 
         vdst.write();
     } // execute
@@ -1979,7 +1885,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1990,11 +1895,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     } // execute
@@ -2015,7 +1917,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, instData.VSRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -2026,11 +1927,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return std::max(a, b); });
 
         vdst.write();
     } // execute
@@ -2051,7 +1949,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -2062,11 +1959,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     } // execute
@@ -2087,7 +1981,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, instData.VSRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -2098,11 +1991,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1,
+            [](auto a, auto b) { return std::min(a, b); });
 
         vdst.write();
     } // execute
@@ -2193,11 +2083,7 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] + src1[lane];
-                }
-            }
+            vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return a + b; });
         }
 
         vdst.write();
@@ -2219,7 +2105,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUB_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -2230,11 +2115,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return a - b; });
 
         vdst.write();
     } // execute
@@ -2255,7 +2136,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUBREV_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -2266,11 +2146,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return b - a; });
 
         vdst.write();
     } // execute
@@ -2291,7 +2167,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_FMAC_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -2303,11 +2178,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], vdst[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1, vdst,
+            [](auto a, auto b, auto c) { return std::fma(a, b, c); });
 
         vdst.write();
     } // execute
@@ -2328,7 +2200,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_FMAC_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF64 src1(gpuDynInst, instData.VSRC1);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
@@ -2340,11 +2211,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], vdst[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1, vdst,
+            [](auto a, auto b, auto c) { return std::fma(a, b, c); });
 
         vdst.write();
     } // execute
@@ -2365,7 +2233,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_XNOR_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -2377,11 +2244,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = ~(src0[lane] ^ src1[lane]);
-            }
-        }
+        vecLaneOp(vdst, src0, src1, [](auto a, auto b) { return ~(a ^ b); });
 
         vdst.write();
     } // execute
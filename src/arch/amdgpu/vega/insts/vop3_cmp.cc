@@ -1346,11 +1346,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         sdst.write();
     } // execute
@@ -1381,11 +1378,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         sdst.write();
     } // execute
@@ -1416,11 +1410,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         sdst.write();
     } // execute
@@ -1451,11 +1442,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         sdst.write();
     } // execute
@@ -1486,11 +1474,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         sdst.write();
     } // execute
@@ -1521,11 +1506,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         sdst.write();
     } // execute
@@ -1555,12 +1537,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)); });
 
         sdst.write();
     } // execute
@@ -1590,12 +1568,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)); });
 
         sdst.write();
     } // execute
@@ -1626,11 +1600,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a >= b); });
 
         sdst.write();
     } // execute
@@ -1661,12 +1632,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b || a > b); });
 
         sdst.write();
     } // execute
@@ -1697,11 +1664,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a > b); });
 
         sdst.write();
     } // execute
@@ -1732,11 +1696,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a <= b); });
 
         sdst.write();
     } // execute
@@ -1767,11 +1728,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         sdst.write();
     } // execute
@@ -1802,11 +1760,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b); });
 
         sdst.write();
     } // execute
@@ -1900,11 +1855,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -1937,11 +1889,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -1974,11 +1923,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2011,11 +1957,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2048,12 +1991,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (a < b || a > b); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2086,11 +2025,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2124,12 +2060,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2163,12 +2095,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (std::isnan(src0[lane])
-                        || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2201,11 +2129,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a >= b); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2238,12 +2163,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b || a > b); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2276,11 +2197,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a > b); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2313,11 +2231,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a <= b); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2350,11 +2265,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2387,11 +2299,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2506,11 +2415,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         sdst.write();
     } // execute
@@ -2563,11 +2469,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         sdst.write();
     } // execute
@@ -2620,11 +2523,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         sdst.write();
     } // execute
@@ -2677,11 +2577,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         sdst.write();
     } // execute
@@ -2734,12 +2631,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (a < b || a > b); });
 
         sdst.write();
     } // execute
@@ -2792,11 +2685,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         sdst.write();
     } // execute
@@ -2848,12 +2738,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)); });
 
         sdst.write();
     } // execute
@@ -2905,12 +2791,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)); });
 
         sdst.write();
     } // execute
@@ -2963,11 +2845,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a >= b); });
 
         sdst.write();
     } // execute
@@ -3020,12 +2899,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b || a > b); });
 
         sdst.write();
     } // execute
@@ -3078,11 +2953,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a > b); });
 
         sdst.write();
     } // execute
@@ -3135,11 +3007,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a <= b); });
 
         sdst.write();
     } // execute
@@ -3192,11 +3061,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         sdst.write();
     } // execute
@@ -3249,11 +3115,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b); });
 
         sdst.write();
     } // execute
@@ -3369,11 +3232,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3428,11 +3288,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3487,11 +3344,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3546,11 +3400,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3605,12 +3456,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (a < b || a > b); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3665,11 +3512,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3725,12 +3569,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3786,12 +3626,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3846,11 +3682,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a >= b); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3905,12 +3738,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b || a > b); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3965,11 +3794,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a > b); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -4024,11 +3850,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a <= b); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -4083,11 +3906,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -4142,11 +3962,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b); });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -4247,11 +4064,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         sdst.write();
     } // execute
@@ -4291,11 +4105,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         sdst.write();
     } // execute
@@ -4335,11 +4146,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         sdst.write();
     } // execute
@@ -4379,11 +4187,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         sdst.write();
     } // execute
@@ -4423,11 +4228,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         sdst.write();
     } // execute
@@ -4467,11 +4269,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         sdst.write();
     } // execute
@@ -4567,11 +4366,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         sdst.write();
     } // execute
@@ -4611,11 +4407,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         sdst.write();
     } // execute
@@ -4655,11 +4448,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         sdst.write();
     } // execute
@@ -4699,11 +4489,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         sdst.write();
     } // execute
@@ -4743,11 +4530,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         sdst.write();
     } // execute
@@ -4787,11 +4571,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         sdst.write();
     } // execute
@@ -4891,11 +4672,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -4937,11 +4715,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -4983,11 +4758,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5029,11 +4801,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5075,11 +4844,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5121,11 +4887,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5229,11 +4992,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5275,11 +5035,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5321,11 +5078,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5367,11 +5121,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5413,11 +5164,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5459,11 +5207,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5563,11 +5308,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         sdst.write();
     } // execute
@@ -5607,11 +5349,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         sdst.write();
     } // execute
@@ -5651,11 +5390,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         sdst.write();
     } // execute
@@ -5695,11 +5431,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         sdst.write();
     } // execute
@@ -5739,11 +5472,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         sdst.write();
     } // execute
@@ -5783,11 +5513,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         sdst.write();
     } // execute
@@ -5883,11 +5610,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         sdst.write();
     } // execute
@@ -5927,11 +5651,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         sdst.write();
     } // execute
@@ -5971,11 +5692,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         sdst.write();
     } // execute
@@ -6015,11 +5733,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         sdst.write();
     } // execute
@@ -6059,11 +5774,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         sdst.write();
     } // execute
@@ -6103,11 +5815,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         sdst.write();
     } // execute
@@ -6207,11 +5916,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6253,11 +5959,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6299,11 +6002,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6345,11 +6045,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6391,11 +6088,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6437,11 +6131,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6545,11 +6236,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6591,11 +6279,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6637,11 +6322,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6683,11 +6365,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6729,11 +6408,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6775,11 +6451,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6879,11 +6552,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         sdst.write();
     } // execute
@@ -6923,11 +6593,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         sdst.write();
     } // execute
@@ -6967,11 +6634,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         sdst.write();
     } // execute
@@ -7011,11 +6675,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         sdst.write();
     } // execute
@@ -7055,11 +6716,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         sdst.write();
     } // execute
@@ -7099,11 +6757,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         sdst.write();
     } // execute
@@ -7199,11 +6854,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         sdst.write();
     } // execute
@@ -7243,11 +6895,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         sdst.write();
     } // execute
@@ -7287,11 +6936,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         sdst.write();
     } // execute
@@ -7331,11 +6977,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         sdst.write();
     } // execute
@@ -7375,11 +7018,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         sdst.write();
     } // execute
@@ -7419,11 +7059,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         sdst.write();
     } // execute
@@ -7523,11 +7160,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7569,11 +7203,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7615,11 +7246,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7661,11 +7289,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7707,11 +7332,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7753,11 +7375,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7861,11 +7480,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7907,11 +7523,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7953,11 +7566,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7999,11 +7609,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -8045,11 +7652,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -8091,11 +7695,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -1292,11 +1292,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         vcc.write();
     } // execute
@@ -1329,11 +1326,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         vcc.write();
     } // execute
@@ -1366,11 +1360,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         vcc.write();
     } // execute
@@ -1403,11 +1394,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         vcc.write();
     } // execute
@@ -1440,12 +1428,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (a < b || a > b); });
 
         vcc.write();
     } // execute
@@ -1478,11 +1462,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         vcc.write();
     } // execute
@@ -1515,12 +1496,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)); });
 
         vcc.write();
     } // execute
@@ -1553,12 +1530,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)); });
 
         vcc.write();
     } // execute
@@ -1591,11 +1564,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a >= b); });
 
         vcc.write();
     } // execute
@@ -1628,12 +1598,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b || a > b); });
 
         vcc.write();
     } // execute
@@ -1666,11 +1632,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a > b); });
 
         vcc.write();
     } // execute
@@ -1703,11 +1666,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a <= b); });
 
         vcc.write();
     } // execute
@@ -1740,11 +1700,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         vcc.write();
     } // execute
@@ -1777,11 +1734,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b); });
 
         vcc.write();
     } // execute
@@ -1875,11 +1829,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -1914,11 +1865,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -1953,11 +1901,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -1992,11 +1937,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2031,12 +1973,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (a < b || a > b); });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2071,11 +2009,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2111,12 +2046,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)); });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2152,12 +2083,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)); });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2192,11 +2119,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a >= b); });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2231,12 +2155,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b || a > b); });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2271,11 +2191,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a > b); });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2310,11 +2227,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a <= b); });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2349,11 +2263,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] == src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a == b); });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2388,11 +2299,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b); });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2486,11 +2394,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         vcc.write();
     } // execute
@@ -2523,11 +2428,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         vcc.write();
     } // execute
@@ -2560,11 +2462,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         vcc.write();
     } // execute
@@ -2597,11 +2496,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         vcc.write();
     } // execute
@@ -2634,12 +2530,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (a < b || a > b); });
 
         vcc.write();
     } // execute
@@ -2672,11 +2564,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         vcc.write();
     } // execute
@@ -2709,12 +2598,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)); });
 
         vcc.write();
     } // execute
@@ -2747,12 +2632,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)); });
 
         vcc.write();
     } // execute
@@ -2785,11 +2666,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a >= b); });
 
         vcc.write();
     } // execute
@@ -2822,12 +2700,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b || a > b); });
 
         vcc.write();
     } // execute
@@ -2860,11 +2734,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a > b); });
 
         vcc.write();
     } // execute
@@ -2897,11 +2768,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a <= b); });
 
         vcc.write();
     } // execute
@@ -2934,11 +2802,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         vcc.write();
     } // execute
@@ -2971,11 +2836,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b); });
 
         vcc.write();
     } // execute
@@ -3069,11 +2931,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -3108,11 +2967,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -3147,11 +3003,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3186,11 +3039,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3225,12 +3075,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (a < b || a > b); });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3265,11 +3111,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3305,12 +3148,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)); });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3346,12 +3185,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)); });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3386,11 +3221,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a >= b); });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3425,12 +3257,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b || a > b); });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3465,11 +3293,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a > b); });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3504,11 +3329,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a <= b); });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3543,11 +3365,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3582,11 +3401,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return !(a < b); });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3678,11 +3494,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         vcc.write();
     } // execute
@@ -3714,11 +3527,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         vcc.write();
     } // execute
@@ -3750,11 +3560,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         vcc.write();
     } // execute
@@ -3786,11 +3593,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         vcc.write();
     } // execute
@@ -3822,11 +3626,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         vcc.write();
     } // execute
@@ -3858,11 +3659,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         vcc.write();
     } // execute
@@ -3950,11 +3748,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         vcc.write();
     } // execute
@@ -4027,11 +3822,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         vcc.write();
     } // execute
@@ -4063,11 +3855,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         vcc.write();
     } // execute
@@ -4142,11 +3931,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         vcc.write();
     } // execute
@@ -4237,11 +4023,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4275,11 +4058,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4313,11 +4093,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4351,11 +4128,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4389,11 +4163,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4427,11 +4198,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4525,11 +4293,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4563,11 +4328,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4601,11 +4363,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4639,11 +4398,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4677,11 +4433,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4715,11 +4468,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4810,11 +4560,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         vcc.write();
     } // execute
@@ -4846,11 +4593,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         vcc.write();
     } // execute
@@ -4882,11 +4626,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         vcc.write();
     } // execute
@@ -4918,11 +4659,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         vcc.write();
     } // execute
@@ -4954,11 +4692,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         vcc.write();
     } // execute
@@ -4990,11 +4725,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         vcc.write();
     } // execute
@@ -5082,11 +4814,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         vcc.write();
     } // execute
@@ -5118,11 +4847,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         vcc.write();
     } // execute
@@ -5154,11 +4880,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         vcc.write();
     } // execute
@@ -5190,11 +4913,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         vcc.write();
     } // execute
@@ -5267,11 +4987,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         vcc.write();
     } // execute
@@ -5362,11 +5079,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5400,11 +5114,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5438,11 +5149,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5476,11 +5184,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5514,11 +5219,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5552,11 +5254,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5650,11 +5349,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5688,11 +5384,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5726,11 +5419,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5764,11 +5454,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5802,11 +5489,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5840,11 +5524,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5935,11 +5616,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         vcc.write();
     } // execute
@@ -5971,11 +5649,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         vcc.write();
     } // execute
@@ -6007,11 +5682,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         vcc.write();
     } // execute
@@ -6043,11 +5715,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         vcc.write();
     } // execute
@@ -6079,11 +5748,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         vcc.write();
     } // execute
@@ -6115,11 +5781,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         vcc.write();
     } // execute
@@ -6207,11 +5870,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         vcc.write();
     } // execute
@@ -6243,11 +5903,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         vcc.write();
     } // execute
@@ -6279,11 +5936,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         vcc.write();
     } // execute
@@ -6315,11 +5969,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         vcc.write();
     } // execute
@@ -6351,11 +6002,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         vcc.write();
     } // execute
@@ -6387,11 +6035,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         vcc.write();
     } // execute
@@ -6482,11 +6127,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6520,11 +6162,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6558,11 +6197,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6596,11 +6232,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6634,11 +6267,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6672,11 +6302,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6770,11 +6397,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a < b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6808,11 +6432,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a == b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6846,11 +6467,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a <= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6884,11 +6502,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a > b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6922,11 +6537,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a != b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6960,11 +6572,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecLaneCmp(wf->execMask(), src0, src1,
+            [](auto a, auto b) { return a >= b; });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -32,6 +32,7 @@
 #ifndef __ARCH_VEGA_OPERAND_HH__
 #define __ARCH_VEGA_OPERAND_HH__
 
+#include <algorithm>
 #include <array>
 
 #include "arch/amdgpu/vega/gpu_registers.hh"
@@ -106,6 +107,8 @@ namespace VegaISA
             "Incorrect number of DWORDS for VEGA operand.");
 
       public:
+        typedef DataType ElemType;
+
         VecOperand() = delete;
 
         VecOperand(GPUDynInstPtr gpuDynInst, int opIdx)
@@ -326,6 +329,55 @@ namespace VegaISA
             return vecReg.template as<DataType>()[idx];
         }
 
+        /**
+         * copy the value of every lane into lanes, applying the scalar
+         * broadcast and abs/neg modifiers once for the whole wavefront
+         * rather than per element. this is the bulk counterpart of the
+         * getter [] operator and is used by the whole-wavefront lane
+         * kernels in inst_util.hh.
+         */
+        template<bool Condition = NumDwords == 1 || NumDwords == 2>
+        typename std::enable_if<Condition, void>::type
+        readLanes(DataType *lanes) const
+        {
+            if (scalar) {
+                std::fill(lanes, lanes + NumVecElemPerVecReg,
+                          scRegData.rawData());
+            } else {
+                std::memcpy((void*)lanes,
+                    (const void*)vecReg.template as<DataType>(),
+                    NumVecElemPerVecReg * sizeof(DataType));
+            }
+
+            if (absMod) {
+                assert(std::is_floating_point_v<DataType>);
+                for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+                    lanes[lane] = std::fabs(lanes[lane]);
+                }
+            }
+
+            if (negMod) {
+                assert(std::is_floating_point_v<DataType>);
+                for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+                    lanes[lane] = -lanes[lane];
+                }
+            }
+        }
+
+        /**
+         * direct access to the lane storage of a destination operand.
+         * as with the setter [] operator, only lanes active in the exec
+         * mask are committed to the register file by write().
+         */
+        template<bool Condition = (NumDwords == 1 || NumDwords == 2) && !Const>
+        typename std::enable_if<Condition, DataType*>::type
+        lanes()
+        {
+            assert(!scalar);
+
+            return vecReg.template as<DataType>();
+        }
+
         private:
           /**
            * if we determine that this operand is a scalar (reg or constant)
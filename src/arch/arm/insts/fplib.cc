@@ -39,7 +39,10 @@
 #include <stdint.h>
 
 #include <cassert>
+#include <cfloat>
 #include <cmath>
+#include <cstring>
+#include <limits>
 
 #include "base/logging.hh"
 #include "fplib.hh"
@@ -2419,6 +2422,192 @@ modeConv(FPSCR fpscr)
     // AHP bit is ignored. Only fplibConvert uses AHP.
 }
 
+// Host floating point fast path.
+//
+// When rounding to nearest, with operands and a result which are zero or
+// normal, IEEE 754 hardware produces the same result as the code above,
+// whatever FZ and DN say, and the only exception it can raise is
+// inexact. Whether the result is inexact is found with error-free
+// transformations, which compute the rounding error exactly. Anything
+// else, including results close enough to the denormals for the error
+// terms to underflow, takes the slow path.
+
+static bool hostFp = true;
+
+void
+fplibSetHostFp(bool enable)
+{
+    hostFp = enable;
+}
+
+static constexpr bool hostFpIeee = FLT_EVAL_METHOD == 0 &&
+    std::numeric_limits<float>::is_iec559 &&
+    std::numeric_limits<double>::is_iec559;
+
+template <class T>
+struct HostFp;
+
+template <>
+struct HostFp<uint32_t>
+{
+    using Type = float;
+    static constexpr int mantBits = FP32_MANT_BITS;
+    static constexpr uint32_t expInf = FP32_EXP_INF;
+};
+
+template <>
+struct HostFp<uint64_t>
+{
+    using Type = double;
+    static constexpr int mantBits = FP64_MANT_BITS;
+    static constexpr uint64_t expInf = FP64_EXP_INF;
+};
+
+static inline bool
+host_fp_usable(FPSCR fpscr)
+{
+    return hostFpIeee && hostFp && (modeConv(fpscr) & 3) == FPLIB_RN;
+}
+
+// Zero or normal, i.e. neither denormal, infinite nor NaN:
+template <class T>
+static inline bool
+host_fp_operand(T op)
+{
+    T exp = op >> HostFp<T>::mantBits & HostFp<T>::expInf;
+    return (exp && exp != HostFp<T>::expInf) || !(T)(op << 1);
+}
+
+template <class T>
+static inline typename HostFp<T>::Type
+host_fp_value(T op)
+{
+    typename HostFp<T>::Type x;
+    std::memcpy(&x, &op, sizeof(x));
+    return x;
+}
+
+template <class T>
+static inline T
+host_fp_bits(typename HostFp<T>::Type x)
+{
+    T op;
+    std::memcpy(&op, &x, sizeof(op));
+    return op;
+}
+
+// Finite, and far enough from the denormals for the rounding error of a
+// product, quotient or square root of this magnitude to be representable:
+template <class F>
+static inline bool
+host_fp_safe(F x)
+{
+    constexpr F inv_eps = 1 / std::numeric_limits<F>::epsilon();
+    constexpr F min = std::numeric_limits<F>::min() * inv_eps * inv_eps;
+    const F mag = std::fabs(x);
+    return mag >= min && mag <= std::numeric_limits<F>::max();
+}
+
+template <class T>
+static inline bool
+host_fp_add(T op1, T op2, bool neg, FPSCR &fpscr, T &result)
+{
+    using F = typename HostFp<T>::Type;
+    if (!host_fp_usable(fpscr) || !host_fp_operand(op1) ||
+            !host_fp_operand(op2)) {
+        return false;
+    }
+
+    const F a = host_fp_value(op1);
+    const F b = neg ? -host_fp_value(op2) : host_fp_value(op2);
+    const F x = a + b;
+
+    // A zero sum is exact, otherwise check for underflow and overflow.
+    const F mag = std::fabs(x);
+    if (x != 0 && !(mag > std::numeric_limits<F>::min() &&
+                mag <= std::numeric_limits<F>::max())) {
+        return false;
+    }
+
+    // TwoSum
+    const F b_virt = x - a;
+    const F err = (a - (x - b_virt)) + (b - b_virt);
+    if (err != 0)
+        fpscr.ixc = 1;
+    result = host_fp_bits<T>(x);
+    return true;
+}
+
+template <class T>
+static inline bool
+host_fp_mul(T op1, T op2, FPSCR &fpscr, T &result)
+{
+    using F = typename HostFp<T>::Type;
+    if (!host_fp_usable(fpscr) || !host_fp_operand(op1) ||
+            !host_fp_operand(op2)) {
+        return false;
+    }
+
+    const F a = host_fp_value(op1);
+    const F b = host_fp_value(op2);
+    const F x = a * b;
+    if (a != 0 && b != 0) {
+        if (!host_fp_safe(x))
+            return false;
+        if (std::fma(a, b, -x) != 0)
+            fpscr.ixc = 1;
+    }
+    result = host_fp_bits<T>(x);
+    return true;
+}
+
+template <class T>
+static inline bool
+host_fp_div(T op1, T op2, FPSCR &fpscr, T &result)
+{
+    using F = typename HostFp<T>::Type;
+    if (!host_fp_usable(fpscr) || !host_fp_operand(op1) ||
+            !host_fp_operand(op2)) {
+        return false;
+    }
+
+    const F a = host_fp_value(op1);
+    const F b = host_fp_value(op2);
+    if (b == 0)
+        return false;
+    const F x = a / b;
+    if (a != 0) {
+        if (!host_fp_safe(x) || !host_fp_safe(a))
+            return false;
+        if (std::fma(-x, b, a) != 0)
+            fpscr.ixc = 1;
+    }
+    result = host_fp_bits<T>(x);
+    return true;
+}
+
+template <class T>
+static inline bool
+host_fp_sqrt(T op, FPSCR &fpscr, T &result)
+{
+    using F = typename HostFp<T>::Type;
+    if (!host_fp_usable(fpscr) || !host_fp_operand(op))
+        return false;
+
+    const F a = host_fp_value(op);
+    if (a < 0)
+        return false;
+    const F x = std::sqrt(a);
+    if (a != 0) {
+        if (!host_fp_safe(a))
+            return false;
+        if (std::fma(x, x, -a) != 0)
+            fpscr.ixc = 1;
+    }
+    result = host_fp_bits<T>(x);
+    return true;
+}
+
 static void
 set_fpscr(FPSCR &fpscr, int flags)
 {
@@ -2600,8 +2789,12 @@ template <>
 uint32_t
 fplibAdd(uint32_t op1, uint32_t op2, FPSCR &fpscr)
 {
+    uint32_t result;
+    if (host_fp_add(op1, op2, false, fpscr, result))
+        return result;
+
     int flags = 0;
-    uint32_t result = fp32_add(op1, op2, 0, modeConv(fpscr), &flags);
+    result = fp32_add(op1, op2, 0, modeConv(fpscr), &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -2610,8 +2803,12 @@ template <>
 uint64_t
 fplibAdd(uint64_t op1, uint64_t op2, FPSCR &fpscr)
 {
+    uint64_t result;
+    if (host_fp_add(op1, op2, false, fpscr, result))
+        return result;
+
     int flags = 0;
-    uint64_t result = fp64_add(op1, op2, 0, modeConv(fpscr), &flags);
+    result = fp64_add(op1, op2, 0, modeConv(fpscr), &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -3126,8 +3323,12 @@ template <>
 uint32_t
 fplibDiv(uint32_t op1, uint32_t op2, FPSCR &fpscr)
 {
+    uint32_t result;
+    if (host_fp_div(op1, op2, fpscr, result))
+        return result;
+
     int flags = 0;
-    uint32_t result = fp32_div(op1, op2, modeConv(fpscr), &flags);
+    result = fp32_div(op1, op2, modeConv(fpscr), &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -3136,8 +3337,12 @@ template <>
 uint64_t
 fplibDiv(uint64_t op1, uint64_t op2, FPSCR &fpscr)
 {
+    uint64_t result;
+    if (host_fp_div(op1, op2, fpscr, result))
+        return result;
+
     int flags = 0;
-    uint64_t result = fp64_div(op1, op2, modeConv(fpscr), &flags);
+    result = fp64_div(op1, op2, modeConv(fpscr), &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -3586,8 +3791,12 @@ template <>
 uint32_t
 fplibMul(uint32_t op1, uint32_t op2, FPSCR &fpscr)
 {
+    uint32_t result;
+    if (host_fp_mul(op1, op2, fpscr, result))
+        return result;
+
     int flags = 0;
-    uint32_t result = fp32_mul(op1, op2, modeConv(fpscr), &flags);
+    result = fp32_mul(op1, op2, modeConv(fpscr), &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -3596,8 +3805,12 @@ template <>
 uint64_t
 fplibMul(uint64_t op1, uint64_t op2, FPSCR &fpscr)
 {
+    uint64_t result;
+    if (host_fp_mul(op1, op2, fpscr, result))
+        return result;
+
     int flags = 0;
-    uint64_t result = fp64_mul(op1, op2, modeConv(fpscr), &flags);
+    result = fp64_mul(op1, op2, modeConv(fpscr), &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -4694,8 +4907,12 @@ template <>
 uint32_t
 fplibSqrt(uint32_t op, FPSCR &fpscr)
 {
+    uint32_t result;
+    if (host_fp_sqrt(op, fpscr, result))
+        return result;
+
     int flags = 0;
-    uint32_t result = fp32_sqrt(op, modeConv(fpscr), &flags);
+    result = fp32_sqrt(op, modeConv(fpscr), &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -4704,8 +4921,12 @@ template <>
 uint64_t
 fplibSqrt(uint64_t op, FPSCR &fpscr)
 {
+    uint64_t result;
+    if (host_fp_sqrt(op, fpscr, result))
+        return result;
+
     int flags = 0;
-    uint64_t result = fp64_sqrt(op, modeConv(fpscr), &flags);
+    result = fp64_sqrt(op, modeConv(fpscr), &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -4724,8 +4945,12 @@ template <>
 uint32_t
 fplibSub(uint32_t op1, uint32_t op2, FPSCR &fpscr)
 {
+    uint32_t result;
+    if (host_fp_add(op1, op2, true, fpscr, result))
+        return result;
+
     int flags = 0;
-    uint32_t result = fp32_add(op1, op2, 1, modeConv(fpscr), &flags);
+    result = fp32_add(op1, op2, 1, modeConv(fpscr), &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -4734,8 +4959,12 @@ template <>
 uint64_t
 fplibSub(uint64_t op1, uint64_t op2, FPSCR &fpscr)
 {
+    uint64_t result;
+    if (host_fp_add(op1, op2, true, fpscr, result))
+        return result;
+
     int flags = 0;
-    uint64_t result = fp64_add(op1, op2, 1, modeConv(fpscr), &flags);
+    result = fp64_add(op1, op2, 1, modeConv(fpscr), &flags);
     set_fpscr0(fpscr, flags);
     return result;
 }
@@ -73,6 +73,14 @@ FPCRRounding(FPSCR &fpscr)
     return (FPRounding)((uint32_t)fpscr >> 22 & 3);
 }
 
+/**
+ * Enable or disable the use of host floating point for single and double
+ * precision add, subtract, multiply, divide and square root, where it
+ * gives the same results and flags as the software implementation.
+ * It is enabled by default.
+ */
+void fplibSetHostFp(bool enable);
+
 /** Floating-point absolute value. */
 template <class T>
 T fplibAbs(T op);
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "arch/arm/insts/fplib.hh"
+
+using namespace gem5;
+using namespace ArmISA;
+
+namespace
+{
+
+/**
+ * Operands biased towards the cases the host fast path must get right
+ * or reject: exact results, halfway cases, the edges of the normal
+ * range, zeros, denormals, infinities and NaNs.
+ */
+template <class T>
+class OperandGen
+{
+  public:
+    static constexpr int bits = sizeof(T) * 8;
+    static constexpr int mantBits = bits == 32 ? 23 : 52;
+    static constexpr T expMax = bits == 32 ? 0xff : 0x7ff;
+
+    explicit OperandGen(uint64_t seed) : gen(seed) {}
+
+    T
+    operator()()
+    {
+        const T sign = (T)(gen() & 1) << (bits - 1);
+        const T mant = (T)gen() & (((T)1 << mantBits) - 1);
+        T exp;
+        switch (gen() % 8) {
+          case 0:
+            // Anything at all
+            return (T)gen();
+          case 1:
+            // Zero, denormal, infinity or NaN
+            exp = gen() % 2 ? 0 : expMax;
+            return sign | exp << mantBits |
+                (gen() % 3 ? mant : (T)(gen() % 2));
+          case 2:
+            // Close to the smallest normal number
+            exp = 1 + gen() % (2 * mantBits + 4);
+            break;
+          case 3:
+            // Close to overflowing
+            exp = expMax - 1 - gen() % 4;
+            break;
+          case 4:
+            // Few significant bits, so results tend to be exact
+            return sign | (T)(expMax / 2 + gen() % 16) << mantBits |
+                (mant & ((T)0xf << (mantBits - 4)));
+          default:
+            // Around one
+            exp = expMax / 2 - 8 + gen() % 16;
+            break;
+        }
+        return sign | exp << mantBits | mant;
+    }
+
+  private:
+    std::mt19937_64 gen;
+};
+
+/** Each combination of the FPSCR mode bits used by fplib */
+std::vector<FPSCR>
+modes()
+{
+    std::vector<FPSCR> res;
+    for (int rmode = 0; rmode < 4; rmode++) {
+        for (int fz = 0; fz < 2; fz++) {
+            for (int dn = 0; dn < 2; dn++) {
+                FPSCR fpscr = 0;
+                fpscr.rMode = rmode;
+                fpscr.fz = fz;
+                fpscr.dn = dn;
+                res.push_back(fpscr);
+            }
+        }
+    }
+    return res;
+}
+
+/** Run an operation with and without the fast path and compare */
+template <class T, class Op>
+void
+fuzz(uint64_t seed, int iterations, Op op)
+{
+    OperandGen<T> gen(seed);
+    const auto all_modes = modes();
+    for (int i = 0; i < iterations; i++) {
+        const T a = gen(), b = gen();
+        for (FPSCR mode : all_modes) {
+            FPSCR slow_fpscr = mode, fast_fpscr = mode;
+
+            fplibSetHostFp(false);
+            const T slow = op(a, b, slow_fpscr);
+            fplibSetHostFp(true);
+            const T fast = op(a, b, fast_fpscr);
+
+            ASSERT_EQ(slow, fast) << std::hex << "a: " << a << " b: " << b
+                << " fpscr: " << (uint32_t)mode;
+            ASSERT_EQ((uint32_t)slow_fpscr, (uint32_t)fast_fpscr)
+                << std::hex << "a: " << a << " b: " << b
+                << " fpscr: " << (uint32_t)mode;
+        }
+    }
+}
+
+constexpr int iterations = 200000;
+
+} // anonymous namespace
+
+#define FPLIB_FUZZ_TEST(name, expr)                                        \
+    TEST(FplibHostFp, name##32)                                            \
+    {                                                                      \
+        fuzz<uint32_t>(1, iterations,                                      \
+            [](uint32_t a, uint32_t b, FPSCR &fpscr) { return expr; });    \
+    }                                                                      \
+    TEST(FplibHostFp, name##64)                                            \
+    {                                                                      \
+        fuzz<uint64_t>(2, iterations,                                      \
+            [](uint64_t a, uint64_t b, FPSCR &fpscr) { return expr; });    \
+    }
+
+FPLIB_FUZZ_TEST(Add, fplibAdd(a, b, fpscr))
+FPLIB_FUZZ_TEST(Sub, fplibSub(a, b, fpscr))
+FPLIB_FUZZ_TEST(Mul, fplibMul(a, b, fpscr))
+FPLIB_FUZZ_TEST(Div, fplibDiv(a, b, fpscr))
+FPLIB_FUZZ_TEST(Sqrt, fplibSqrt(a, fpscr))
+
+TEST(FplibHostFp, ExactAndInexact)
+{
+    // 1 + 2 is exact, 1 / 3 isn't
+    FPSCR fpscr = 0;
+    EXPECT_EQ(0x40400000, fplibAdd<uint32_t>(0x3f800000, 0x40000000, fpscr));
+    EXPECT_FALSE(fpscr.ixc);
+    EXPECT_EQ(0x3eaaaaab, fplibDiv<uint32_t>(0x3f800000, 0x40400000, fpscr));
+    EXPECT_TRUE(fpscr.ixc);
+}
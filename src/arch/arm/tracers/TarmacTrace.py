@@ -71,6 +71,10 @@ class TarmacDump(ScopedEnum):
     vals = ["stdoutput", "stderror", "file"]
 
 
+class TarmacFormat(ScopedEnum):
+    vals = ["text", "binary"]
+
+
 class TarmacTracer(InstTracer):
     type = "TarmacTracer"
     cxx_class = "gem5::trace::TarmacTracer"
@@ -93,3 +97,10 @@ class TarmacTracer(InstTracer):
         "this means every CPU will dump its trace to a different file,"
         "name after the tracer name (e.g. cpu0.tracer, cpu1.tracer)",
     )
+    format = Param.TarmacFormat(
+        "text",
+        "Format of the trace. The binary format is much more compact and "
+        "faster to generate and to compare than the text one; it doesn't "
+        "include the disassembly of the instructions. It requires "
+        "outfile to be file.",
+    )
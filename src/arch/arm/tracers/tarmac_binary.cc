@@ -0,0 +1,544 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "arch/arm/tracers/tarmac_binary.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace gem5
+{
+
+namespace trace {
+
+using namespace tarmac_binary;
+
+TarmacBinaryWriter::TarmacBinaryWriter(std::ostream &_os)
+  : os(_os)
+{
+    FileHeader header = {};
+    std::memcpy(header.magic, Magic, sizeof(header.magic));
+    header.version = Version;
+    header.byteOrder = ByteOrderMark;
+    os.write(reinterpret_cast<const char *>(&header), sizeof(header));
+}
+
+void
+TarmacBinaryWriter::beginRecord(uint64_t tick, uint16_t cpu)
+{
+    haveInst = false;
+    inst = {};
+    inst.tick = tick;
+    inst.cpu = cpu;
+    mems.clear();
+    regs.clear();
+    numRegs = 0;
+}
+
+void
+TarmacBinaryWriter::setInst(const InstHeader &_inst)
+{
+    const auto tick = inst.tick;
+    const auto cpu = inst.cpu;
+    inst = _inst;
+    inst.tick = tick;
+    inst.cpu = cpu;
+    haveInst = true;
+}
+
+void
+TarmacBinaryWriter::addMem(const MemEntry &mem)
+{
+    mems.push_back(mem);
+}
+
+void
+TarmacBinaryWriter::addReg(uint8_t reg_class, uint16_t index,
+                           uint16_t width, const uint64_t *values,
+                           unsigned num_values)
+{
+    RegEntry entry = {};
+    entry.regClass = reg_class;
+    entry.numValues = num_values;
+    entry.index = index;
+    entry.width = width;
+
+    uint64_t raw;
+    std::memcpy(&raw, &entry, sizeof(raw));
+    regs.push_back(raw);
+    regs.insert(regs.end(), values, values + num_values);
+    numRegs++;
+}
+
+bool
+TarmacBinaryWriter::endRecord()
+{
+    if (!haveInst)
+        return false;
+
+    inst.numMems = mems.size();
+    inst.numRegs = numRegs;
+    inst.size = sizeof(inst) + mems.size() * sizeof(MemEntry) +
+        regs.size() * sizeof(uint64_t);
+
+    os.write(reinterpret_cast<const char *>(&inst), sizeof(inst));
+    os.write(reinterpret_cast<const char *>(mems.data()),
+             mems.size() * sizeof(MemEntry));
+    os.write(reinterpret_cast<const char *>(regs.data()),
+             regs.size() * sizeof(uint64_t));
+
+    haveInst = false;
+    return true;
+}
+
+bool
+TarmacBinaryReader::Cursor::next(TarmacBinaryRecord &rec)
+{
+    if (pos == end || corrupt)
+        return false;
+
+    const size_t left = end - pos;
+    const auto *inst = reinterpret_cast<const InstHeader *>(pos);
+    if (left < sizeof(InstHeader) || inst->size < sizeof(InstHeader) ||
+            inst->size % 8 || inst->size > left) {
+        corrupt = true;
+        return false;
+    }
+
+    // Check the entries fill the record exactly before handing out
+    // pointers to them.
+    const char *rec_end = pos + inst->size;
+    const char *entry = pos + sizeof(InstHeader);
+    if (size_t(rec_end - entry) < inst->numMems * sizeof(MemEntry)) {
+        corrupt = true;
+        return false;
+    }
+    rec.inst = inst;
+    rec.mems = reinterpret_cast<const MemEntry *>(entry);
+    entry += inst->numMems * sizeof(MemEntry);
+    rec.regs = reinterpret_cast<const RegEntry *>(entry);
+    for (unsigned i = 0; i < inst->numRegs; i++) {
+        const auto *reg = reinterpret_cast<const RegEntry *>(entry);
+        if (size_t(rec_end - entry) < sizeof(RegEntry) ||
+                size_t(rec_end - entry) - sizeof(RegEntry) <
+                reg->numValues * sizeof(uint64_t)) {
+            corrupt = true;
+            return false;
+        }
+        entry = reinterpret_cast<const char *>(reg->next());
+    }
+    if (entry != rec_end) {
+        corrupt = true;
+        return false;
+    }
+
+    pos = rec_end;
+    recNum++;
+    return true;
+}
+
+TarmacBinaryReader::~TarmacBinaryReader()
+{
+    if (data)
+        munmap(const_cast<char *>(data), size);
+}
+
+bool
+TarmacBinaryReader::open(const std::string &path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        errorMsg = path + ": " + std::strerror(errno);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        errorMsg = path + ": " + std::strerror(errno);
+        ::close(fd);
+        return false;
+    }
+    if (size_t(st.st_size) < sizeof(FileHeader)) {
+        errorMsg = path + ": not a binary Tarmac trace";
+        ::close(fd);
+        return false;
+    }
+
+    void *map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        errorMsg = path + ": " + std::strerror(errno);
+        return false;
+    }
+    // Traces are mostly read front to back, let the kernel read ahead.
+    madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+    data = static_cast<const char *>(map);
+    size = st.st_size;
+
+    const auto *header = reinterpret_cast<const FileHeader *>(data);
+    if (std::memcmp(header->magic, Magic, sizeof(Magic)) != 0) {
+        errorMsg = path + ": not a binary Tarmac trace";
+        return false;
+    }
+    if (header->byteOrder != ByteOrderMark) {
+        errorMsg = path + ": trace written with a different byte order";
+        return false;
+    }
+    if (header->version != Version) {
+        std::ostringstream msg;
+        msg << path << ": unsupported trace version " << header->version;
+        errorMsg = msg.str();
+        return false;
+    }
+
+    return true;
+}
+
+TarmacBinaryReader::Cursor
+TarmacBinaryReader::begin() const
+{
+    return Cursor(data + sizeof(FileHeader), data + size, 0);
+}
+
+bool
+TarmacBinaryReader::buildIndex(uint64_t _stride)
+{
+    if (_stride == 0)
+        _stride = 1;
+    if (stride == _stride)
+        return true;
+
+    index.clear();
+    stride = 0;
+    recordCount = 0;
+
+    // Only the size of the records is looked at, a Cursor checks the
+    // rest of a record when it is read.
+    size_t offset = sizeof(FileHeader);
+    uint64_t count = 0;
+    while (offset != size) {
+        const auto *inst = reinterpret_cast<const InstHeader *>(
+            data + offset);
+        if (size - offset < sizeof(InstHeader) ||
+                inst->size < sizeof(InstHeader) || inst->size % 8 ||
+                inst->size > size - offset) {
+            std::ostringstream msg;
+            msg << "malformed record " << count << " at offset " << offset;
+            errorMsg = msg.str();
+            index.clear();
+            return false;
+        }
+        if (count % _stride == 0)
+            index.push_back(offset);
+        offset += inst->size;
+        count++;
+    }
+
+    stride = _stride;
+    recordCount = count;
+    return true;
+}
+
+TarmacBinaryReader::Cursor
+TarmacBinaryReader::at(uint64_t record) const
+{
+    if (record >= recordCount)
+        return Cursor(data + size, data + size, recordCount);
+    return Cursor(data + index[record / stride], data + size,
+                  record - record % stride);
+}
+
+namespace
+{
+
+std::string
+fieldMismatch(const char *name, uint64_t a, uint64_t b)
+{
+    std::ostringstream msg;
+    msg << name << ": " << std::hex << "0x" << a << " != 0x" << b;
+    return msg.str();
+}
+
+std::string
+regName(const RegEntry &reg)
+{
+    std::ostringstream msg;
+    msg << "register " << unsigned(reg.regClass) << ":" << reg.index;
+    return msg.str();
+}
+
+const RegEntry *
+findReg(const TarmacBinaryRecord &rec, const RegEntry &reg)
+{
+    const RegEntry *it = rec.regs;
+    for (unsigned i = 0; i < rec.inst->numRegs; i++, it = it->next()) {
+        if (it->regClass == reg.regClass && it->index == reg.index)
+            return it;
+    }
+    return nullptr;
+}
+
+void
+compareRegs(const RegEntry &ra, const RegEntry &rb,
+            std::vector<std::string> &out)
+{
+    if (ra.width != rb.width || ra.numValues != rb.numValues) {
+        out.push_back(regName(ra) + " " +
+                      fieldMismatch("width", ra.width, rb.width));
+        return;
+    }
+
+    for (unsigned i = 0; i < ra.numValues; i++) {
+        uint64_t va = ra.values()[i];
+        uint64_t vb = rb.values()[i];
+        // Scalar registers may be narrower than the value holding them.
+        if (ra.numValues == 1 && ra.width < 64) {
+            const uint64_t mask = (uint64_t(1) << ra.width) - 1;
+            va &= mask;
+            vb &= mask;
+        }
+        if (va != vb) {
+            std::ostringstream name;
+            name << regName(ra) << " [" << i << "]";
+            out.push_back(fieldMismatch(name.str().c_str(), va, vb));
+        }
+    }
+}
+
+/** Compare two records, appending the differences to out. */
+void
+compareRecords(const TarmacBinaryRecord &a, const TarmacBinaryRecord &b,
+               const TarmacBinaryDiffOptions &opts,
+               std::vector<std::string> &out)
+{
+    const InstHeader &ia = *a.inst;
+    const InstHeader &ib = *b.inst;
+
+    if (opts.compareTicks && ia.tick != ib.tick)
+        out.push_back(fieldMismatch("tick", ia.tick, ib.tick));
+    if (ia.addr != ib.addr)
+        out.push_back(fieldMismatch("pc", ia.addr, ib.addr));
+    if (opts.comparePaddr && (ia.flags & ib.flags & InstPaddrValid) &&
+            ia.paddr != ib.paddr) {
+        out.push_back(fieldMismatch("physical pc", ia.paddr, ib.paddr));
+    }
+    if (ia.opcode != ib.opcode)
+        out.push_back(fieldMismatch("opcode", ia.opcode, ib.opcode));
+    if ((ia.flags ^ ib.flags) & InstTaken)
+        out.push_back(fieldMismatch("taken", ia.flags & InstTaken,
+                                    ib.flags & InstTaken));
+    if (ia.isetstate != ib.isetstate)
+        out.push_back(fieldMismatch("iset", ia.isetstate, ib.isetstate));
+    if (ia.mode != ib.mode)
+        out.push_back(fieldMismatch("mode", ia.mode, ib.mode));
+
+    if (opts.compareMem) {
+        if (ia.numMems != ib.numMems) {
+            out.push_back(fieldMismatch("memory accesses",
+                                        ia.numMems, ib.numMems));
+        } else {
+            for (unsigned i = 0; i < ia.numMems; i++) {
+                const MemEntry &ma = a.mems[i];
+                const MemEntry &mb = b.mems[i];
+                if (ma.addr != mb.addr)
+                    out.push_back(fieldMismatch("mem addr",
+                                                ma.addr, mb.addr));
+                if (ma.size != mb.size)
+                    out.push_back(fieldMismatch("mem size",
+                                                ma.size, mb.size));
+                if (ma.data != mb.data)
+                    out.push_back(fieldMismatch("mem data",
+                                                ma.data, mb.data));
+                if ((ma.flags ^ mb.flags) & MemLoad)
+                    out.push_back(fieldMismatch("mem load",
+                                                ma.flags & MemLoad,
+                                                mb.flags & MemLoad));
+                if (opts.comparePaddr &&
+                        (ma.flags & mb.flags & MemPaddrValid) &&
+                        ma.paddr != mb.paddr) {
+                    out.push_back(fieldMismatch("mem physical addr",
+                                                ma.paddr, mb.paddr));
+                }
+            }
+        }
+    }
+
+    // Models don't have to agree on the order registers are written in.
+    const RegEntry *ra = a.regs;
+    for (unsigned i = 0; i < ia.numRegs; i++, ra = ra->next()) {
+        if (const RegEntry *rb = findReg(b, *ra))
+            compareRegs(*ra, *rb, out);
+        else
+            out.push_back(regName(*ra) + " only written in the first trace");
+    }
+    const RegEntry *rb = b.regs;
+    for (unsigned i = 0; i < ib.numRegs; i++, rb = rb->next()) {
+        if (!findReg(a, *rb))
+            out.push_back(regName(*rb) +
+                          " only written in the second trace");
+    }
+}
+
+} // anonymous namespace
+
+std::vector<TarmacBinaryMismatch>
+diffTarmacBinary(TarmacBinaryReader &a, TarmacBinaryReader &b,
+                 const TarmacBinaryDiffOptions &opts, std::string &error)
+{
+    const uint64_t chunk = std::max<uint64_t>(opts.chunkRecords, 1);
+    const uint64_t max_mismatches = opts.maxMismatches ?
+        opts.maxMismatches : std::numeric_limits<uint64_t>::max();
+
+    // Index both traces at the same time, they are independent.
+    bool indexed_b = false;
+    std::thread index_b([&] { indexed_b = b.buildIndex(chunk); });
+    const bool indexed_a = a.buildIndex(chunk);
+    index_b.join();
+    if (!indexed_a || !indexed_b) {
+        error = indexed_a ? b.error() : a.error();
+        return {};
+    }
+
+    const uint64_t common = std::min(a.numRecords(), b.numRecords());
+    const uint64_t num_chunks = (common + chunk - 1) / chunk;
+
+    unsigned num_threads = opts.threads ? opts.threads :
+        std::thread::hardware_concurrency();
+    num_threads = std::max<uint64_t>(
+        std::min<uint64_t>(num_threads, num_chunks), 1);
+
+    std::atomic<uint64_t> next_chunk{0};
+    // Records past the cutoff can't be among the first mismatches, as a
+    // chunk before them already has enough.
+    std::atomic<uint64_t> cutoff{std::numeric_limits<uint64_t>::max()};
+    std::atomic<bool> corrupt{false};
+    std::mutex lock;
+    std::vector<TarmacBinaryMismatch> mismatches;
+
+    auto worker = [&] {
+        std::vector<TarmacBinaryMismatch> found;
+        std::vector<std::string> diffs;
+        uint64_t c;
+        while ((c = next_chunk++) < num_chunks && !corrupt) {
+            const uint64_t start = c * chunk;
+            if (start >= cutoff)
+                break;
+            const uint64_t end = std::min(start + chunk, common);
+
+            auto ca = a.at(start);
+            auto cb = b.at(start);
+            TarmacBinaryRecord ra, rb;
+            uint64_t in_chunk = 0;
+            for (uint64_t rec = start; rec < end; rec++) {
+                if (!ca.next(ra) || !cb.next(rb)) {
+                    std::lock_guard<std::mutex> guard(lock);
+                    if (!corrupt) {
+                        std::ostringstream msg;
+                        msg << "malformed record " << rec << " in the "
+                            << (ca.error() ? "first" : "second")
+                            << " trace";
+                        error = msg.str();
+                    }
+                    corrupt = true;
+                    break;
+                }
+
+                diffs.clear();
+                compareRecords(ra, rb, opts, diffs);
+                for (auto &diff : diffs)
+                    found.push_back({rec, ra.inst->addr, std::move(diff)});
+                in_chunk += diffs.size();
+
+                if (in_chunk >= max_mismatches) {
+                    uint64_t prev = cutoff;
+                    while (rec < prev &&
+                           !cutoff.compare_exchange_weak(prev, rec)) {
+                    }
+                    break;
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> guard(lock);
+        mismatches.insert(mismatches.end(),
+                          std::make_move_iterator(found.begin()),
+                          std::make_move_iterator(found.end()));
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < num_threads; i++)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &thread : threads)
+        thread.join();
+
+    if (corrupt)
+        return {};
+
+    std::stable_sort(mismatches.begin(), mismatches.end(),
+                     [](const auto &x, const auto &y) {
+                         return x.record < y.record;
+                     });
+
+    if (a.numRecords() != b.numRecords() &&
+            mismatches.size() < max_mismatches) {
+        // Report the address of the first record only the longer trace
+        // has.
+        const TarmacBinaryReader &longer =
+            a.numRecords() > b.numRecords() ? a : b;
+        uint64_t addr = 0;
+        TarmacBinaryRecord rec;
+        auto cursor = longer.at(common - common % chunk);
+        while (cursor.record() <= common && cursor.next(rec))
+            addr = rec.inst->addr;
+
+        std::ostringstream msg;
+        msg << "records: " << a.numRecords() << " != " << b.numRecords();
+        mismatches.push_back({common, addr, msg.str()});
+    }
+
+    if (mismatches.size() > max_mismatches)
+        mismatches.resize(max_mismatches);
+
+    return mismatches;
+}
+
+} // namespace trace
+} // namespace gem5
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file: A compact binary encoding of Tarmac traces, with the writer
+ *        used by the TarmacTracer, an mmap based reader and a parallel
+ *        trace comparator.
+ *
+ *        A trace starts with a FileHeader and is followed by one record
+ *        per traced instruction. A record is an InstHeader, immediately
+ *        followed by its MemEntry array and then by its variable sized
+ *        RegEntry list. Every structure is a multiple of 8 bytes, so all
+ *        the fields of a mapped trace are naturally aligned and can be
+ *        read in place. Fields are stored in the byte order of the host
+ *        which wrote the trace; the reader rejects traces written with a
+ *        different one.
+ *
+ *        This file only depends on the standard library, so offline
+ *        tools can be built from it without the rest of gem5.
+ */
+
+#ifndef __ARCH_ARM_TRACERS_TARMAC_BINARY_HH__
+#define __ARCH_ARM_TRACERS_TARMAC_BINARY_HH__
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace gem5
+{
+
+namespace trace {
+
+namespace tarmac_binary
+{
+
+constexpr char Magic[8] = {'G', '5', 'T', 'A', 'R', 'M', 'A', 'C'};
+constexpr uint32_t Version = 1;
+constexpr uint32_t ByteOrderMark = 0x01020304;
+
+struct FileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+};
+
+/** InstHeader flags */
+enum InstFlags : uint8_t
+{
+    InstTaken = 1 << 0,
+    InstSecure = 1 << 1,
+    InstPaddrValid = 1 << 2,
+};
+
+struct InstHeader
+{
+    uint64_t tick;
+    /** Number of the instruction in the trace of the whole system */
+    uint64_t seqNum;
+    uint64_t addr;
+    uint64_t paddr;
+    uint32_t opcode;
+    /** Size in bytes of the whole record, header included */
+    uint32_t size;
+    uint16_t cpu;
+    uint16_t numMems;
+    uint16_t numRegs;
+    /** Instruction size in bits */
+    uint8_t instSize;
+    /** TarmacBaseRecord::ISetState */
+    uint8_t isetstate;
+    /** ArmISA::OperatingMode */
+    uint8_t mode;
+    uint8_t flags;
+    uint8_t pad[6];
+};
+
+/** MemEntry flags */
+enum MemFlags : uint8_t
+{
+    MemLoad = 1 << 0,
+    MemPaddrValid = 1 << 1,
+};
+
+struct MemEntry
+{
+    uint64_t addr;
+    uint64_t paddr;
+    uint64_t data;
+    uint8_t size;
+    uint8_t flags;
+    uint8_t pad[6];
+};
+
+struct RegEntry
+{
+    /** gem5 RegClassType of the register */
+    uint8_t regClass;
+    uint8_t numValues;
+    uint16_t index;
+    /** Width of the register in bits */
+    uint16_t width;
+    uint16_t pad;
+
+    /** Value of the register, 64 bits at a time, least significant first */
+    const uint64_t *
+    values() const
+    {
+        return reinterpret_cast<const uint64_t *>(this + 1);
+    }
+
+    const RegEntry *
+    next() const
+    {
+        return reinterpret_cast<const RegEntry *>(values() + numValues);
+    }
+};
+
+static_assert(sizeof(FileHeader) % 8 == 0);
+static_assert(sizeof(InstHeader) % 8 == 0);
+static_assert(sizeof(MemEntry) % 8 == 0);
+static_assert(sizeof(RegEntry) % 8 == 0);
+
+} // namespace tarmac_binary
+
+/**
+ * A record of a binary trace, pointing into the buffer it was read
+ * from.
+ */
+struct TarmacBinaryRecord
+{
+    const tarmac_binary::InstHeader *inst = nullptr;
+    const tarmac_binary::MemEntry *mems = nullptr;
+    /** First register entry, the following ones are reached with next() */
+    const tarmac_binary::RegEntry *regs = nullptr;
+};
+
+/**
+ * Serializes Tarmac records to a stream. Entries are gathered between
+ * beginRecord() and endRecord(), in any order, and the record is only
+ * written out if an instruction was set.
+ */
+class TarmacBinaryWriter
+{
+  public:
+    /** Construct a writer and write the file header to the stream */
+    TarmacBinaryWriter(std::ostream &os);
+
+    void beginRecord(uint64_t tick, uint16_t cpu);
+
+    /**
+     * Set the instruction of the current record. The tick, cpu, size
+     * and counts of the header are filled in by the writer.
+     */
+    void setInst(const tarmac_binary::InstHeader &inst);
+
+    void addMem(const tarmac_binary::MemEntry &mem);
+
+    void addReg(uint8_t reg_class, uint16_t index, uint16_t width,
+                const uint64_t *values, unsigned num_values);
+
+    /** @return true if the record was written */
+    bool endRecord();
+
+  private:
+    std::ostream &os;
+
+    bool haveInst = false;
+    tarmac_binary::InstHeader inst;
+    std::vector<tarmac_binary::MemEntry> mems;
+    std::vector<uint64_t> regs;
+    uint16_t numRegs = 0;
+};
+
+/**
+ * Maps a binary trace in memory. Records are read through cursors, so
+ * several threads can walk different parts of the same trace. An index
+ * of every few records makes it possible to start a cursor anywhere in
+ * the trace without reading what precedes it.
+ */
+class TarmacBinaryReader
+{
+  public:
+    class Cursor
+    {
+      public:
+        /**
+         * Read the record at the cursor and move to the next one.
+         *
+         * @return false at the end of the trace, or if the record is
+         *         malformed, which error() tells apart.
+         */
+        bool next(TarmacBinaryRecord &rec);
+
+        /** Number of the record the cursor is at */
+        uint64_t record() const { return recNum; }
+
+        bool error() const { return corrupt; }
+
+      private:
+        friend class TarmacBinaryReader;
+
+        Cursor(const char *_pos, const char *_end, uint64_t rec_num)
+          : pos(_pos), end(_end), recNum(rec_num)
+        {}
+
+        const char *pos;
+        const char *end;
+        uint64_t recNum;
+        bool corrupt = false;
+    };
+
+    TarmacBinaryReader() = default;
+    ~TarmacBinaryReader();
+
+    TarmacBinaryReader(const TarmacBinaryReader &) = delete;
+    TarmacBinaryReader &operator=(const TarmacBinaryReader &) = delete;
+
+    /**
+     * Map a trace and check its header.
+     *
+     * @return false on error, with the reason in error().
+     */
+    bool open(const std::string &path);
+
+    const std::string &error() const { return errorMsg; }
+
+    /** Cursor on the first record */
+    Cursor begin() const;
+
+    /**
+     * Index the offset of one record every stride records, and count
+     * them. This only reads the header of each record.
+     *
+     * @return false if the trace is malformed.
+     */
+    bool buildIndex(uint64_t stride);
+
+    /** Number of records, only known once the trace has been indexed */
+    uint64_t numRecords() const { return recordCount; }
+
+    /** Stride of the index, 0 if the trace hasn't been indexed */
+    uint64_t indexStride() const { return stride; }
+
+    /**
+     * Cursor on a record of an indexed trace, which must be a multiple
+     * of the index stride.
+     */
+    Cursor at(uint64_t record) const;
+
+  private:
+    const char *data = nullptr;
+    size_t size = 0;
+
+    std::string errorMsg;
+
+    uint64_t stride = 0;
+    uint64_t recordCount = 0;
+    std::vector<uint64_t> index;
+};
+
+struct TarmacBinaryDiffOptions
+{
+    /** Number of threads to use, 0 to use one per host thread */
+    unsigned threads = 0;
+    /** Stop after this many mismatches, 0 for no limit */
+    uint64_t maxMismatches = 1;
+    /** Number of records each thread compares at a time */
+    uint64_t chunkRecords = 1 << 16;
+
+    /** Compare the tick of the instructions */
+    bool compareTicks = false;
+    /** Compare physical addresses when both traces have them */
+    bool comparePaddr = false;
+    /** Compare memory accesses */
+    bool compareMem = true;
+};
+
+struct TarmacBinaryMismatch
+{
+    /** Number of the record in the traces */
+    uint64_t record;
+    /** Address of the instruction in the first trace */
+    uint64_t addr;
+    std::string description;
+};
+
+/**
+ * Compare two traces record by record, splitting them in chunks which
+ * are compared in parallel. Both traces are indexed with the chunk size
+ * if they aren't already.
+ *
+ * @param error Set if a trace is malformed.
+ * @return The first mismatches, in trace order.
+ */
+std::vector<TarmacBinaryMismatch>
+diffTarmacBinary(TarmacBinaryReader &a, TarmacBinaryReader &b,
+                 const TarmacBinaryDiffOptions &opts, std::string &error);
+
+} // namespace trace
+} // namespace gem5
+
+#endif // __ARCH_ARM_TRACERS_TARMAC_BINARY_HH__
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "arch/arm/tracers/tarmac_binary.hh"
+
+using namespace gem5;
+using namespace gem5::trace;
+
+namespace
+{
+
+/** A trace in a temporary file, removed when going out of scope. */
+class TraceFile
+{
+  public:
+    TraceFile()
+    {
+        char name[] = "tarmac-XXXXXX";
+        int fd = mkstemp(name);
+        EXPECT_NE(-1, fd);
+        close(fd);
+        path = name;
+    }
+
+    ~TraceFile() { unlink(path.c_str()); }
+
+    std::string path;
+};
+
+/**
+ * Write a trace of num_records instructions. Every instruction writes
+ * x1 and every fourth one also stores to memory and writes a vector
+ * register.
+ */
+void
+writeTrace(const std::string &path, uint64_t num_records,
+           uint64_t corrupt_record = ~0ULL)
+{
+    std::ofstream os(path, std::ios::binary);
+    TarmacBinaryWriter writer(os);
+
+    for (uint64_t i = 0; i < num_records; i++) {
+        writer.beginRecord(i * 500, 0);
+
+        tarmac_binary::InstHeader inst = {};
+        inst.seqNum = i;
+        inst.addr = 0x80000000 + i * 4;
+        inst.opcode = 0xd503201f;
+        inst.instSize = 32;
+        inst.flags = tarmac_binary::InstTaken;
+        writer.setInst(inst);
+
+        uint64_t x1 = i == corrupt_record ? 0xbad : i * 3;
+        writer.addReg(1, 1, 64, &x1, 1);
+
+        if (i % 4 == 0) {
+            tarmac_binary::MemEntry mem = {};
+            mem.addr = 0x1000 + i * 8;
+            mem.data = i;
+            mem.size = 8;
+            writer.addMem(mem);
+
+            std::vector<uint64_t> z0(4, i);
+            writer.addReg(3, 0, 256, z0.data(), z0.size());
+        }
+
+        writer.endRecord();
+    }
+}
+
+} // anonymous namespace
+
+TEST(TarmacBinaryTest, WriteRead)
+{
+    TraceFile file;
+    writeTrace(file.path, 100);
+
+    TarmacBinaryReader reader;
+    ASSERT_TRUE(reader.open(file.path)) << reader.error();
+
+    auto cursor = reader.begin();
+    TarmacBinaryRecord rec;
+    uint64_t count = 0;
+    while (cursor.next(rec)) {
+        EXPECT_EQ(count * 500, rec.inst->tick);
+        EXPECT_EQ(0x80000000 + count * 4, rec.inst->addr);
+        EXPECT_EQ(0xd503201f, rec.inst->opcode);
+        EXPECT_EQ(count % 4 == 0 ? 1 : 0, rec.inst->numMems);
+        ASSERT_EQ(count % 4 == 0 ? 2 : 1, rec.inst->numRegs);
+
+        EXPECT_EQ(1, rec.regs->index);
+        EXPECT_EQ(count * 3, rec.regs->values()[0]);
+        if (count % 4 == 0) {
+            EXPECT_EQ(0x1000 + count * 8, rec.mems[0].addr);
+            const auto *z0 = rec.regs->next();
+            EXPECT_EQ(256, z0->width);
+            ASSERT_EQ(4, z0->numValues);
+            EXPECT_EQ(count, z0->values()[3]);
+        }
+        count++;
+    }
+    EXPECT_FALSE(cursor.error());
+    EXPECT_EQ(100, count);
+}
+
+TEST(TarmacBinaryTest, Index)
+{
+    TraceFile file;
+    writeTrace(file.path, 100);
+
+    TarmacBinaryReader reader;
+    ASSERT_TRUE(reader.open(file.path)) << reader.error();
+    ASSERT_TRUE(reader.buildIndex(16)) << reader.error();
+    EXPECT_EQ(100, reader.numRecords());
+
+    TarmacBinaryRecord rec;
+    auto cursor = reader.at(48);
+    ASSERT_TRUE(cursor.next(rec));
+    EXPECT_EQ(48, rec.inst->seqNum);
+    EXPECT_EQ(49, cursor.record());
+
+    EXPECT_FALSE(reader.at(100).next(rec));
+}
+
+TEST(TarmacBinaryTest, NotATrace)
+{
+    TraceFile file;
+    std::ofstream(file.path) << "0 clk IT (0) 80000000 d503201f O EL1h_s\n";
+
+    TarmacBinaryReader reader;
+    EXPECT_FALSE(reader.open(file.path));
+}
+
+TEST(TarmacBinaryTest, Truncated)
+{
+    TraceFile file;
+    writeTrace(file.path, 10);
+    ASSERT_EQ(0, truncate(file.path.c_str(),
+                          sizeof(tarmac_binary::FileHeader) + 100));
+
+    TarmacBinaryReader reader;
+    ASSERT_TRUE(reader.open(file.path)) << reader.error();
+    EXPECT_FALSE(reader.buildIndex(1));
+
+    auto cursor = reader.begin();
+    TarmacBinaryRecord rec;
+    while (cursor.next(rec)) {
+    }
+    EXPECT_TRUE(cursor.error());
+}
+
+TEST(TarmacBinaryTest, DiffSame)
+{
+    TraceFile file_a, file_b;
+    writeTrace(file_a.path, 1000);
+    writeTrace(file_b.path, 1000);
+
+    TarmacBinaryReader a, b;
+    ASSERT_TRUE(a.open(file_a.path)) << a.error();
+    ASSERT_TRUE(b.open(file_b.path)) << b.error();
+
+    TarmacBinaryDiffOptions opts;
+    opts.threads = 4;
+    opts.chunkRecords = 64;
+    opts.compareTicks = true;
+    std::string error;
+    EXPECT_TRUE(diffTarmacBinary(a, b, opts, error).empty());
+    EXPECT_TRUE(error.empty());
+}
+
+TEST(TarmacBinaryTest, DiffMismatch)
+{
+    TraceFile file_a, file_b;
+    writeTrace(file_a.path, 1000);
+    writeTrace(file_b.path, 1000, 777);
+
+    TarmacBinaryReader a, b;
+    ASSERT_TRUE(a.open(file_a.path)) << a.error();
+    ASSERT_TRUE(b.open(file_b.path)) << b.error();
+
+    TarmacBinaryDiffOptions opts;
+    opts.threads = 4;
+    opts.chunkRecords = 64;
+    std::string error;
+    auto mismatches = diffTarmacBinary(a, b, opts, error);
+    ASSERT_EQ(1, mismatches.size());
+    EXPECT_EQ(777, mismatches[0].record);
+    EXPECT_EQ(0x80000000 + 777 * 4, mismatches[0].addr);
+}
+
+TEST(TarmacBinaryTest, DiffLength)
+{
+    TraceFile file_a, file_b;
+    writeTrace(file_a.path, 1000);
+    writeTrace(file_b.path, 900);
+
+    TarmacBinaryReader a, b;
+    ASSERT_TRUE(a.open(file_a.path)) << a.error();
+    ASSERT_TRUE(b.open(file_b.path)) << b.error();
+
+    TarmacBinaryDiffOptions opts;
+    opts.threads = 3;
+    opts.chunkRecords = 100;
+    opts.maxMismatches = 0;
+    std::string error;
+    auto mismatches = diffTarmacBinary(a, b, opts, error);
+    ASSERT_EQ(1, mismatches.size());
+    EXPECT_EQ(900, mismatches[0].record);
+    EXPECT_EQ(0x80000000 + 900 * 4, mismatches[0].addr);
+}
+
+TEST(TarmacBinaryTest, DiffFirstShorter)
+{
+    TraceFile file_a, file_b;
+    writeTrace(file_a.path, 900);
+    writeTrace(file_b.path, 1000);
+
+    TarmacBinaryReader a, b;
+    ASSERT_TRUE(a.open(file_a.path)) << a.error();
+    ASSERT_TRUE(b.open(file_b.path)) << b.error();
+
+    // The shorter trace ends on a chunk boundary
+    TarmacBinaryDiffOptions opts;
+    opts.threads = 3;
+    opts.chunkRecords = 100;
+    opts.maxMismatches = 0;
+    std::string error;
+    auto mismatches = diffTarmacBinary(a, b, opts, error);
+    ASSERT_EQ(1, mismatches.size());
+    EXPECT_EQ(900, mismatches[0].record);
+    EXPECT_EQ(0x80000000 + 900 * 4, mismatches[0].addr);
+}
@@ -40,6 +40,7 @@
 #include <memory>
 
 #include "arch/arm/insts/static_inst.hh"
+#include "cpu/base.hh"
 #include "tarmac_tracer.hh"
 
 namespace gem5
@@ -123,9 +124,15 @@ TarmacTracerRecord::TarmacTracerRecord(Tick _when, ThreadContext *_thread,
 TarmacTracerRecord::TraceInstEntry::TraceInstEntry(
     const TarmacContext& tarmCtx,
     bool predicate)
-      : InstEntry(tarmCtx.thread, *tarmCtx.pc, tarmCtx.staticInst, predicate),
-        disassemble(tarmCtx.tracer.disassemble(tarmCtx.staticInst, *tarmCtx.pc))
+      : InstEntry(tarmCtx.thread, *tarmCtx.pc, tarmCtx.staticInst, predicate)
 {
+    // Binary traces don't store the disassembly, which is by far the
+    // most expensive part of an entry to generate.
+    if (!tarmCtx.tracer.binaryWriter()) {
+        disassemble = tarmCtx.tracer.disassemble(tarmCtx.staticInst,
+                                                 *tarmCtx.pc);
+    }
+
     secureMode = isSecure(tarmCtx.thread);
 
     auto arm_inst = static_cast<const ArmStaticInst*>(
@@ -355,7 +362,7 @@ TarmacTracerRecord::dump()
         addRegEntry(regQueue, tarmCtx);
 
         // Flush (print) any queued entry.
-        flushQueues(instQueue, memQueue, regQueue);
+        flushRecord();
 
     } else {
         // Current instruction is a micro-instruction:
@@ -372,19 +379,40 @@ TarmacTracerRecord::dump()
 
         if (staticInst->isLastMicroop()) {
             // Flush (print) any queued entry.
-            flushQueues(instQueue, memQueue, regQueue);
+            flushRecord();
         }
     }
 }
 
+void
+TarmacTracerRecord::flushRecord()
+{
+    // All the entries of an instruction make a single record of a
+    // binary trace.
+    auto *writer = tracer.binaryWriter();
+    if (writer)
+        writer->beginRecord(curTick(), thread->getCpuPtr()->cpuId());
+
+    flushQueues(tracer.instQueue, tracer.memQueue, tracer.regQueue);
+
+    if (writer)
+        writer->endRecord();
+}
+
 template<typename Queue>
 void
 TarmacTracerRecord::flushQueues(Queue& queue)
 {
-    std::ostream &outs = tracer.output();
+    if (auto *writer = tracer.binaryWriter()) {
+        for (const auto &single_entry : queue) {
+            single_entry->encode(*writer);
+        }
+    } else {
+        std::ostream &outs = tracer.output();
 
-    for (const auto &single_entry : queue) {
-        single_entry->print(outs);
+        for (const auto &single_entry : queue) {
+            single_entry->print(outs);
+        }
     }
 
     queue.clear();
@@ -453,5 +481,52 @@ TarmacTracerRecord::TraceRegEntry::print(
                  values[Lo]);                  /* Register value */
 }
 
+tarmac_binary::InstHeader
+TarmacTracerRecord::TraceInstEntry::binaryEntry() const
+{
+    tarmac_binary::InstHeader inst = {};
+    inst.seqNum = instCount;
+    inst.addr = addr;
+    inst.opcode = opcode;
+    inst.instSize = instSize;
+    inst.isetstate = isetstate;
+    inst.mode = mode;
+    inst.flags = (taken ? tarmac_binary::InstTaken : 0) |
+                 (secureMode ? tarmac_binary::InstSecure : 0);
+    return inst;
+}
+
+void
+TarmacTracerRecord::TraceInstEntry::encode(TarmacBinaryWriter &writer) const
+{
+    writer.setInst(binaryEntry());
+}
+
+tarmac_binary::MemEntry
+TarmacTracerRecord::TraceMemEntry::binaryEntry() const
+{
+    tarmac_binary::MemEntry mem = {};
+    mem.addr = addr;
+    mem.data = data;
+    mem.size = size;
+    mem.flags = loadAccess ? tarmac_binary::MemLoad : 0;
+    return mem;
+}
+
+void
+TarmacTracerRecord::TraceMemEntry::encode(TarmacBinaryWriter &writer) const
+{
+    writer.addMem(binaryEntry());
+}
+
+void
+TarmacTracerRecord::TraceRegEntry::encode(TarmacBinaryWriter &writer) const
+{
+    if (regValid) {
+        writer.addReg(regId.classValue(), regId.index(), 32,
+                      &values[Lo], 1);
+    }
+}
+
 } // namespace trace
 } // namespace gem5
@@ -47,6 +47,7 @@
 
 #include "arch/arm/regs/misc.hh"
 #include "arch/arm/tracers/tarmac_base.hh"
+#include "arch/arm/tracers/tarmac_binary.hh"
 #include "base/printable.hh"
 #include "cpu/reg_class.hh"
 #include "cpu/static_inst.hh"
@@ -103,7 +104,13 @@ class TarmacTracerRecord : public TarmacBaseRecord
                            int verbosity = 0,
                            const std::string &prefix = "") const override;
 
+        /** Add the entry to the record of a binary trace */
+        virtual void encode(TarmacBinaryWriter &writer) const;
+
       protected:
+        /** Binary representation of the entry */
+        tarmac_binary::InstHeader binaryEntry() const;
+
         /** Number of instructions being traced */
         static uint64_t instCount;
 
@@ -141,6 +148,9 @@ class TarmacTracerRecord : public TarmacBaseRecord
                            int verbosity = 0,
                            const std::string &prefix = "") const override;
 
+        /** Add the entry to the record of a binary trace */
+        virtual void encode(TarmacBinaryWriter &writer) const;
+
       protected:
         /** Register update functions. */
         virtual void updateMisc(const TarmacContext& tarmCtx);
@@ -170,7 +180,13 @@ class TarmacTracerRecord : public TarmacBaseRecord
                            int verbosity = 0,
                            const std::string &prefix = "") const override;
 
+        /** Add the entry to the record of a binary trace */
+        virtual void encode(TarmacBinaryWriter &writer) const;
+
       protected:
+        /** Binary representation of the entry */
+        tarmac_binary::MemEntry binaryEntry() const;
+
         /** True if memory access is a load */
         bool loadAccess;
     };
@@ -250,6 +266,9 @@ class TarmacTracerRecord : public TarmacBaseRecord
         }
     }
 
+    /** Flush the entries of an instruction to the trace output */
+    void flushRecord();
+
     /** Flush queues to the trace output */
     template<typename Queue>
     void flushQueues(Queue& queue);
@@ -71,13 +71,14 @@ TarmacTracerRecordV8::TraceMemEntryV8::TraceMemEntryV8(
     uint8_t _size, Addr _addr, uint64_t _data)
       : TraceMemEntry(tarmCtx, _size, _addr, _data),
         TraceEntryV8(tarmCtx.tarmacCpuName()),
-        paddr(_addr)
+        paddr(_addr),
+        paddrValid(false)
 {
     const auto thread = tarmCtx.thread;
 
     // Evaluate physical address
     auto mmu = static_cast<ArmISA::MMU*>(thread->getMMUPtr());
-    mmu->translateFunctional(thread, addr, paddr);
+    paddrValid = mmu->translateFunctional(thread, addr, paddr);
 }
 
 TarmacTracerRecordV8::TraceRegEntryV8::TraceRegEntryV8(
@@ -314,5 +315,47 @@ TarmacTracerRecordV8::TraceRegEntryV8::formatReg() const
     }
 }
 
+void
+TarmacTracerRecordV8::TraceInstEntryV8::encode(
+    TarmacBinaryWriter &writer) const
+{
+    auto inst = binaryEntry();
+    if (paddrValid) {
+        inst.paddr = paddr;
+        inst.flags |= tarmac_binary::InstPaddrValid;
+    }
+    writer.setInst(inst);
+}
+
+void
+TarmacTracerRecordV8::TraceMemEntryV8::encode(
+    TarmacBinaryWriter &writer) const
+{
+    auto mem = binaryEntry();
+    if (paddrValid) {
+        mem.paddr = paddr;
+        mem.flags |= tarmac_binary::MemPaddrValid;
+    }
+    writer.addMem(mem);
+}
+
+void
+TarmacTracerRecordV8::TraceRegEntryV8::encode(
+    TarmacBinaryWriter &writer) const
+{
+    if (!regValid)
+        return;
+
+    // Scalar values are masked to the register width when compared, as
+    // they are when printed, so they can be stored as they are.
+    if (regWidth <= 64) {
+        writer.addReg(regId.classValue(), regId.index(), regWidth,
+                      &values[Lo], 1);
+    } else {
+        writer.addReg(regId.classValue(), regId.index(), regWidth,
+                      values.data(), values.size());
+    }
+}
+
 } // namespace trace
 } // namespace gem5
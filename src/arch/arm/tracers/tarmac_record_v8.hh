@@ -85,6 +85,8 @@ class TarmacTracerRecordV8 : public TarmacTracerRecord
                            int verbosity = 0,
                            const std::string &prefix = "") const override;
 
+        void encode(TarmacBinaryWriter &writer) const override;
+
       protected:
         Addr paddr;
         bool paddrValid;
@@ -102,6 +104,8 @@ class TarmacTracerRecordV8 : public TarmacTracerRecord
                            int verbosity = 0,
                            const std::string &prefix = "") const override;
 
+        void encode(TarmacBinaryWriter &writer) const override;
+
       protected:
         void updateInt(const TarmacContext& tarmCtx) override;
         void updateMisc(const TarmacContext& tarmCtx) override;
@@ -134,8 +138,11 @@ class TarmacTracerRecordV8 : public TarmacTracerRecord
                            int verbosity = 0,
                            const std::string &prefix = "") const override;
 
+        void encode(TarmacBinaryWriter &writer) const override;
+
       protected:
         Addr paddr;
+        bool paddrValid;
     };
 
   public:
@@ -44,6 +44,7 @@
 #include "cpu/base.hh"
 
 #include "enums/TarmacDump.hh"
+#include "enums/TarmacFormat.hh"
 
 namespace gem5
 {
@@ -68,7 +69,8 @@ tarmacDump(const TarmacTracerParams &p)
       case TarmacDump::stderror:
         return simout.findOrCreate("stderr");
       case TarmacDump::file:
-        return simout.findOrCreate(p.name);
+        return simout.findOrCreate(p.name,
+                                   p.format == TarmacFormat::binary);
       default:
         panic("Invalid option\n");
     }
@@ -88,6 +90,15 @@ TarmacTracer::TarmacTracer(const Params &p)
              "Tarmac start point: %lu is bigger than "
              "Tarmac end point: %lu\n", startTick, endTick);
 
+    // Binary traces from several CPUs can't share a stream, and
+    // couldn't be told apart from the rest of the output anyway.
+    fatal_if(p.format == TarmacFormat::binary &&
+             p.outfile != TarmacDump::file,
+             "Binary Tarmac traces must be dumped to a file\n");
+
+    if (p.format == TarmacFormat::binary)
+        binWriter = std::make_unique<TarmacBinaryWriter>(output());
+
     // By default cpu tracers in gem5 are not tracing faults
     // (exceptions).
     // This is not in compliance with the Tarmac specification:
@@ -45,6 +45,7 @@
 
 #include <memory>
 
+#include "arch/arm/tracers/tarmac_binary.hh"
 #include "arch/arm/tracers/tarmac_record.hh"
 #include "arch/arm/tracers/tarmac_record_v8.hh"
 #include "params/TarmacTracer.hh"
@@ -112,6 +113,9 @@ class TarmacTracer : public InstTracer
 
     std::ostream& output();
 
+    /** Writer of the trace if it is in binary format, nullptr if not */
+    TarmacBinaryWriter *binaryWriter() const { return binWriter.get(); }
+
   protected:
     typedef std::unique_ptr<Printable> PEntryPtr;
     typedef TarmacTracerRecord::InstPtr InstPtr;
@@ -120,6 +124,8 @@ class TarmacTracer : public InstTracer
 
     OutputStream *outstream;
 
+    std::unique_ptr<TarmacBinaryWriter> binWriter;
+
     /**
      * startTick and endTick allow to trace a specific window of ticks
      * rather than the entire CPU execution.
@@ -38,6 +38,7 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 from m5.params import *
+from m5.proxy import *
 from m5.SimObject import SimObject
 
 
@@ -77,3 +78,23 @@ class BaseTLB(SimObject):
     entry_type = Param.TypeTLB("Instruction/Data/Unified TLB entries")
 
     next_level = Param.BaseTLB(NULL, "next level")
+
+
+class PageTLBIndexingPolicy(SimObject):
+    type = "PageTLBIndexingPolicy"
+    abstract = True
+    cxx_class = "gem5::IndexingPolicyTemplate<gem5::PageTLBTypes>"
+    cxx_header = "arch/generic/page_tlb.hh"
+    cxx_template_params = ["class Types"]
+
+    # Get the size from the parent (TLB)
+    num_entries = Param.Int(Parent.size, "number of TLB entries")
+
+    # Get the associativity
+    assoc = Param.Int(Parent.assoc, "associativity")
+
+
+class PageTLBSetAssociative(PageTLBIndexingPolicy):
+    type = "PageTLBSetAssociative"
+    cxx_class = "gem5::PageTLBSetAssociative"
+    cxx_header = "arch/generic/page_tlb.hh"
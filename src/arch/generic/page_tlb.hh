@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ARCH_GENERIC_PAGE_TLB_HH__
+#define __ARCH_GENERIC_PAGE_TLB_HH__
+
+#include <cstdint>
+#include <set>
+#include <string_view>
+#include <vector>
+
+#include "base/cache/associative_cache.hh"
+#include "base/cprintf.hh"
+#include "base/types.hh"
+#include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/replacement_policies/replaceable_entry.hh"
+#include "mem/cache/tags/indexing_policies/base.hh"
+#include "params/PageTLBIndexingPolicy.hh"
+#include "params/PageTLBSetAssociative.hh"
+
+namespace gem5
+{
+
+/**
+ * Lookup key of TLBs which map a virtual address of a single address
+ * space to a page of one of a few power of two sizes.
+ */
+class PageTLBTypes
+{
+  public:
+    struct KeyType
+    {
+        // virtual address, the page offset is ignored
+        Addr va = 0;
+        // log2 of the size of the page to look for
+        unsigned logBytes = 0;
+        // address space identifier (ASID, PCID...)
+        uint64_t asid = 0;
+        // on insert, if the entry should match every address space
+        bool global = false;
+    };
+
+    using Params = PageTLBIndexingPolicyParams;
+};
+
+using PageTLBIndexingPolicy = IndexingPolicyTemplate<PageTLBTypes>;
+
+/**
+ * Set associative indexing of a PageTLB. Consecutive pages of the
+ * looked up size map to consecutive sets.
+ */
+class PageTLBSetAssociative : public PageTLBIndexingPolicy
+{
+  public:
+    PARAMS(PageTLBSetAssociative);
+    PageTLBSetAssociative(const Params &p)
+      : PageTLBIndexingPolicy(p, p.num_entries, 0)
+    {}
+
+    std::vector<ReplaceableEntry*>
+    getPossibleEntries(const KeyType &key) const override
+    {
+        return sets[(key.va >> key.logBytes) & setMask];
+    }
+
+    Addr
+    regenerateAddr(const KeyType &key,
+                   const ReplaceableEntry *entry) const override
+    {
+        panic("Unimplemented\n");
+    }
+};
+
+/**
+ * Base class of the entries of a PageTLB. It keeps the key the entry
+ * was inserted with, so the ISA specific part of the entry is free to
+ * store its addresses in whatever form the ISA finds convenient.
+ */
+class PageTLBEntry : public ReplaceableEntry
+{
+  public:
+    using KeyType = PageTLBTypes::KeyType;
+    using IndexingPolicy = PageTLBIndexingPolicy;
+
+    PageTLBEntry() = default;
+    PageTLBEntry(const PageTLBEntry &rhs) = default;
+
+    /**
+     * Copying an entry into a TLB slot must not change where the slot
+     * is or its replacement data, so only the key is copied.
+     */
+    PageTLBEntry &
+    operator=(const PageTLBEntry &rhs)
+    {
+        valid = rhs.valid;
+        keyVpn = rhs.keyVpn;
+        keyLogBytes = rhs.keyLogBytes;
+        keyAsid = rhs.keyAsid;
+        keyGlobal = rhs.keyGlobal;
+        return *this;
+    }
+
+    /** Need for compliance with the AssociativeCache interface */
+    bool isValid() const { return valid; }
+
+    /** Need for compliance with the AssociativeCache interface */
+    void invalidate() { valid = false; }
+
+    /** Need for compliance with the AssociativeCache interface */
+    void
+    insert(const KeyType &key)
+    {
+        valid = true;
+        keyVpn = key.va >> key.logBytes;
+        keyLogBytes = key.logBytes;
+        keyAsid = key.asid;
+        keyGlobal = key.global;
+    }
+
+    /** Need for compliance with the AssociativeCache interface */
+    bool
+    match(const KeyType &key) const
+    {
+        return valid && keyLogBytes == key.logBytes &&
+            keyVpn == (key.va >> key.logBytes) &&
+            (keyGlobal || keyAsid == key.asid);
+    }
+
+    /** Check if the entry maps va in any address space. */
+    bool
+    matchAddress(Addr va) const
+    {
+        return valid && keyVpn == (va >> keyLogBytes);
+    }
+
+    /** The address space the entry was inserted for. */
+    uint64_t tlbAsid() const { return keyAsid; }
+
+    std::string
+    print() const override
+    {
+        return csprintf("vpn: %#x size: %#x asid: %#x global: %d | %s",
+                        keyVpn, 1ULL << keyLogBytes, keyAsid, keyGlobal,
+                        ReplaceableEntry::print());
+    }
+
+  private:
+    bool valid = false;
+    Addr keyVpn = 0;
+    unsigned keyLogBytes = 0;
+    uint64_t keyAsid = 0;
+    bool keyGlobal = false;
+};
+
+/**
+ * The storage of a TLB of PageTLBEntry derived entries, with pluggable
+ * indexing and replacement policies.
+ *
+ * Lookups don't know the size of the page they are after, so they try
+ * each page size currently held by the TLB, smallest first. The entry
+ * which hit last is checked before any of that, as most lookups are to
+ * the same page as the previous one.
+ */
+template <class Entry>
+class PageTLB : public AssociativeCache<Entry>
+{
+  public:
+    using KeyType = PageTLBTypes::KeyType;
+    using Base = AssociativeCache<Entry>;
+
+    PageTLB(std::string_view name, size_t num_entries, size_t assoc,
+            replacement_policy::Base *repl_policy,
+            PageTLBIndexingPolicy *indexing_policy)
+      : Base(name, num_entries, assoc, repl_policy, indexing_policy)
+    {}
+
+    /**
+     * Find the entry mapping a virtual address.
+     *
+     * @param va The virtual address.
+     * @param asid The address space the access is made in.
+     * @param update_repl Whether to update the replacement data.
+     * @return The entry, or nullptr on a miss.
+     */
+    Entry *
+    lookup(Addr va, uint64_t asid, bool update_repl = true)
+    {
+        KeyType key;
+        key.va = va;
+        key.asid = asid;
+
+        Entry *entry = nullptr;
+        if (prev) {
+            key.logBytes = prev->logBytes;
+            if (prev->match(key))
+                entry = prev;
+        }
+        for (auto it = pageSizes.begin(); !entry && it != pageSizes.end();
+                ++it) {
+            key.logBytes = *it;
+            entry = Base::findEntry(key);
+        }
+
+        if (entry) {
+            prev = entry;
+            if (update_repl)
+                Base::accessEntry(entry);
+        }
+        return entry;
+    }
+
+    /**
+     * Copy an entry into the TLB, evicting one if needed. The entry's
+     * logBytes member gives the size of the page it maps.
+     *
+     * @param va Virtual address of the page.
+     * @param asid Address space of the entry.
+     * @param global Whether the entry is shared by all address spaces.
+     * @param entry The translation to insert.
+     * @return The entry in the TLB.
+     */
+    Entry *
+    insert(Addr va, uint64_t asid, bool global, const Entry &entry)
+    {
+        KeyType key;
+        key.va = va;
+        key.logBytes = entry.logBytes;
+        key.asid = asid;
+        key.global = global;
+
+        Entry *victim = Base::findVictim(key);
+        *victim = entry;
+        Base::insertEntry(key, victim);
+
+        pageSizes.insert(entry.logBytes);
+        return victim;
+    }
+
+    void
+    invalidate(Entry *entry) override
+    {
+        if (entry == prev)
+            prev = nullptr;
+        Base::invalidate(entry);
+    }
+
+    /** Invalidate every entry. */
+    void
+    flush()
+    {
+        Base::clear();
+        pageSizes.clear();
+    }
+
+    /**
+     * Invalidate the entries mapping a virtual address, in any address
+     * space, which satisfy a predicate.
+     */
+    template <class Pred>
+    void
+    demap(Addr va, Pred pred)
+    {
+        KeyType key;
+        key.va = va;
+        for (auto log_bytes : pageSizes) {
+            key.logBytes = log_bytes;
+            for (auto entry : Base::getPossibleEntries(key)) {
+                if (entry->logBytes == log_bytes &&
+                        entry->matchAddress(va) && pred(*entry)) {
+                    invalidate(entry);
+                }
+            }
+        }
+    }
+
+    /** Number of valid entries. */
+    size_t
+    occupancy() const
+    {
+        size_t count = 0;
+        for (const auto &entry : *this)
+            count += entry.isValid();
+        return count;
+    }
+
+  private:
+    /** Sizes of the pages inserted since the last flush */
+    std::set<unsigned> pageSizes;
+
+    /** Last entry which hit */
+    Entry *prev = nullptr;
+};
+
+template class IndexingPolicyTemplate<PageTLBTypes>;
+
+} // namespace gem5
+
+#endif // __ARCH_GENERIC_PAGE_TLB_HH__
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ARCH_GENERIC_PAGE_WALK_CACHE_HH__
+#define __ARCH_GENERIC_PAGE_WALK_CACHE_HH__
+
+#include <cstdint>
+#include <string_view>
+
+#include "base/cache/associative_cache.hh"
+#include "base/cache/cache_entry.hh"
+#include "base/types.hh"
+#include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/tags/indexing_policies/base.hh"
+
+namespace gem5
+{
+
+/**
+ * An entry of the page walk cache. It holds the raw value of a
+ * non-leaf page table entry and is tagged by the physical address the
+ * walker read it from, so it is independent of the paging format of
+ * the ISA using it.
+ */
+class PageWalkCacheEntry : public CacheEntry
+{
+  public:
+    PageWalkCacheEntry(TagExtractor ext) : CacheEntry(ext), pte(0) {}
+
+    uint64_t pte;
+};
+
+/**
+ * A small set associative cache of upper level page table entries.
+ * Table walkers look it up before reading a directory entry from
+ * memory, so walks which share their upper levels with a previous walk
+ * only go to memory for the levels that differ. Leaf entries are never
+ * cached as they already end up in the TLB, and the walker is
+ * responsible for flushing the cache whenever the TLB is flushed.
+ */
+class PageWalkCache : public AssociativeCache<PageWalkCacheEntry>
+{
+  public:
+    PageWalkCache(std::string_view name, size_t num_entries, size_t assoc,
+                  replacement_policy::Base *repl_policy,
+                  BaseIndexingPolicy *indexing_policy)
+      : AssociativeCache<PageWalkCacheEntry>(name, num_entries, assoc,
+            repl_policy, indexing_policy,
+            PageWalkCacheEntry(genTagExtractor(indexing_policy)))
+    {}
+
+    /**
+     * Look up the entry read from a physical address.
+     *
+     * @param pte_addr Physical address of the page table entry.
+     * @param pte Set to the cached entry on a hit.
+     * @return True if the entry was found.
+     */
+    bool
+    lookup(Addr pte_addr, uint64_t &pte)
+    {
+        PageWalkCacheEntry *entry = accessEntry(pte_addr);
+        if (!entry)
+            return false;
+        pte = entry->pte;
+        return true;
+    }
+
+    /**
+     * Remember the value of a directory entry, replacing any previous
+     * copy of it.
+     */
+    void
+    insert(Addr pte_addr, uint64_t pte)
+    {
+        PageWalkCacheEntry *entry = findEntry(pte_addr);
+        if (!entry) {
+            entry = findVictim(pte_addr);
+            insertEntry(pte_addr, entry);
+        } else {
+            accessEntry(entry);
+        }
+        entry->pte = pte;
+    }
+};
+
+} // namespace gem5
+
+#endif // __ARCH_GENERIC_PAGE_WALK_CACHE_HH__
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ARCH_GENERIC_VEC_KERNELS_HH__
+#define __ARCH_GENERIC_VEC_KERNELS_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace gem5
+{
+
+/**
+ * Element kernels for the execution of vector instructions.
+ *
+ * They work on plain arrays of elements, such as the views returned by
+ * VecRegContainer::as(), and keep the loops free of branches and of
+ * calls the compiler can't see through, so it can turn them into host
+ * SIMD instructions. Predicates and masks are first unpacked to one
+ * byte per element, 1 for the active elements and 0 for the others,
+ * which lets the blends be plain bitwise operations.
+ *
+ * Unless stated otherwise, the destination may be one of the sources.
+ */
+namespace vec_kernels
+{
+
+/** An unsigned integer with the size of T, to manipulate its bits */
+template <typename T>
+using BitsOf = std::conditional_t<sizeof(T) == 1, uint8_t,
+               std::conditional_t<sizeof(T) == 2, uint16_t,
+               std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+/**
+ * Unpack a predicate with a bit per byte of the vector, like the ones of
+ * SVE, where the first bit of the bytes of an element controls it.
+ *
+ * @param active One byte per element, set to whether it is active.
+ * @param pred Anything which can be indexed by bit, e.g. a
+ * VecPredRegContainer.
+ * @param n Number of elements.
+ * @param elem_bytes Size of an element in bytes.
+ */
+template <typename Pred>
+void
+unpackPredicate(uint8_t *active, const Pred &pred, size_t n,
+        size_t elem_bytes)
+{
+    for (size_t i = 0; i < n; i++)
+        active[i] = pred[i * elem_bytes] ? 1 : 0;
+}
+
+/**
+ * Set a predicate with a bit per byte of the vector from one byte per
+ * element, clearing the bits of the other bytes of the elements.
+ */
+template <typename Pred>
+void
+packPredicate(Pred &pred, const uint8_t *active, size_t n,
+        size_t elem_bytes)
+{
+    for (size_t i = 0; i < n; i++) {
+        pred[i * elem_bytes] = active[i];
+        for (size_t b = 1; b < elem_bytes; b++)
+            pred[i * elem_bytes + b] = false;
+    }
+}
+
+/**
+ * Unpack a mask with a bit per element, least significant bit of the
+ * first byte first, like the ones of the RISC-V vector extension.
+ *
+ * @param first Index of the bit of the first element, for the micro-ops
+ * which handle a slice of the elements.
+ */
+inline void
+unpackMaskBits(uint8_t *active, const uint8_t *bits, size_t n,
+        size_t first=0)
+{
+    for (size_t i = 0; i < n; i++)
+        active[i] = (bits[(first + i) / 8] >> ((first + i) % 8)) & 1;
+}
+
+/**
+ * Set the bits of the first n elements of a mask with a bit per
+ * element, leaving the bits of the other elements alone.
+ */
+inline void
+packMaskBits(uint8_t *bits, const uint8_t *active, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        const uint8_t bit = 1 << (i % 8);
+        bits[i / 8] = (bits[i / 8] & ~bit) | (active[i] ? bit : 0);
+    }
+}
+
+/** dest[i] = op(src[i]) */
+template <typename D, typename S, typename Op>
+void
+map(D *dest, const S *src, size_t n, Op op)
+{
+    for (size_t i = 0; i < n; i++)
+        dest[i] = op(src[i]);
+}
+
+/** dest[i] = op(src1[i], src2[i]) */
+template <typename D, typename S1, typename S2, typename Op>
+void
+map(D *dest, const S1 *src1, const S2 *src2, size_t n, Op op)
+{
+    for (size_t i = 0; i < n; i++)
+        dest[i] = op(src1[i], src2[i]);
+}
+
+/**
+ * Copy the active elements of src to dest. The inactive elements of
+ * dest are kept, or zeroed when zeroing is set.
+ */
+template <typename T>
+void
+blend(T *dest, const T *src, const uint8_t *active, size_t n, bool zeroing)
+{
+    using U = BitsOf<T>;
+    static_assert(sizeof(U) == sizeof(T) &&
+            std::is_trivially_copyable_v<T>,
+            "Elements must be trivially copyable integer sized types");
+    const U keep = zeroing ? 0 : ~U(0);
+    for (size_t i = 0; i < n; i++) {
+        U d, s;
+        std::memcpy(&d, &dest[i], sizeof(U));
+        std::memcpy(&s, &src[i], sizeof(U));
+        const U m = -U(active[i]);
+        d = (s & m) | (d & ~m & keep);
+        std::memcpy(&dest[i], &d, sizeof(U));
+    }
+}
+
+/**
+ * dest[i] = op(src1[i], src2[i]) for the active elements, the others
+ * being kept or zeroed. The operation is computed for every element and
+ * the results blended in, so it must not have side effects, such as
+ * floating point exception flags, which the inactive elements mustn't
+ * cause. Use mapActive() for those.
+ *
+ * @param tmp Scratch space for n elements, not aliasing the others.
+ */
+template <typename T, typename Op>
+void
+mapMasked(T *dest, const T *src1, const T *src2, const uint8_t *active,
+        size_t n, bool zeroing, T *tmp, Op op)
+{
+    map(tmp, src1, src2, n, op);
+    blend(dest, tmp, active, n, zeroing);
+}
+
+/**
+ * dest[i] = op(src1[i], src2[i]) for the active elements only. The
+ * inactive elements of dest are kept, or zeroed when zeroing is set.
+ */
+template <typename T, typename Op>
+void
+mapActive(T *dest, const T *src1, const T *src2, const uint8_t *active,
+        size_t n, bool zeroing, Op op)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (active[i])
+            dest[i] = op(src1[i], src2[i]);
+        else if (zeroing)
+            dest[i] = T();
+    }
+}
+
+/**
+ * active[i] = cmp(src1[i], src2[i]) && gov[i], e.g. for the comparisons
+ * which write a predicate or a mask. gov may be nullptr when all the
+ * elements are active.
+ */
+template <typename T, typename Cmp>
+void
+compare(uint8_t *active, const T *src1, const T *src2, const uint8_t *gov,
+        size_t n, Cmp cmp)
+{
+    for (size_t i = 0; i < n; i++) {
+        const uint8_t res = cmp(src1[i], src2[i]) ? 1 : 0;
+        active[i] = gov ? (res & gov[i]) : res;
+    }
+}
+
+/**
+ * dest[i] = src[n - 1 - i]. The destination must not overlap the
+ * source.
+ */
+template <typename T>
+void
+reverse(T *dest, const T *src, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        dest[i] = src[n - 1 - i];
+}
+
+/**
+ * Interleave the elements of one half of two vectors, the lower half
+ * when high is false, i.e. dest = { a[b], b[b], a[b + 1], ... } with b
+ * the first element of the half. n must be even, and the destination
+ * must not overlap the sources.
+ */
+template <typename T>
+void
+zip(T *dest, const T *a, const T *b, size_t n, bool high)
+{
+    const size_t base = high ? n / 2 : 0;
+    for (size_t i = 0; i < n / 2; i++) {
+        dest[2 * i] = a[base + i];
+        dest[2 * i + 1] = b[base + i];
+    }
+}
+
+/**
+ * Take the even or odd elements of the concatenation of two vectors,
+ * i.e. dest = { ab[odd], ab[odd + 2], ... } with ab = { a..., b... }.
+ * n must be even, and the destination must not overlap the sources.
+ */
+template <typename T>
+void
+unzip(T *dest, const T *a, const T *b, size_t n, bool odd)
+{
+    for (size_t i = 0; i < n / 2; i++) {
+        dest[i] = a[2 * i + odd];
+        dest[n / 2 + i] = b[2 * i + odd];
+    }
+}
+
+/**
+ * dest[i] = src[first + i * stride], e.g. to take a field out of
+ * segments of stride elements. The destination must not overlap the
+ * source.
+ */
+template <typename T>
+void
+extractStrided(T *dest, const T *src, size_t first, size_t stride,
+        size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        dest[i] = src[first + i * stride];
+}
+
+/**
+ * dest[first + i * stride] = src[i], the inverse of extractStrided().
+ * The other elements of dest are left alone. The destination must not
+ * overlap the source.
+ */
+template <typename T>
+void
+insertStrided(T *dest, const T *src, size_t first, size_t stride,
+        size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        dest[first + i * stride] = src[i];
+}
+
+/**
+ * dest[i] = table[idx[i]], or 0 if the index is out of the table. The
+ * destination must not overlap the table.
+ */
+template <typename T, typename I>
+void
+tableLookup(T *dest, const T *table, size_t table_n, const I *idx,
+        size_t n)
+{
+    static_assert(std::is_integral_v<I>, "Indices must be integers");
+    for (size_t i = 0; i < n; i++) {
+        const auto j = static_cast<std::make_unsigned_t<I>>(idx[i]);
+        dest[i] = j < table_n ? table[j] : T();
+    }
+}
+
+} // namespace vec_kernels
+} // namespace gem5
+
+#endif // __ARCH_GENERIC_VEC_KERNELS_HH__
@@ -0,0 +1,361 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "arch/generic/vec_kernels.hh"
+#include "arch/generic/vec_pred_reg.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Compare elements bit by bit, so NaNs and signed zeros are checked */
+template <typename T>
+void
+expectSameBits(const std::vector<T> &expected, const std::vector<T> &actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(0, std::memcmp(&expected[i], &actual[i], sizeof(T)))
+            << "element " << i;
+    }
+}
+
+template <typename T>
+std::vector<T>
+randomElems(std::mt19937_64 &gen, size_t n)
+{
+    std::vector<T> v(n);
+    for (auto &e : v) {
+        uint64_t bits = gen();
+        std::memcpy(&e, &bits, sizeof(T));
+    }
+    return v;
+}
+
+/** Check a masked binary operation against the scalar loop */
+template <typename T, typename Op>
+void
+checkMasked(const std::vector<T> &a, const std::vector<T> &b,
+        const std::vector<T> &old, const std::vector<uint8_t> &active,
+        Op op)
+{
+    const size_t n = a.size();
+    for (bool zeroing : {false, true}) {
+        std::vector<T> expected(old);
+        for (size_t i = 0; i < n; i++) {
+            if (active[i])
+                expected[i] = op(a[i], b[i]);
+            else if (zeroing)
+                expected[i] = 0;
+        }
+
+        std::vector<T> masked(old), tmp(n);
+        vec_kernels::mapMasked(masked.data(), a.data(), b.data(),
+                active.data(), n, zeroing, tmp.data(), op);
+        expectSameBits(expected, masked);
+
+        std::vector<T> only_active(old);
+        vec_kernels::mapActive(only_active.data(), a.data(), b.data(),
+                active.data(), n, zeroing, op);
+        expectSameBits(expected, only_active);
+    }
+}
+
+} // anonymous namespace
+
+TEST(VecKernels, ExhaustiveByteArithmetic)
+{
+    // Every pair of 8 bit operands, one vector per first operand
+    std::vector<uint8_t> b(256);
+    for (int i = 0; i < 256; i++)
+        b[i] = i;
+
+    auto add = [](uint8_t x, uint8_t y) -> uint8_t { return x + y; };
+    auto sub = [](uint8_t x, uint8_t y) -> uint8_t { return x - y; };
+    auto mul = [](uint8_t x, uint8_t y) -> uint8_t { return x * y; };
+    auto smax = [](uint8_t x, uint8_t y) -> uint8_t {
+        return std::max<int8_t>(x, y);
+    };
+
+    for (int x = 0; x < 256; x++) {
+        std::vector<uint8_t> a(256, x);
+        for (auto op : {+add, +sub, +mul, +smax}) {
+            std::vector<uint8_t> expected(256), actual(256);
+            for (int i = 0; i < 256; i++)
+                expected[i] = op(a[i], b[i]);
+            vec_kernels::map(actual.data(), a.data(), b.data(), 256, op);
+            expectSameBits(expected, actual);
+        }
+    }
+}
+
+TEST(VecKernels, ExhaustiveByteCompare)
+{
+    std::vector<int8_t> b(256);
+    for (int i = 0; i < 256; i++)
+        b[i] = i;
+
+    std::vector<uint8_t> gov(256);
+    for (int i = 0; i < 256; i++)
+        gov[i] = (i * 7) % 3 != 0;
+
+    for (int x = 0; x < 256; x++) {
+        std::vector<int8_t> a(256, x);
+        std::vector<uint8_t> expected(256), actual(256);
+
+        for (int i = 0; i < 256; i++)
+            expected[i] = a[i] < b[i];
+        vec_kernels::compare(actual.data(), a.data(), b.data(), nullptr,
+                256, [](int8_t x, int8_t y) { return x < y; });
+        expectSameBits(expected, actual);
+
+        for (int i = 0; i < 256; i++)
+            expected[i] = gov[i] && a[i] == b[i];
+        vec_kernels::compare(actual.data(), a.data(), b.data(), gov.data(),
+                256, [](int8_t x, int8_t y) { return x == y; });
+        expectSameBits(expected, actual);
+    }
+}
+
+TEST(VecKernels, ExhaustiveMasks)
+{
+    // Every mask of an 8 element vector, for every element size
+    std::mt19937_64 gen(1);
+    auto a8 = randomElems<uint8_t>(gen, 8), b8 = randomElems<uint8_t>(gen, 8);
+    auto a64 = randomElems<uint64_t>(gen, 8);
+    auto b64 = randomElems<uint64_t>(gen, 8);
+    auto a16 = randomElems<uint16_t>(gen, 8);
+    auto b16 = randomElems<uint16_t>(gen, 8);
+    auto a32 = randomElems<uint32_t>(gen, 8);
+    auto b32 = randomElems<uint32_t>(gen, 8);
+
+    for (int mask = 0; mask < 256; mask++) {
+        std::vector<uint8_t> active(8);
+        for (int i = 0; i < 8; i++)
+            active[i] = (mask >> i) & 1;
+
+        checkMasked(a8, b8, b8, active,
+                [](uint8_t x, uint8_t y) -> uint8_t { return x ^ y; });
+        checkMasked(a16, b16, a16, active,
+                [](uint16_t x, uint16_t y) -> uint16_t { return x - y; });
+        checkMasked(a32, b32, b32, active,
+                [](uint32_t x, uint32_t y) -> uint32_t { return x * y; });
+        checkMasked(a64, b64, a64, active,
+                [](uint64_t x, uint64_t y) { return x + y; });
+    }
+}
+
+TEST(VecKernels, FloatSpecialValues)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float denorm = std::numeric_limits<float>::denorm_min();
+    const std::vector<float> values = {
+        0.0f, -0.0f, 1.0f, -1.0f, 1.5f, inf, -inf, nan, denorm, -denorm,
+        std::numeric_limits<float>::max(), std::numeric_limits<float>::min()
+    };
+
+    // Every pair of special values, as the first and second operands
+    std::vector<float> a, b;
+    for (float x : values) {
+        for (float y : values) {
+            a.push_back(x);
+            b.push_back(y);
+        }
+    }
+    const size_t n = a.size();
+
+    std::vector<uint8_t> active(n);
+    for (size_t i = 0; i < n; i++)
+        active[i] = i % 3 != 1;
+
+    checkMasked(a, b, b, active, [](float x, float y) { return x + y; });
+    checkMasked(a, b, a, active, [](float x, float y) { return x * y; });
+    checkMasked(a, b, b, active,
+            [](float x, float y) { return std::fmin(x, y); });
+
+    std::vector<uint8_t> expected(n), actual(n);
+    for (size_t i = 0; i < n; i++)
+        expected[i] = a[i] >= b[i];
+    vec_kernels::compare(actual.data(), a.data(), b.data(), nullptr, n,
+            [](float x, float y) { return x >= y; });
+    expectSameBits(expected, actual);
+}
+
+TEST(VecKernels, RandomWideElements)
+{
+    std::mt19937_64 gen(2);
+    for (size_t n : {1, 2, 3, 7, 16, 31, 64, 256}) {
+        auto a = randomElems<double>(gen, n);
+        auto b = randomElems<double>(gen, n);
+        auto old = randomElems<double>(gen, n);
+        std::vector<uint8_t> active(n);
+        for (auto &e : active)
+            e = gen() & 1;
+
+        checkMasked(a, b, old, active,
+                [](double x, double y) { return x - y; });
+
+        auto ai = randomElems<int64_t>(gen, n);
+        auto bi = randomElems<int64_t>(gen, n);
+        auto oldi = randomElems<int64_t>(gen, n);
+        checkMasked(ai, bi, oldi, active,
+                [](int64_t x, int64_t y) { return std::min(x, y); });
+    }
+}
+
+TEST(VecKernels, Permutes)
+{
+    std::mt19937_64 gen(3);
+    for (size_t n = 2; n <= 64; n += 2) {
+        auto a = randomElems<uint16_t>(gen, n);
+        auto b = randomElems<uint16_t>(gen, n);
+        std::vector<uint16_t> expected(n), actual(n);
+
+        for (size_t i = 0; i < n; i++)
+            expected[i] = a[n - 1 - i];
+        vec_kernels::reverse(actual.data(), a.data(), n);
+        expectSameBits(expected, actual);
+
+        for (bool high : {false, true}) {
+            size_t base = high ? n / 2 : 0;
+            for (size_t i = 0; i < n; i++)
+                expected[i] = (i % 2 ? b : a)[base + i / 2];
+            vec_kernels::zip(actual.data(), a.data(), b.data(), n, high);
+            expectSameBits(expected, actual);
+        }
+
+        for (bool odd : {false, true}) {
+            std::vector<uint16_t> ab(a);
+            ab.insert(ab.end(), b.begin(), b.end());
+            for (size_t i = 0; i < n; i++)
+                expected[i] = ab[2 * i + odd];
+            vec_kernels::unzip(actual.data(), a.data(), b.data(), n, odd);
+            expectSameBits(expected, actual);
+        }
+
+        // Indices in and out of the table, including negative ones
+        std::vector<int16_t> idx(n);
+        for (auto &e : idx)
+            e = (int16_t)(gen() % (3 * n)) - (int16_t)n;
+        for (size_t i = 0; i < n; i++) {
+            expected[i] = idx[i] >= 0 && (size_t)idx[i] < n ?
+                a[idx[i]] : 0;
+        }
+        vec_kernels::tableLookup(actual.data(), a.data(), n, idx.data(), n);
+        expectSameBits(expected, actual);
+
+        // Fields of segments of up to 8 elements
+        for (size_t stride = 1; stride <= 8; stride++) {
+            for (size_t first = 0; first < std::min(stride, n); first++) {
+                const size_t m = (n - 1 - first) / stride + 1;
+                std::vector<uint16_t> field(m), fexpected(m);
+                for (size_t i = 0; i < m; i++)
+                    fexpected[i] = a[first + i * stride];
+                vec_kernels::extractStrided(field.data(), a.data(), first,
+                        stride, m);
+                expectSameBits(fexpected, field);
+
+                std::vector<uint16_t> inserted(b);
+                expected = b;
+                for (size_t i = 0; i < m; i++)
+                    expected[first + i * stride] = field[i];
+                vec_kernels::insertStrided(inserted.data(), field.data(),
+                        first, stride, m);
+                expectSameBits(expected, inserted);
+            }
+        }
+    }
+}
+
+TEST(VecKernels, Predicates)
+{
+    constexpr size_t bits = 64;
+    std::mt19937_64 gen(4);
+
+    for (size_t elem_bytes : {1, 2, 4, 8}) {
+        const size_t n = bits / elem_bytes;
+        VecPredRegContainer<bits, false> pred;
+        for (size_t i = 0; i < bits; i++)
+            pred[i] = gen() & 1;
+
+        std::vector<uint8_t> active(n);
+        vec_kernels::unpackPredicate(active.data(), pred, n, elem_bytes);
+        for (size_t i = 0; i < n; i++)
+            EXPECT_EQ(pred[i * elem_bytes], (bool)active[i]);
+
+        VecPredRegContainer<bits, false> packed;
+        packed.set();
+        vec_kernels::packPredicate(packed, active.data(), n, elem_bytes);
+        for (size_t i = 0; i < bits; i++) {
+            EXPECT_EQ(i % elem_bytes == 0 && active[i / elem_bytes],
+                    packed[i]);
+        }
+    }
+
+    // Masks with a bit per element, partially updated
+    for (size_t n : {1, 5, 8, 13, 64}) {
+        std::vector<uint8_t> mask(8);
+        for (auto &e : mask)
+            e = gen();
+        std::vector<uint8_t> active(n);
+        vec_kernels::unpackMaskBits(active.data(), mask.data(), n);
+        for (size_t i = 0; i < n; i++)
+            EXPECT_EQ((mask[i / 8] >> (i % 8)) & 1, active[i]);
+
+        std::vector<uint8_t> flipped(n), updated(mask);
+        for (size_t i = 0; i < n; i++)
+            flipped[i] = !active[i];
+        vec_kernels::packMaskBits(updated.data(), flipped.data(), n);
+        for (size_t i = 0; i < 64; i++) {
+            const int bit = (updated[i / 8] >> (i % 8)) & 1;
+            const int old = (mask[i / 8] >> (i % 8)) & 1;
+            EXPECT_EQ(i < n ? !old : old, bit);
+        }
+
+        // Starting at any bit, e.g. for the micro-ops of a slice
+        for (size_t first : {1, 7, 8, 11}) {
+            vec_kernels::unpackMaskBits(active.data(), mask.data(),
+                    std::min(n, 64 - first), first);
+            for (size_t i = 0; i < std::min(n, 64 - first); i++) {
+                EXPECT_EQ((mask[(first + i) / 8] >> ((first + i) % 8)) & 1,
+                        active[i]);
+            }
+        }
+    }
+}
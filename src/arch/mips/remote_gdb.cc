@@ -165,7 +165,7 @@ RemoteGDB::acc(Addr va, size_t len)
     // Check to make sure the first byte is mapped into the processes address
     // space.
     panic_if(FullSystem, "acc not implemented for MIPS FS!");
-    return context()->getProcessPtr()->pTable->lookup(va) != nullptr;
+    return context()->getProcessPtr()->pTable->lookup(va).has_value();
 }
 
 void
@@ -28,8 +28,14 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
-from m5.objects.BaseTLB import BaseTLB
+from m5.objects.BaseTLB import (
+    BaseTLB,
+    PageTLBIndexingPolicy,
+    PageTLBSetAssociative,
+)
 from m5.objects.ClockedObject import ClockedObject
+from m5.objects.IndexingPolicies import *
+from m5.objects.ReplacementPolicies import *
 from m5.params import *
 from m5.proxy import *
 
@@ -48,6 +54,24 @@ class RiscvPagetableWalker(ClockedObject):
     pma_checker = Param.BasePMAChecker(Parent.any, "PMA Checker")
     pmp = Param.PMP(Parent.any, "PMP")
 
+    enable_pwc = Param.Bool(
+        False, "Cache non-leaf page table entries in the walker"
+    )
+    pwc_size = Param.Unsigned(32, "Number of page walk cache entries")
+    pwc_assoc = Param.Unsigned(4, "Page walk cache associativity")
+    pwc_latency = Param.Cycles(1, "Page walk cache access latency")
+    pwc_replacement_policy = Param.BaseReplacementPolicy(
+        LRURP(), "Page walk cache replacement policy"
+    )
+    pwc_indexing_policy = Param.BaseIndexingPolicy(
+        SetAssociative(
+            size=Parent.pwc_size * 8,
+            assoc=Parent.pwc_assoc,
+            entry_size=8,
+        ),
+        "Page walk cache indexing policy",
+    )
+
 
 class RiscvTLB(BaseTLB):
     type = "RiscvTLB"
@@ -55,6 +79,16 @@ class RiscvTLB(BaseTLB):
     cxx_header = "arch/riscv/tlb.hh"
 
     size = Param.Int(64, "TLB size")
+    assoc = Param.Int(
+        Self.size, "Associativity of the TLB. Fully Associative by default"
+    )
+    indexing_policy = Param.PageTLBIndexingPolicy(
+        PageTLBSetAssociative(assoc=Parent.assoc, num_entries=Parent.size),
+        "Indexing policy of the TLB",
+    )
+    replacement_policy = Param.BaseReplacementPolicy(
+        LRURP(), "Replacement policy of the TLB"
+    )
     walker = Param.RiscvPagetableWalker(
         RiscvPagetableWalker(), "page table walker"
     )
@@ -32,6 +32,7 @@
 #include <string>
 
 #include "arch/riscv/insts/static_inst.hh"
+#include "arch/riscv/insts/vector_seg.hh"
 #include "arch/riscv/isa.hh"
 #include "arch/riscv/regs/misc.hh"
 #include "arch/riscv/regs/vector.hh"
@@ -673,12 +674,9 @@ VlSegDeIntrlvMicroInst::execute(ExecContext* xc, trace::InstRecord* traceData) c
     auto Vd = tmp_d0.as<uint8_t>();
     const uint32_t elems_per_vreg = micro_vl;
     vreg_t tmp_s;
-    auto s = tmp_s.as<uint8_t>();
-    uint32_t elem = 0;
-    uint32_t index = field;
 
     vreg_t tmp_v0;
-    uint8_t *v0;
+    uint8_t *v0 = nullptr;
     if (!machInst.vm) {
         xc->getRegOperand(this, vmsrcIdx, &tmp_v0);
         v0 = tmp_v0.as<uint8_t>();
@@ -696,19 +694,8 @@ VlSegDeIntrlvMicroInst::execute(ExecContext* xc, trace::InstRecord* traceData) c
 
     for (uint32_t i = 0; i < numSrcs; i++) {
         xc->getRegOperand(this, i, &tmp_s);
-        s = tmp_s.as<uint8_t>();
-
-        while (index < (i + 1) * elems_per_vreg)
-        {
-            size_t ei = elem + micro_vlmax * microIdx;
-            if (machInst.vm || elem_mask(v0, ei)) {
-                memcpy(Vd + (elem * sizeOfElement),
-                       s + ((index % elems_per_vreg) * sizeOfElement),
-                       sizeOfElement);
-            }
-            index += numSrcs;
-            elem++;
-        }
+        segDeinterleave(Vd, tmp_s.as<uint8_t>(), i, numSrcs, elems_per_vreg,
+                        field, sizeOfElement, v0, micro_vlmax * microIdx);
     }
 
     if (traceData) {
@@ -796,28 +783,10 @@ VsSegIntrlvMicroInst::execute(ExecContext* xc,
     auto Vd = tmp_d0.as<uint8_t>();
 
     vreg_t tmp_s;
-    auto s = tmp_s.as<uint8_t>();
-    xc->getRegOperand(this, 0, &tmp_s);
-    s = tmp_s.as<uint8_t>();
-
-    uint32_t indexVd = 0;
-    uint32_t srcReg = (field * elems_per_vreg) % numSrcs;
-    uint32_t indexs = (field * elems_per_vreg) / numSrcs;
-
-    while (indexVd < elems_per_vreg) {
-        xc->getRegOperand(this, srcReg, &tmp_s);
-        s = tmp_s.as<uint8_t>();
-
-        memcpy(Vd + (indexVd * sizeOfElement),
-                    s + (indexs * sizeOfElement),
-                    sizeOfElement);
-
-        indexVd++;
-        srcReg++;
-        if (srcReg >= numSrcs) {
-            srcReg = 0;
-            indexs++;
-        }
+    for (uint32_t i = 0; i < numSrcs; i++) {
+        xc->getRegOperand(this, i, &tmp_s);
+        segInterleave(Vd, tmp_s.as<uint8_t>(), i, numSrcs, elems_per_vreg,
+                      field, sizeOfElement);
     }
 
     if (traceData) {
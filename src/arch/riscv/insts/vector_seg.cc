@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "arch/riscv/insts/vector_seg.hh"
+
+#include <algorithm>
+
+#include "arch/generic/vec_kernels.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace RiscvISA
+{
+
+namespace
+{
+
+/** Masked elements moved at once, to keep the scratch space small */
+constexpr size_t ChunkElems = 64;
+
+template <typename T>
+void
+deinterleave(uint8_t *vd_bytes, const uint8_t *vs_bytes, uint32_t src_idx,
+        uint32_t num_srcs, uint32_t elems_per_vreg, uint32_t field,
+        const uint8_t *v0, size_t mask_first)
+{
+    T *vd = reinterpret_cast<T *>(vd_bytes);
+    const T *vs = reinterpret_cast<const T *>(vs_bytes);
+
+    // First element of the field in this source, as an index in the
+    // concatenation of the sources
+    const size_t lo = std::max<size_t>(field, src_idx * elems_per_vreg);
+    const size_t hi = (src_idx + 1) * elems_per_vreg;
+    const size_t first = field + divCeil(lo - field, num_srcs) * num_srcs;
+    if (first >= hi)
+        return;
+
+    const size_t n = (hi - 1 - first) / num_srcs + 1;
+    const size_t elem = (first - field) / num_srcs;
+    const size_t vs_first = first - src_idx * elems_per_vreg;
+
+    if (!v0) {
+        vec_kernels::extractStrided(vd + elem, vs, vs_first, num_srcs, n);
+        return;
+    }
+
+    T tmp[ChunkElems];
+    uint8_t active[ChunkElems];
+    for (size_t done = 0; done < n; done += ChunkElems) {
+        const size_t count = std::min(ChunkElems, n - done);
+        vec_kernels::extractStrided(tmp, vs, vs_first + done * num_srcs,
+                num_srcs, count);
+        vec_kernels::unpackMaskBits(active, v0, count,
+                mask_first + elem + done);
+        vec_kernels::blend(vd + elem + done, tmp, active, count, false);
+    }
+}
+
+template <typename T>
+void
+interleave(uint8_t *vd_bytes, const uint8_t *vs_bytes, uint32_t src_idx,
+        uint32_t num_srcs, uint32_t elems_per_vreg, uint32_t field)
+{
+    T *vd = reinterpret_cast<T *>(vd_bytes);
+    const T *vs = reinterpret_cast<const T *>(vs_bytes);
+
+    // Element i of vd is field (start + i) % num_srcs of segment
+    // (start + i) / num_srcs
+    const size_t start = field * elems_per_vreg;
+    const size_t first = (src_idx + num_srcs - start % num_srcs) % num_srcs;
+    if (first >= elems_per_vreg)
+        return;
+
+    const size_t n = (elems_per_vreg - 1 - first) / num_srcs + 1;
+    vec_kernels::insertStrided(vd, vs + (start + first) / num_srcs, first,
+            num_srcs, n);
+}
+
+} // anonymous namespace
+
+void
+segDeinterleave(uint8_t *vd, const uint8_t *vs, uint32_t src_idx,
+        uint32_t num_srcs, uint32_t elems_per_vreg, uint32_t field,
+        uint32_t elem_size, const uint8_t *v0, size_t mask_first)
+{
+    switch (elem_size) {
+      case 1:
+        deinterleave<uint8_t>(vd, vs, src_idx, num_srcs, elems_per_vreg,
+                field, v0, mask_first);
+        break;
+      case 2:
+        deinterleave<uint16_t>(vd, vs, src_idx, num_srcs, elems_per_vreg,
+                field, v0, mask_first);
+        break;
+      case 4:
+        deinterleave<uint32_t>(vd, vs, src_idx, num_srcs, elems_per_vreg,
+                field, v0, mask_first);
+        break;
+      case 8:
+        deinterleave<uint64_t>(vd, vs, src_idx, num_srcs, elems_per_vreg,
+                field, v0, mask_first);
+        break;
+      default:
+        panic("Unsupported segment element size %d.", elem_size);
+    }
+}
+
+void
+segInterleave(uint8_t *vd, const uint8_t *vs, uint32_t src_idx,
+        uint32_t num_srcs, uint32_t elems_per_vreg, uint32_t field,
+        uint32_t elem_size)
+{
+    switch (elem_size) {
+      case 1:
+        interleave<uint8_t>(vd, vs, src_idx, num_srcs, elems_per_vreg,
+                field);
+        break;
+      case 2:
+        interleave<uint16_t>(vd, vs, src_idx, num_srcs, elems_per_vreg,
+                field);
+        break;
+      case 4:
+        interleave<uint32_t>(vd, vs, src_idx, num_srcs, elems_per_vreg,
+                field);
+        break;
+      case 8:
+        interleave<uint64_t>(vd, vs, src_idx, num_srcs, elems_per_vreg,
+                field);
+        break;
+      default:
+        panic("Unsupported segment element size %d.", elem_size);
+    }
+}
+
+} // namespace RiscvISA
+} // namespace gem5
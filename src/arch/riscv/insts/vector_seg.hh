@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ARCH_RISCV_INSTS_VECTOR_SEG_HH__
+#define __ARCH_RISCV_INSTS_VECTOR_SEG_HH__
+
+#include <cstddef>
+#include <cstdint>
+
+namespace gem5
+{
+
+namespace RiscvISA
+{
+
+/**
+ * Element moves of the micro-ops which interleave and deinterleave the
+ * fields of the segment loads and stores. They work on the bytes of the
+ * vector registers, one source register at a time, and handle elements
+ * of 1, 2, 4 or 8 bytes.
+ */
+
+/**
+ * Copy the elements of a field held by one of the registers loaded by a
+ * segment load to the destination. The sources hold the segments one
+ * after the other, so the field is every num_srcs-th element of their
+ * concatenation, starting with element field.
+ *
+ * @param vd Destination register.
+ * @param vs Source register src_idx.
+ * @param v0 The mask register, or nullptr if the load isn't masked.
+ * The inactive elements of the destination are left alone.
+ * @param mask_first Index of the mask bit of the first element of vd.
+ */
+void segDeinterleave(uint8_t *vd, const uint8_t *vs, uint32_t src_idx,
+        uint32_t num_srcs, uint32_t elems_per_vreg, uint32_t field,
+        uint32_t elem_size, const uint8_t *v0=nullptr,
+        size_t mask_first=0);
+
+/**
+ * Copy the elements of one of the registers of a segment store to the
+ * destination, which holds the elements field * elems_per_vreg onwards
+ * of the segments laid out one after the other. This is the inverse of
+ * segDeinterleave().
+ *
+ * @param vd Destination register.
+ * @param vs Source register src_idx, i.e. field src_idx of the segments.
+ */
+void segInterleave(uint8_t *vd, const uint8_t *vs, uint32_t src_idx,
+        uint32_t num_srcs, uint32_t elems_per_vreg, uint32_t field,
+        uint32_t elem_size);
+
+} // namespace RiscvISA
+} // namespace gem5
+
+#endif // __ARCH_RISCV_INSTS_VECTOR_SEG_HH__
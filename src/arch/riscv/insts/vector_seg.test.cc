@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "arch/riscv/insts/vector_seg.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+using Reg = std::vector<uint8_t>;
+
+bool
+maskBit(const Reg &v0, size_t index)
+{
+    return (v0[index / 8] >> (index % 8)) & 1;
+}
+
+/** The element loop of the segment load deinterleave micro-op */
+void
+scalarDeinterleave(Reg &vd, const std::vector<Reg> &srcs,
+        uint32_t elems_per_vreg, uint32_t field, uint32_t elem_size,
+        const Reg *v0, size_t mask_first)
+{
+    const uint32_t num_srcs = srcs.size();
+    uint32_t elem = 0;
+    uint32_t index = field;
+    for (uint32_t i = 0; i < num_srcs; i++) {
+        while (index < (i + 1) * elems_per_vreg) {
+            if (!v0 || maskBit(*v0, elem + mask_first)) {
+                std::memcpy(&vd[elem * elem_size],
+                        &srcs[i][(index % elems_per_vreg) * elem_size],
+                        elem_size);
+            }
+            index += num_srcs;
+            elem++;
+        }
+    }
+}
+
+/** The element loop of the segment store interleave micro-op */
+void
+scalarInterleave(Reg &vd, const std::vector<Reg> &srcs,
+        uint32_t elems_per_vreg, uint32_t field, uint32_t elem_size)
+{
+    const uint32_t num_srcs = srcs.size();
+    uint32_t src_reg = (field * elems_per_vreg) % num_srcs;
+    uint32_t index_s = (field * elems_per_vreg) / num_srcs;
+    for (uint32_t index_vd = 0; index_vd < elems_per_vreg; index_vd++) {
+        std::memcpy(&vd[index_vd * elem_size],
+                &srcs[src_reg][index_s * elem_size], elem_size);
+        if (++src_reg >= num_srcs) {
+            src_reg = 0;
+            index_s++;
+        }
+    }
+}
+
+Reg
+randomReg(std::mt19937 &gen, size_t bytes)
+{
+    Reg reg(bytes);
+    for (auto &b : reg)
+        b = gen();
+    return reg;
+}
+
+} // anonymous namespace
+
+TEST(VectorSegTest, Deinterleave)
+{
+    std::mt19937 gen(1);
+    for (uint32_t elem_size : {1, 2, 4, 8}) {
+        for (uint32_t elems_per_vreg : {1, 2, 3, 8, 17, 256}) {
+            const size_t bytes = elems_per_vreg * elem_size;
+            for (uint32_t num_srcs = 2; num_srcs <= 8; num_srcs++) {
+                std::vector<Reg> srcs;
+                for (uint32_t i = 0; i < num_srcs; i++)
+                    srcs.push_back(randomReg(gen, bytes));
+                const Reg old = randomReg(gen, bytes);
+                const Reg v0 = randomReg(gen, 256);
+
+                for (uint32_t field = 0; field < num_srcs; field++) {
+                    for (size_t mask_first : {0, 3, 512}) {
+                        for (bool masked : {false, true}) {
+                            const Reg *mask = masked ? &v0 : nullptr;
+                            Reg expected(old), actual(old);
+                            scalarDeinterleave(expected, srcs,
+                                    elems_per_vreg, field, elem_size,
+                                    mask, mask_first);
+                            for (uint32_t i = 0; i < num_srcs; i++) {
+                                RiscvISA::segDeinterleave(actual.data(),
+                                        srcs[i].data(), i, num_srcs,
+                                        elems_per_vreg, field, elem_size,
+                                        masked ? v0.data() : nullptr,
+                                        mask_first);
+                            }
+                            EXPECT_EQ(expected, actual)
+                                << "elem_size " << elem_size
+                                << ", elems " << elems_per_vreg
+                                << ", fields " << num_srcs
+                                << ", field " << field
+                                << ", masked " << masked;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(VectorSegTest, Interleave)
+{
+    std::mt19937 gen(2);
+    for (uint32_t elem_size : {1, 2, 4, 8}) {
+        for (uint32_t elems_per_vreg : {1, 2, 3, 8, 17, 256}) {
+            const size_t bytes = elems_per_vreg * elem_size;
+            for (uint32_t num_srcs = 2; num_srcs <= 8; num_srcs++) {
+                std::vector<Reg> srcs;
+                for (uint32_t i = 0; i < num_srcs; i++)
+                    srcs.push_back(randomReg(gen, bytes));
+                const Reg old = randomReg(gen, bytes);
+
+                for (uint32_t field = 0; field < num_srcs; field++) {
+                    Reg expected(old), actual(old);
+                    scalarInterleave(expected, srcs, elems_per_vreg, field,
+                            elem_size);
+                    for (uint32_t i = 0; i < num_srcs; i++) {
+                        RiscvISA::segInterleave(actual.data(),
+                                srcs[i].data(), i, num_srcs,
+                                elems_per_vreg, field, elem_size);
+                    }
+                    EXPECT_EQ(expected, actual)
+                        << "elem_size " << elem_size
+                        << ", elems " << elems_per_vreg
+                        << ", fields " << num_srcs
+                        << ", field " << field;
+                }
+            }
+        }
+    }
+}
+
+/** Deinterleaving the interleaved registers gives the sources back */
+TEST(VectorSegTest, RoundTrip)
+{
+    std::mt19937 gen(3);
+    const uint32_t elems_per_vreg = 16;
+    for (uint32_t elem_size : {1, 2, 4, 8}) {
+        const size_t bytes = elems_per_vreg * elem_size;
+        for (uint32_t num_srcs = 2; num_srcs <= 8; num_srcs++) {
+            std::vector<Reg> fields, segs(num_srcs, Reg(bytes));
+            for (uint32_t i = 0; i < num_srcs; i++)
+                fields.push_back(randomReg(gen, bytes));
+            for (uint32_t f = 0; f < num_srcs; f++) {
+                for (uint32_t i = 0; i < num_srcs; i++) {
+                    RiscvISA::segInterleave(segs[f].data(),
+                            fields[i].data(), i, num_srcs, elems_per_vreg,
+                            f, elem_size);
+                }
+            }
+            for (uint32_t f = 0; f < num_srcs; f++) {
+                Reg actual(bytes);
+                for (uint32_t i = 0; i < num_srcs; i++) {
+                    RiscvISA::segDeinterleave(actual.data(),
+                            segs[i].data(), i, num_srcs, elems_per_vreg,
+                            f, elem_size);
+                }
+                EXPECT_EQ(fields[f], actual);
+            }
+        }
+    }
+}
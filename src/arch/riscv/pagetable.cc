@@ -46,7 +46,6 @@ TlbEntry::serialize(CheckpointOut &cp) const
     SERIALIZE_SCALAR(logBytes);
     SERIALIZE_SCALAR(asid);
     SERIALIZE_SCALAR(pte);
-    SERIALIZE_SCALAR(lruSeq);
 }
 
 void
@@ -57,7 +56,6 @@ TlbEntry::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(logBytes);
     UNSERIALIZE_SCALAR(asid);
     UNSERIALIZE_SCALAR(pte);
-    UNSERIALIZE_SCALAR(lruSeq);
 }
 
 Addr
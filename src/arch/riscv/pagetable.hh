@@ -31,9 +31,9 @@
 #ifndef __ARCH_RISCV_PAGETABLE_H__
 #define __ARCH_RISCV_PAGETABLE_H__
 
+#include "arch/generic/page_tlb.hh"
 #include "base/bitunion.hh"
 #include "base/logging.hh"
-#include "base/trie.hh"
 #include "base/types.hh"
 #include "sim/serialize.hh"
 
@@ -88,10 +88,7 @@ EndBitUnion(PTESv39)
  */
 Addr getVPNFromVAddr(Addr vaddr, Addr mode);
 
-struct TlbEntry;
-typedef Trie<Addr, TlbEntry> TlbEntryTrie;
-
-struct TlbEntry : public Serializable
+struct TlbEntry : public PageTLBEntry, public Serializable
 {
     // The base of the physical page.
     Addr paddr;
@@ -107,13 +104,8 @@ struct TlbEntry : public Serializable
 
     PTESv39 gpte;
 
-    TlbEntryTrie::Handle trieHandle;
-
-    // A sequence number to keep track of LRU.
-    uint64_t lruSeq;
-
     TlbEntry()
-        : paddr(0), vaddr(0), logBytes(0), pte(), gpte(), lruSeq(0)
+        : paddr(0), vaddr(0), logBytes(0), pte(), gpte()
     {}
 
     // Return the page size in bytes
@@ -124,7 +116,7 @@ struct TlbEntry : public Serializable
 
     void reset()
     {
-        paddr = vaddr = logBytes = pte = gpte = lruSeq = 0;
+        paddr = vaddr = logBytes = pte = gpte = 0;
     }
 
     void serialize(CheckpointOut &cp) const override;
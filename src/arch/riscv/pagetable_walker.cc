@@ -164,6 +164,46 @@ Walker::recvReqRetry()
     }
 }
 
+void
+Walker::sendPWCResponse(WalkerState *sendingState, PacketPtr pkt)
+{
+    pkt->pushSenderState(new WalkerSenderState(sendingState));
+    pkt->makeResponse();
+    // The walker state may still be stepping through the previous
+    // response, so deliver this one from an event like the port would.
+    auto *event = new EventFunctionWrapper(
+        [this, pkt]{ recvTimingResp(pkt); }, name() + ".pwcResponse",
+        true);
+    schedule(event, clockEdge(pwcLatency));
+}
+
+bool
+Walker::pwcLookup(PacketPtr pkt, int level)
+{
+    // Leaf entries are never cached, don't count them as misses.
+    if (!enablePWC || level == 0)
+        return false;
+
+    uint64_t pte;
+    if (!pwc.lookup(pkt->getAddr(), pte)) {
+        pagewalkerstats.num_pwc_misses++;
+        return false;
+    }
+
+    DPRINTF(PageTableWalker, "Page walk cache hit for %#x: %#x\n",
+            pkt->getAddr(), pte);
+    pagewalkerstats.num_pwc_hits++;
+    pkt->setLE<uint64_t>(pte);
+    return true;
+}
+
+void
+Walker::pwcInsert(PacketPtr pkt, uint64_t pte)
+{
+    if (enablePWC)
+        pwc.insert(pkt->getAddr(), pte);
+}
+
 bool Walker::sendTiming(WalkerState* sendingState, PacketPtr pkt)
 {
     WalkerSenderState* walker_state = new WalkerSenderState(sendingState);
@@ -264,6 +304,7 @@ Walker::startWalkWrapper()
                 std::make_shared<UnimpFault>("Squashed Inst"),
                 currState->req, currState->tc, currState->mode);
         } else {
+            pagewalkerstats.num_coalesced_walks++;
             tlb->translateTiming(currState->req, currState->tc,
                                  currState->translation, currState->mode);
         }
@@ -395,6 +436,8 @@ Walker::WalkerState::walk()
     started = true;
     state = Translate;
     nextState = Ready;
+    if (!functional)
+        walker->pagewalkerstats.num_walks++;
 
     // This is the vaddr to walk for
     Addr vaddr = entry.vaddr;
@@ -462,7 +505,7 @@ Walker::WalkerState::walkOneStage(Addr vaddr)
             walker->port.sendFunctional(read);
         }
         else {
-            walker->port.sendAtomic(read);
+            sendAtomicRead();
         }
 
         PacketPtr write = NULL;
@@ -546,7 +589,7 @@ Walker::WalkerState::walkTwoStage(Addr vaddr)
         if (functional) {
             walker->port.sendFunctional(read);
         } else {
-            walker->port.sendAtomic(read);
+            sendAtomicRead();
         }
 
         PacketPtr write = NULL;
@@ -818,6 +861,11 @@ Walker::WalkerState::stepWalk(PacketPtr &write)
                 idx = (entry.vaddr >> shift) & mask(SV39_LEVEL_BITS);
                 nextRead = (pte.ppn << PageShift) + (idx * sizeof(pte));
                 nextState = Translate;
+
+                // Only single stage walks read the table directly, the
+                // others go through G-stage first for every level.
+                if (!functional && walkType == OneStage)
+                    walker->pwcInsert(read, pte);
             }
         }
     } else {
@@ -1089,6 +1137,8 @@ Walker::WalkerState::recvPacket(PacketPtr pkt)
 
         // @todo someone should pay for this
         pkt->headerDelay = pkt->payloadDelay = 0;
+        walker->pagewalkerstats.level_latency[level] +=
+            curTick() - readIssued;
 
         state = nextState;
         nextState = Ready;
@@ -1157,12 +1207,16 @@ Walker::WalkerState::sendPackets()
         PacketPtr pkt = read;
         read = NULL;
         inflight++;
-        if (!walker->sendTiming(this, pkt)) {
+        readIssued = curTick();
+        if (walkType == OneStage && walker->pwcLookup(pkt, level)) {
+            walker->sendPWCResponse(this, pkt);
+        } else if (!walker->sendTiming(this, pkt)) {
             retrying = true;
             read = pkt;
             inflight--;
             return;
         }
+        walker->pagewalkerstats.level_reads[level]++;
     }
     //Send off as many of the writes as we can.
     while (writes.size()) {
@@ -1178,6 +1232,19 @@ Walker::WalkerState::sendPackets()
     }
 }
 
+void
+Walker::WalkerState::sendAtomicRead()
+{
+    walker->pagewalkerstats.level_reads[level]++;
+    if (walkType == OneStage && walker->pwcLookup(read, level)) {
+        walker->pagewalkerstats.level_latency[level] +=
+            walker->cyclesToTicks(walker->pwcLatency);
+    } else {
+        walker->pagewalkerstats.level_latency[level] +=
+            walker->port.sendAtomic(read);
+    }
+}
+
 PacketPtr
 Walker::WalkerState::createReqPacket(Addr paddr, MemCmd cmd, size_t bytes)
 {
@@ -1240,8 +1307,26 @@ Walker::PagewalkerStats::PagewalkerStats(statistics::Group *parent)
     ADD_STAT(num_64kb_walks, statistics::units::Count::get(),
              "Completed page walks with 64KB pages"),
     ADD_STAT(num_2mb_walks, statistics::units::Count::get(),
-             "Completed page walks with 2MB pages")
+             "Completed page walks with 2MB pages"),
+    ADD_STAT(num_walks, statistics::units::Count::get(),
+             "Page walks started"),
+    ADD_STAT(num_coalesced_walks, statistics::units::Count::get(),
+             "Queued page walks satisfied by the TLB instead"),
+    ADD_STAT(num_pwc_hits, statistics::units::Count::get(),
+             "Non-leaf PTE reads that hit in the page walk cache"),
+    ADD_STAT(num_pwc_misses, statistics::units::Count::get(),
+             "Non-leaf PTE reads that missed in the page walk cache"),
+    ADD_STAT(level_reads, statistics::units::Count::get(),
+             "PTE reads per level"),
+    ADD_STAT(level_latency, statistics::units::Tick::get(),
+             "Total latency of PTE reads per level"),
+    ADD_STAT(avg_level_latency, statistics::units::Rate<
+                statistics::units::Tick, statistics::units::Count>::get(),
+             "Average latency of PTE reads per level",
+             level_latency / level_reads)
 {
+    level_reads.init(SV39_LEVELS);
+    level_latency.init(SV39_LEVELS);
 }
 
 } // namespace RiscvISA
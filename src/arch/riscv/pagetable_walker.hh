@@ -42,6 +42,7 @@
 #include <vector>
 
 #include "arch/generic/mmu.hh"
+#include "arch/generic/page_walk_cache.hh"
 #include "arch/riscv/pagetable.hh"
 #include "arch/riscv/pma_checker.hh"
 #include "arch/riscv/pmp.hh"
@@ -140,6 +141,8 @@ namespace RiscvISA
             bool retrying;
             bool started;
             bool squashed;
+            // Issue tick of the read in flight, for the stats
+            Tick readIssued;
           public:
             WalkerState(Walker * _walker, BaseMMU::Translation *_translation,
                         const RequestPtr &_req, bool _isFunctional = false) :
@@ -147,7 +150,8 @@ namespace RiscvISA
                 nextState(Ready), level(0), glevel(0), inflight(0),
                 translation(_translation),
                 functional(_isFunctional), timing(false),
-                retrying(false), started(false), squashed(false)
+                retrying(false), started(false), squashed(false),
+                readIssued(0)
             {
             }
             void initState(ThreadContext * _tc, BaseMMU::Mode _mode,
@@ -174,6 +178,7 @@ namespace RiscvISA
             Fault walkOneStage(Addr vaddr);
             Fault walkTwoStage(Addr vaddr);
             void sendPackets();
+            void sendAtomicRead();
             void endWalk();
             Fault pageFault();
             Fault guestToHostPage(Addr vaddr);
@@ -228,6 +233,28 @@ namespace RiscvISA
         void recvReqRetry();
         bool sendTiming(WalkerState * sendingState, PacketPtr pkt);
 
+        // Whether page walk cache is in use, and its access latency.
+        const bool enablePWC;
+        const Cycles pwcLatency;
+
+        // Non-leaf page table entries read by previous walks.
+        PageWalkCache pwc;
+
+        /**
+         * Fill a read of a non-leaf entry from the page walk cache.
+         *
+         * @param pkt Read of the page table entry.
+         * @param level Level of the entry, 0 being the leaf level.
+         * @return True if the packet data was filled in.
+         */
+        bool pwcLookup(PacketPtr pkt, int level);
+
+        // Remember a non-leaf entry read from memory.
+        void pwcInsert(PacketPtr pkt, uint64_t pte);
+
+        // Respond to a timing read which hit in the page walk cache.
+        void sendPWCResponse(WalkerState *sendingState, PacketPtr pkt);
+
         struct PagewalkerStats : public statistics::Group
         {
             PagewalkerStats(statistics::Group *parent);
@@ -236,11 +263,23 @@ namespace RiscvISA
             statistics::Scalar num_64kb_walks;
             statistics::Scalar num_2mb_walks;
 
+            statistics::Scalar num_walks;
+            statistics::Scalar num_coalesced_walks;
+            statistics::Scalar num_pwc_hits;
+            statistics::Scalar num_pwc_misses;
+            statistics::Vector level_reads;
+            statistics::Vector level_latency;
+            statistics::Formula avg_level_latency;
+
         } pagewalkerstats;
 
 
       public:
 
+        // Drop all cached page table entries. Called whenever the TLB
+        // is flushed, since a page table update is not snooped.
+        void invalidatePWC() { pwc.clear(); }
+
         void setTLB(TLB * _tlb)
         {
             tlb = _tlb;
@@ -256,6 +295,9 @@ namespace RiscvISA
             requestorId(sys->getRequestorId(this)),
             numSquashable(params.num_squash_per_cycle),
             startWalkWrapperEvent([this]{ startWalkWrapper(); }, name()),
+            enablePWC(params.enable_pwc), pwcLatency(params.pwc_latency),
+            pwc(name() + ".pwc", params.pwc_size, params.pwc_assoc,
+                params.pwc_replacement_policy, params.pwc_indexing_policy),
             pagewalkerstats(this)
         {
         }
@@ -232,7 +232,7 @@ RemoteGDB::acc(Addr va, size_t len)
         return true;
     }
 
-    return context()->getProcessPtr()->pTable->lookup(va) != nullptr;
+    return context()->getProcessPtr()->pTable->lookup(va).has_value();
 }
 
 void
@@ -65,28 +65,13 @@ using namespace RiscvISA;
 //  RISC-V TLB
 //
 
-static Addr
-buildKey(Addr vpn, uint16_t asid)
-{
-    // Note ASID is 16 bits
-    // The VPN in sv39 is up to 39-12=27 bits
-    // The VPN in sv48 is up to 48-12=36 bits
-    // The VPN in sv57 is up to 57-12=45 bits
-    // So, shifting the ASID into the top 16 bits is safe.
-    assert(bits(vpn, 63, 48) == 0);
-    return (static_cast<Addr>(asid) << 48) | vpn;
-}
-
 TLB::TLB(const Params &p) :
-    BaseTLB(p), size(p.size), tlb(size),
-    lruSeq(0), stats(this), pma(p.pma_checker),
+    BaseTLB(p), size(p.size),
+    tlb(name() + ".tlb", size, p.assoc, p.replacement_policy,
+        p.indexing_policy),
+    stats(this), pma(p.pma_checker),
     pmp(p.pmp)
 {
-    for (size_t x = 0; x < size; x++) {
-        tlb[x].trieHandle = NULL;
-        freeList.push_back(&tlb[x]);
-    }
-
     walker = p.walker;
     walker->setTLB(this);
 }
@@ -97,36 +82,20 @@ TLB::getWalker()
     return walker;
 }
 
-void
-TLB::evictLRU()
-{
-    // Find the entry with the lowest (and hence least recently updated)
-    // sequence number.
-
-    size_t lru = 0;
-    for (size_t i = 1; i < size; i++) {
-        if (tlb[i].lruSeq < tlb[lru].lruSeq)
-            lru = i;
-    }
-
-    remove(lru);
-}
-
 TlbEntry *
 TLB::lookup(Addr vpn, uint16_t asid, BaseMMU::Mode mode, bool hidden)
 {
-    TlbEntry *entry = trie.lookup(buildKey(vpn, asid));
+    // The VPN is in units of the smallest page size, the TLB looks up
+    // every page size it holds.
+    TlbEntry *entry = tlb.lookup(vpn << PageShift, asid, !hidden);
 
-    DPRINTF(TLBVerbose, "lookup(vpn=%#x, asid=%#x, key=%#x): "
+    DPRINTF(TLBVerbose, "lookup(vpn=%#x, asid=%#x): "
                         "%s ppn=%#x (%#x) %s\n",
-            vpn, asid, buildKey(vpn, asid), entry ? "hit" : "miss",
+            vpn, asid, entry ? "hit" : "miss",
             entry ? entry->paddr : 0, entry ? entry->size() : 0,
             hidden ? "hidden" : "");
 
     if (!hidden) {
-        if (entry)
-            entry->lruSeq = nextSeq();
-
         if (mode == BaseMMU::Write)
             stats.writeAccesses++;
         else
@@ -152,10 +121,9 @@ TLB::lookup(Addr vpn, uint16_t asid, BaseMMU::Mode mode, bool hidden)
 TlbEntry *
 TLB::insert(Addr vpn, const TlbEntry &entry)
 {
-    DPRINTF(TLB, "insert(vpn=%#x, asid=%#x, key=%#x): "
+    DPRINTF(TLB, "insert(vpn=%#x, asid=%#x): "
                  "vaddr=%#x paddr=%#x pte=%#x size=%#x\n",
-        vpn, entry.asid, buildKey(vpn, entry.asid), entry.vaddr, entry.paddr,
-        entry.pte, entry.size());
+        vpn, entry.asid, entry.vaddr, entry.paddr, entry.pte, entry.size());
 
     // If somebody beat us to it, just use that existing entry.
     TlbEntry *newEntry = lookup(vpn, entry.asid, BaseMMU::Read, true);
@@ -168,19 +136,7 @@ TLB::insert(Addr vpn, const TlbEntry &entry)
         return newEntry;
     }
 
-    if (freeList.empty())
-        evictLRU();
-
-    newEntry = freeList.front();
-    freeList.pop_front();
-
-    Addr key = buildKey(vpn, entry.asid);
-    *newEntry = entry;
-    newEntry->lruSeq = nextSeq();
-    newEntry->trieHandle = trie.insert(
-        key, TlbEntryTrie::MaxBits - entry.logBytes + PageShift, newEntry
-    );
-    return newEntry;
+    return tlb.insert(vpn << PageShift, entry.asid, false, entry);
 }
 
 void
@@ -204,21 +160,24 @@ TLB::demapPage(Addr vaddr, uint64_t asid)
         DPRINTF(TLB, "Flushing all TLB entries\n");
         flushAll();
     } else {
+        // Entries of the page walk cache aren't tagged with an address
+        // space or the addresses they map, so drop all of them.
+        walker->invalidatePWC();
         if (vaddr != 0 && asid != 0) {
             // TODO: When supporting other address translation modes, fix this
             Addr vpn = getVPNFromVAddr(vaddr, AddrXlateMode::SV39);
             TlbEntry *entry = lookup(vpn, asid, BaseMMU::Read, true);
             if (entry) {
-                remove(entry - tlb.data());
+                remove(entry);
             }
         }
         else {
-            for (size_t i = 0; i < size; i++) {
-                if (tlb[i].trieHandle) {
-                    Addr mask = ~(tlb[i].size() - 1);
-                    if ((vaddr == 0 || (vaddr & mask) == tlb[i].vaddr) &&
-                        (asid == 0 || tlb[i].asid == asid))
-                        remove(i);
+            for (auto &entry : tlb) {
+                if (entry.isValid()) {
+                    Addr mask = ~(entry.size() - 1);
+                    if ((vaddr == 0 || (vaddr & mask) == entry.vaddr) &&
+                        (asid == 0 || entry.asid == asid))
+                        remove(&entry);
                 }
             }
         }
@@ -229,23 +188,19 @@ void
 TLB::flushAll()
 {
     DPRINTF(TLB, "flushAll()\n");
-    for (size_t i = 0; i < size; i++) {
-        if (tlb[i].trieHandle)
-            remove(i);
-    }
+    walker->invalidatePWC();
+    tlb.flush();
 }
 
 void
-TLB::remove(size_t idx)
+TLB::remove(TlbEntry *entry)
 {
     DPRINTF(TLB, "remove(vpn=%#x, asid=%#x): ppn=%#x pte=%#x size=%#x\n",
-        tlb[idx].vaddr, tlb[idx].asid, tlb[idx].paddr, tlb[idx].pte,
-        tlb[idx].size());
+        entry->vaddr, entry->asid, entry->paddr, entry->pte,
+        entry->size());
 
-    assert(tlb[idx].trieHandle);
-    trie.remove(tlb[idx].trieHandle);
-    tlb[idx].trieHandle = NULL;
-    freeList.push_back(&tlb[idx]);
+    assert(entry->isValid());
+    tlb.invalidate(entry);
 }
 
 Fault
@@ -657,7 +612,7 @@ TLB::translateFunctional(const RequestPtr &req, ThreadContext *tc,
     }
     else {
         Process *process = tc->getProcessPtr();
-        const auto *pte = process->pTable->lookup(vaddr);
+        auto pte = process->pTable->lookup(vaddr);
 
         if (!pte && mode != BaseMMU::Execute) {
             // Check if we just need to grow the stack.
@@ -689,14 +644,13 @@ void
 TLB::serialize(CheckpointOut &cp) const
 {
     // Only store the entries in use.
-    uint32_t _size = size - freeList.size();
+    uint32_t _size = tlb.occupancy();
     SERIALIZE_SCALAR(_size);
-    SERIALIZE_SCALAR(lruSeq);
 
     uint32_t _count = 0;
-    for (uint32_t x = 0; x < size; x++) {
-        if (tlb[x].trieHandle != NULL)
-            tlb[x].serializeSection(cp, csprintf("Entry%d", _count++));
+    for (const auto &entry : tlb) {
+        if (entry.isValid())
+            entry.serializeSection(cp, csprintf("Entry%d", _count++));
     }
 }
 
@@ -710,18 +664,12 @@ TLB::unserialize(CheckpointIn &cp)
         fatal("TLB size less than the one in checkpoint!");
     }
 
-    UNSERIALIZE_SCALAR(lruSeq);
-
     for (uint32_t x = 0; x < _size; x++) {
-        TlbEntry *newEntry = freeList.front();
-        freeList.pop_front();
-
-        newEntry->unserializeSection(cp, csprintf("Entry%d", x));
+        TlbEntry entry;
+        entry.unserializeSection(cp, csprintf("Entry%d", x));
         // TODO: When supporting other addressing modes fix this
-        Addr vpn = getVPNFromVAddr(newEntry->vaddr, AddrXlateMode::SV39);
-        Addr key = buildKey(vpn, newEntry->asid);
-        newEntry->trieHandle = trie.insert(key,
-            TlbEntryTrie::MaxBits - newEntry->logBytes + PageShift, newEntry);
+        Addr vpn = getVPNFromVAddr(entry.vaddr, AddrXlateMode::SV39);
+        tlb.insert(vpn << PageShift, entry.asid, false, entry);
     }
 }
 
@@ -32,8 +32,7 @@
 #ifndef __ARCH_RISCV_TLB_HH__
 #define __ARCH_RISCV_TLB_HH__
 
-#include <list>
-
+#include "arch/generic/page_tlb.hh"
 #include "arch/generic/tlb.hh"
 #include "arch/riscv/isa.hh"
 #include "arch/riscv/pagetable.hh"
@@ -85,14 +84,9 @@ class Walker;
 
 class TLB : public BaseTLB
 {
-    typedef std::list<TlbEntry *> EntryList;
-
   protected:
     size_t size;
-    std::vector<TlbEntry> tlb;  // our TLB
-    TlbEntryTrie trie;          // for quick access
-    EntryList freeList;         // free entries
-    uint64_t lruSeq;
+    PageTLB<TlbEntry> tlb;      // our TLB
 
     Walker *walker;
 
@@ -204,10 +198,7 @@ class TLB : public BaseTLB
     TlbEntry *lookup(Addr vpn, uint16_t asid, BaseMMU::Mode mode, bool hidden);
 
   private:
-    uint64_t nextSeq() { return ++lruSeq; }
-
-    void evictLRU();
-    void remove(size_t idx);
+    void remove(TlbEntry *entry);
 
     Fault translate(const RequestPtr &req, ThreadContext *tc,
                     BaseMMU::Translation *translation, BaseMMU::Mode mode,
@@ -33,8 +33,14 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
-from m5.objects.BaseTLB import BaseTLB
+from m5.objects.BaseTLB import (
+    BaseTLB,
+    PageTLBIndexingPolicy,
+    PageTLBSetAssociative,
+)
 from m5.objects.ClockedObject import ClockedObject
+from m5.objects.IndexingPolicies import *
+from m5.objects.ReplacementPolicies import *
 from m5.params import *
 from m5.proxy import *
 
@@ -49,6 +55,29 @@ class X86PagetableWalker(ClockedObject):
     num_squash_per_cycle = Param.Unsigned(
         4, "Number of outstanding walks that can be squashed per cycle"
     )
+    coalesce_walks = Param.Bool(
+        False,
+        "Satisfy queued walks from the TLB if an earlier walk already "
+        "filled in their page",
+    )
+
+    enable_pwc = Param.Bool(
+        False, "Cache upper level page table entries in the walker"
+    )
+    pwc_size = Param.Unsigned(32, "Number of page walk cache entries")
+    pwc_assoc = Param.Unsigned(4, "Page walk cache associativity")
+    pwc_latency = Param.Cycles(1, "Page walk cache access latency")
+    pwc_replacement_policy = Param.BaseReplacementPolicy(
+        LRURP(), "Page walk cache replacement policy"
+    )
+    pwc_indexing_policy = Param.BaseIndexingPolicy(
+        SetAssociative(
+            size=Parent.pwc_size * 8,
+            assoc=Parent.pwc_assoc,
+            entry_size=8,
+        ),
+        "Page walk cache indexing policy",
+    )
 
 
 class X86TLB(BaseTLB):
@@ -57,6 +86,16 @@ class X86TLB(BaseTLB):
     cxx_header = "arch/x86/tlb.hh"
 
     size = Param.Unsigned(64, "TLB size")
+    assoc = Param.Unsigned(
+        Self.size, "Associativity of the TLB. Fully Associative by default"
+    )
+    indexing_policy = Param.PageTLBIndexingPolicy(
+        PageTLBSetAssociative(assoc=Parent.assoc, num_entries=Parent.size),
+        "Indexing policy of the TLB",
+    )
+    replacement_policy = Param.BaseReplacementPolicy(
+        LRURP(), "Replacement policy of the TLB"
+    )
     system = Param.System(Parent.any, "system object")
     walker = Param.X86PagetableWalker(
         X86PagetableWalker(), "page table walker"
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "arch/x86/insts/macroop.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arch/generic/mmu.hh"
+#include "arch/x86/ldstflags.hh"
+#include "arch/x86/page_size.hh"
+#include "arch/x86/regs/int.hh"
+#include "arch/x86/regs/misc.hh"
+#include "arch/x86/utility.hh"
+#include "base/chunk_generator.hh"
+#include "base/intmath.hh"
+#include "cpu/base.hh"
+#include "cpu/thread_context.hh"
+#include "mem/physical.hh"
+#include "mem/request.hh"
+#include "sim/faults.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+namespace X86ISA
+{
+
+namespace
+{
+
+using HostRanges = std::vector<std::pair<uint8_t *, Addr>>;
+
+/**
+ * Translate the bytes at an offset into a segment to host memory, the
+ * same way the loads and stores of the microcode would, stopping at the
+ * first page which can't be accessed directly.
+ *
+ * @return The number of bytes translated.
+ */
+Addr
+translateToHost(ThreadContext *tc, int seg, int addr_size, Addr offset,
+        Addr size, BaseMMU::Mode mode, HostRanges &host)
+{
+    const Addr base = tc->readMiscRegNoEffect(misc_reg::segEffBase(seg));
+    const Request::Flags flags =
+        seg | (floorLog2(addr_size) << AddrSizeFlagShift);
+    const memory::PhysicalMemory &physmem =
+        tc->getSystemPtr()->getPhysMem();
+    BaseMMU *mmu = tc->getMMUPtr();
+    auto req = std::make_shared<Request>();
+
+    Addr done = 0;
+    for (ChunkGenerator gen(base + offset, size, PageBytes); !gen.done();
+            gen.next()) {
+        req->setVirt(gen.addr(), gen.size(), flags,
+                tc->getCpuPtr()->dataRequestorId(),
+                tc->pcState().instAddr());
+        if (mmu->translateAtomic(req, tc, mode) != NoFault ||
+                req->isUncacheable() || req->isLocalAccess()) {
+            break;
+        }
+        uint8_t *ptr = physmem.toHostAddr(req->getPaddr(), gen.size());
+        if (!ptr)
+            break;
+        host.emplace_back(ptr, gen.size());
+        done += gen.size();
+    }
+    return done;
+}
+
+void
+readHost(uint8_t *buf, const HostRanges &host)
+{
+    for (const auto &[ptr, size] : host) {
+        std::memcpy(buf, ptr, size);
+        buf += size;
+    }
+}
+
+void
+writeHost(const HostRanges &host, const uint8_t *buf)
+{
+    for (const auto &[ptr, size] : host) {
+        std::memcpy(ptr, buf, size);
+        buf += size;
+    }
+}
+
+} // anonymous namespace
+
+MacroopBase::RepString
+MacroopBase::decodeRepString(const ExtMachInst &emi)
+{
+    if (emi.opcode.type != OneByteOpcode)
+        return RepString::None;
+
+    // The microcode only repeats MOVS and STOS with a REP prefix, and
+    // REP takes precedence over REPNE for the comparisons.
+    switch (emi.opcode.op & 0xfe) {
+      case 0xa4:
+        return emi.legacy.rep ? RepString::Movs : RepString::None;
+      case 0xaa:
+        return emi.legacy.rep ? RepString::Stos : RepString::None;
+      case 0xa6:
+      case 0xae:
+        if (emi.legacy.rep)
+            return RepString::Repe;
+        return emi.legacy.repne ? RepString::Repne : RepString::None;
+      default:
+        return RepString::None;
+    }
+}
+
+Fault
+MacroopBase::executeBulk(ThreadContext *tc) const
+{
+    // Host memory is only coherent with what the CPU sees when there
+    // are no caches in the way. Going backwards is rare enough to be
+    // left to the microcode.
+    if (repString == RepString::None ||
+            !tc->getSystemPtr()->bypassCaches() ||
+            (getRFlags(tc) & DFBit)) {
+        return NoFault;
+    }
+
+    const int addr_size = machInst.addrSize;
+    const int data_size = (machInst.opcode.op & 0x1) ? machInst.opSize : 1;
+    const bool uses_src = repString != RepString::Stos && !repScas;
+
+    const RegVal rcx = tc->getReg(int_reg::Rcx);
+    const RegVal rsi = tc->getReg(int_reg::Rsi);
+    const RegVal rdi = tc->getReg(int_reg::Rdi);
+    const uint64_t count = pick(rcx, 0, addr_size);
+    const Addr src = pick(rsi, 0, addr_size);
+    const Addr dst = pick(rdi, 0, addr_size);
+
+    if (count < 2)
+        return NoFault;
+
+    // Leave the last iteration to the microcode, and don't let the
+    // offsets wrap around.
+    uint64_t iters = std::min<uint64_t>(count - 1, PageBytes / data_size);
+    if (addr_size < 8) {
+        const Addr limit = mask(addr_size * 8);
+        iters = std::min<uint64_t>(iters, (limit - dst + 1) / data_size);
+        if (uses_src)
+            iters = std::min<uint64_t>(iters, (limit - src + 1) / data_size);
+    }
+
+    // A forward copy to just above its source replicates the data it
+    // already copied, so only copy what precedes the destination.
+    if (repString == RepString::Movs) {
+        const Addr src_base =
+            tc->readMiscRegNoEffect(misc_reg::segEffBase(env.seg));
+        const Addr es_base =
+            tc->readMiscRegNoEffect(misc_reg::segEffBase(segment_idx::Es));
+        const Addr distance = (es_base + dst) - (src_base + src);
+        if (distance && distance < iters * data_size)
+            iters = distance / data_size;
+    }
+
+    HostRanges dst_host, src_host;
+    Addr bytes = iters * data_size;
+    bytes = translateToHost(tc, segment_idx::Es, addr_size, dst, bytes,
+            repString == RepString::Movs || repString == RepString::Stos ?
+            BaseMMU::Write : BaseMMU::Read, dst_host);
+    if (uses_src) {
+        bytes = std::min(bytes, translateToHost(tc, env.seg, addr_size,
+                    src, bytes, BaseMMU::Read, src_host));
+    }
+    iters = bytes / data_size;
+    bytes = iters * data_size;
+    if (!iters)
+        return NoFault;
+
+    auto trim = [bytes](HostRanges &host) {
+        Addr left = bytes;
+        for (auto it = host.begin(); it != host.end(); ++it) {
+            if (left <= it->second) {
+                it->second = left;
+                host.erase(std::next(it), host.end());
+                return;
+            }
+            left -= it->second;
+        }
+    };
+    trim(dst_host);
+    trim(src_host);
+
+    uint8_t buf[PageBytes];
+    bool done = false;
+    switch (repString) {
+      case RepString::Movs:
+        readHost(buf, src_host);
+        writeHost(dst_host, buf);
+        break;
+      case RepString::Stos:
+        {
+            const RegVal rax = tc->getReg(int_reg::Rax);
+            if (data_size == 1) {
+                std::memset(buf, rax, bytes);
+            } else {
+                for (Addr i = 0; i < bytes; i += data_size)
+                    std::memcpy(buf + i, &rax, data_size);
+            }
+            writeHost(dst_host, buf);
+        }
+        break;
+      case RepString::Repe:
+      case RepString::Repne:
+        {
+            // Stop before the element which ends the loop, the microcode
+            // does that one to set the flags.
+            uint8_t other[PageBytes];
+            readHost(buf, dst_host);
+            if (repScas) {
+                const RegVal rax = tc->getReg(int_reg::Rax);
+                for (Addr i = 0; i < bytes; i += data_size)
+                    std::memcpy(other + i, &rax, data_size);
+            } else {
+                readHost(other, src_host);
+            }
+            const bool equal = repString == RepString::Repe;
+            uint64_t i = 0;
+            while (i < iters && (std::memcmp(buf + i * data_size,
+                            other + i * data_size, data_size) == 0) ==
+                    equal) {
+                ++i;
+            }
+            done = i < iters;
+            iters = i;
+            if (!iters)
+                return NoFault;
+        }
+        break;
+      default:
+        panic("Unexpected repeated string instruction.");
+    }
+
+    const Addr advance = iters * data_size;
+    tc->setReg(int_reg::Rcx, merge(rcx, 0, count - iters, addr_size));
+    tc->setReg(int_reg::Rdi, merge(rdi, 0, dst + advance, addr_size));
+    if (uses_src)
+        tc->setReg(int_reg::Rsi, merge(rsi, 0, src + advance, addr_size));
+
+    // Restart the instruction for the next chunk, so interrupts can be
+    // taken in between like on real hardware.
+    if (!done && count - iters > 1)
+        return std::make_shared<ReExec>();
+    return NoFault;
+}
+
+} // namespace X86ISA
+} // namespace gem5
@@ -57,11 +57,30 @@ class MacroopBase : public X86StaticInst
     const uint32_t numMicroops;
     X86ISA::EmulEnv env;
 
+    /** Repeated string instructions which can be executed in bulk */
+    enum class RepString
+    {
+        None,
+        Movs,
+        Stos,
+        Repe,
+        Repne
+    };
+
+    /** How the repeat prefix applies to this instruction */
+    const RepString repString;
+    /** Whether the string instruction compares with rAX, i.e. is SCAS */
+    const bool repScas;
+
+    static RepString decodeRepString(const ExtMachInst &emi);
+
     //Constructor.
     MacroopBase(const char *mnem, ExtMachInst _machInst,
             uint32_t _numMicroops, X86ISA::EmulEnv _env) :
                 X86StaticInst(mnem, _machInst, No_OpClass),
-                numMicroops(_numMicroops), env(_env)
+                numMicroops(_numMicroops), env(_env),
+                repString(decodeRepString(_machInst)),
+                repScas((_machInst.opcode.op & 0xfe) == 0xae)
     {
         assert(numMicroops);
         microops = new StaticInstPtr[numMicroops];
@@ -92,6 +111,14 @@ class MacroopBase : public X86StaticInst
     }
 
   public:
+    /**
+     * Do up to a page of the iterations of a REP MOVS, STOS, CMPS or
+     * SCAS directly on host memory. The last iteration is always left to
+     * the microcode, so it produces the final flags and moves on to the
+     * next instruction.
+     */
+    Fault executeBulk(ThreadContext *tc) const override;
+
     ExtMachInst
     getExtMachInst()
     {
@@ -51,7 +51,7 @@ namespace X86ISA
 TlbEntry::TlbEntry()
     : paddr(0), vaddr(0), logBytes(0), writable(0),
       user(true), uncacheable(0), global(false), patBit(0),
-      noExec(false), lruSeq(0)
+      noExec(false), pcid(0)
 {
 }
 
@@ -59,7 +59,7 @@ TlbEntry::TlbEntry(Addr asn, Addr _vaddr, Addr _paddr,
                    bool uncacheable, bool read_only) :
     paddr(_paddr), vaddr(_vaddr), logBytes(PageShift), writable(!read_only),
     user(true), uncacheable(uncacheable), global(false), patBit(0),
-    noExec(false), lruSeq(0)
+    noExec(false), pcid(0)
 {}
 
 void
@@ -74,7 +74,7 @@ TlbEntry::serialize(CheckpointOut &cp) const
     SERIALIZE_SCALAR(global);
     SERIALIZE_SCALAR(patBit);
     SERIALIZE_SCALAR(noExec);
-    SERIALIZE_SCALAR(lruSeq);
+    SERIALIZE_SCALAR(pcid);
 }
 
 void
@@ -89,7 +89,12 @@ TlbEntry::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(global);
     UNSERIALIZE_SCALAR(patBit);
     UNSERIALIZE_SCALAR(noExec);
-    UNSERIALIZE_SCALAR(lruSeq);
+    if (!UNSERIALIZE_OPT_SCALAR(pcid)) {
+        // Older checkpoints ORed the PCID into the low bits of the
+        // page address.
+        pcid = bits(vaddr, 11, 0);
+        vaddr = insertBits(vaddr, 11, 0, 0);
+    }
 }
 
 } // namespace X86ISA
@@ -41,10 +41,10 @@
 
 #include <cstdint>
 
+#include "arch/generic/page_tlb.hh"
 #include "arch/x86/page_size.hh"
 #include "base/bitunion.hh"
 #include "base/types.hh"
-#include "base/trie.hh"
 #include "mem/port_proxy.hh"
 #include "sim/serialize.hh"
 
@@ -55,14 +55,7 @@ class ThreadContext;
 
 namespace X86ISA
 {
-    struct TlbEntry;
-}
-
-typedef Trie<Addr, X86ISA::TlbEntry> TlbEntryTrie;
-
-namespace X86ISA
-{
-    struct TlbEntry : public Serializable
+    struct TlbEntry : public PageTLBEntry, public Serializable
     {
         // The base of the physical page.
         Addr paddr;
@@ -88,10 +81,8 @@ namespace X86ISA
         bool patBit;
         // Whether or not memory on this page can be executed.
         bool noExec;
-        // A sequence number to keep track of LRU.
-        uint64_t lruSeq;
-
-        TlbEntryTrie::Handle trieHandle;
+        // The PCID the entry was inserted under.
+        uint16_t pcid;
 
         TlbEntry(Addr asn, Addr _vaddr, Addr _paddr,
                  bool uncacheable, bool read_only);
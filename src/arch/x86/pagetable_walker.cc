@@ -52,6 +52,7 @@
 #include <memory>
 
 #include "arch/x86/faults.hh"
+#include "arch/x86/page_size.hh"
 #include "arch/x86/pagetable.hh"
 #include "arch/x86/regs/misc.hh"
 #include "arch/x86/tlb.hh"
@@ -153,6 +154,63 @@ Walker::recvReqRetry()
     }
 }
 
+void
+Walker::sendPWCResponse(WalkerState *sendingState, PacketPtr pkt)
+{
+    pkt->pushSenderState(new WalkerSenderState(sendingState));
+    pkt->makeResponse();
+    // The walker state may still be stepping through the previous
+    // response, so deliver this one from an event like the port would.
+    auto *event = new EventFunctionWrapper(
+        [this, pkt]{ recvTimingResp(pkt); }, name() + ".pwcResponse",
+        true);
+    schedule(event, clockEdge(pwcLatency));
+}
+
+bool
+Walker::pwcLookup(PacketPtr pkt, int level)
+{
+    // Leaf entries are never cached, don't count them as misses.
+    if (!enablePWC || level == 0)
+        return false;
+
+    uint64_t pte;
+    if (!pwc.lookup(pkt->getAddr(), pte)) {
+        stats.pwcMisses++;
+        return false;
+    }
+
+    DPRINTF(PageTableWalker, "Page walk cache hit for %#x: %#x\n",
+            pkt->getAddr(), pte);
+    stats.pwcHits++;
+    if (pkt->getSize() == 8)
+        pkt->setLE<uint64_t>(pte);
+    else
+        pkt->setLE<uint32_t>(pte);
+    return true;
+}
+
+void
+Walker::pwcInsert(PacketPtr pkt, uint64_t pte)
+{
+    if (enablePWC && !pkt->req->isUncacheable())
+        pwc.insert(pkt->getAddr(), pte);
+}
+
+bool
+Walker::canCoalesce(WalkerState *state)
+{
+    if (!coalesceWalks || state->wasStarted() ||
+            state->translation->squashed()) {
+        return false;
+    }
+
+    CR3 cr3 = state->tc->readMiscRegNoEffect(misc_reg::Cr3);
+    CR4 cr4 = state->tc->readMiscRegNoEffect(misc_reg::Cr4);
+    Addr vpn = state->req->getVaddr() & ~mask(PageShift);
+    return tlb->lookup(vpn, cr4.pcide ? cr3.pcid : 0, false) != nullptr;
+}
+
 bool Walker::sendTiming(WalkerState* sendingState, PacketPtr pkt)
 {
     WalkerSenderState* walker_state = new WalkerSenderState(sendingState);
@@ -194,18 +252,31 @@ Walker::startWalkWrapper()
 {
     unsigned num_squashed = 0;
     WalkerState *currState = currStates.front();
+
+    // A walk queued behind one to the same page would only find the
+    // entry that walk put in the TLB, so look it up there instead.
+    bool tlb_hit = currState && canCoalesce(currState);
     while ((num_squashed < numSquashable) && currState &&
-        currState->translation->squashed()) {
+        (currState->translation->squashed() || tlb_hit)) {
         currStates.pop_front();
         num_squashed++;
 
-        DPRINTF(PageTableWalker, "Squashing table walk for address %#x\n",
-            currState->req->getVaddr());
-
-        // finish the translation which will delete the translation object
-        currState->translation->finish(
-            std::make_shared<UnimpFault>("Squashed Inst"),
-            currState->req, currState->tc, currState->mode);
+        if (tlb_hit) {
+            DPRINTF(PageTableWalker, "Coalescing table walk for address "
+                    "%#x\n", currState->req->getVaddr());
+            stats.coalescedWalks++;
+            tlb->translateTiming(currState->req, currState->tc,
+                                 currState->translation, currState->mode);
+        } else {
+            DPRINTF(PageTableWalker, "Squashing table walk for address "
+                    "%#x\n", currState->req->getVaddr());
+
+            // finish the translation which will delete the translation
+            // object
+            currState->translation->finish(
+                std::make_shared<UnimpFault>("Squashed Inst"),
+                currState->req, currState->tc, currState->mode);
+        }
 
         // delete the current request if there are no inflight packets.
         // if there is something in flight, delete when the packets are
@@ -221,9 +292,14 @@ Walker::startWalkWrapper()
             currState = currStates.front();
         else
             currState = NULL;
+        tlb_hit = currState && canCoalesce(currState);
+    }
+    if (currState && !currState->wasStarted()) {
+        if (tlb_hit)
+            schedule(startWalkWrapperEvent, clockEdge(Cycles(1)));
+        else
+            currState->startWalk();
     }
-    if (currState && !currState->wasStarted())
-        currState->startWalk();
 }
 
 Fault
@@ -232,6 +308,7 @@ Walker::WalkerState::startWalk()
     Fault fault = NoFault;
     assert(!started);
     started = true;
+    walker->stats.walks++;
     setupWalk(req->getVaddr());
     if (timing) {
         nextState = state;
@@ -240,7 +317,7 @@ Walker::WalkerState::startWalk()
         sendPackets();
     } else {
         do {
-            walker->port.sendAtomic(read);
+            sendAtomicRead();
             PacketPtr write = NULL;
             fault = stepWalk(write);
             assert(fault == NoFault || read == NULL);
@@ -530,6 +607,8 @@ Walker::WalkerState::stepWalk(PacketPtr &write)
         endWalk();
     } else {
         PacketPtr oldRead = read;
+        if (!functional)
+            walker->pwcInsert(oldRead, pte);
         //If we didn't return, we're setting up another read.
         Request::Flags flags = oldRead->req->getFlags();
         flags.set(Request::UNCACHEABLE, uncacheable);
@@ -633,6 +712,7 @@ Walker::WalkerState::recvPacket(PacketPtr pkt)
 
         // @todo someone should pay for this
         pkt->headerDelay = pkt->payloadDelay = 0;
+        walker->stats.levelLatency[readLevel] += curTick() - readIssued;
 
         state = nextState;
         nextState = Ready;
@@ -687,12 +767,17 @@ Walker::WalkerState::sendPackets()
         PacketPtr pkt = read;
         read = NULL;
         inflight++;
-        if (!walker->sendTiming(this, pkt)) {
+        readLevel = levelOf(nextState);
+        readIssued = curTick();
+        if (walker->pwcLookup(pkt, readLevel)) {
+            walker->sendPWCResponse(this, pkt);
+        } else if (!walker->sendTiming(this, pkt)) {
             retrying = true;
             read = pkt;
             inflight--;
             return;
         }
+        walker->stats.levelReads[readLevel]++;
     }
     //Send off as many of the writes as we can.
     while (writes.size()) {
@@ -745,6 +830,38 @@ Walker::WalkerState::retry()
     sendPackets();
 }
 
+void
+Walker::WalkerState::sendAtomicRead()
+{
+    int level = levelOf(state);
+    walker->stats.levelReads[level]++;
+    if (walker->pwcLookup(read, level)) {
+        walker->stats.levelLatency[level] +=
+            walker->cyclesToTicks(walker->pwcLatency);
+    } else {
+        walker->stats.levelLatency[level] += walker->port.sendAtomic(read);
+    }
+}
+
+int
+Walker::WalkerState::levelOf(State state)
+{
+    switch (state) {
+      case LongPML4:
+        return 3;
+      case LongPDP:
+      case PAEPDP:
+        return 2;
+      case LongPD:
+      case PAEPD:
+      case PSEPD:
+      case PD:
+        return 1;
+      default:
+        return 0;
+    }
+}
+
 Fault
 Walker::WalkerState::pageFault(bool present)
 {
@@ -756,5 +873,38 @@ Walker::WalkerState::pageFault(bool present)
                                        m5reg.cpl == 3, false);
 }
 
+Walker::WalkerStats::WalkerStats(statistics::Group *parent)
+  : statistics::Group(parent),
+    ADD_STAT(walks, statistics::units::Count::get(),
+             "Table walks started"),
+    ADD_STAT(coalescedWalks, statistics::units::Count::get(),
+             "Queued table walks satisfied by the TLB instead"),
+    ADD_STAT(pwcHits, statistics::units::Count::get(),
+             "Directory entry reads that hit in the page walk cache"),
+    ADD_STAT(pwcMisses, statistics::units::Count::get(),
+             "Directory entry reads that missed in the page walk cache"),
+    ADD_STAT(levelReads, statistics::units::Count::get(),
+             "Page table entry reads per level"),
+    ADD_STAT(levelLatency, statistics::units::Tick::get(),
+             "Total latency of page table entry reads per level"),
+    ADD_STAT(avgLevelLatency, statistics::units::Rate<
+                statistics::units::Tick, statistics::units::Count>::get(),
+             "Average latency of page table entry reads per level",
+             levelLatency / levelReads)
+{
+    levelReads
+        .init(4)
+        .subname(0, "pte")
+        .subname(1, "pd")
+        .subname(2, "pdp")
+        .subname(3, "pml4");
+    levelLatency
+        .init(4)
+        .subname(0, "pte")
+        .subname(1, "pd")
+        .subname(2, "pdp")
+        .subname(3, "pml4");
+}
+
 } // namespace X86ISA
 } // namespace gem5
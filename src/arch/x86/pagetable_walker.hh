@@ -41,8 +41,10 @@
 #include <vector>
 
 #include "arch/generic/mmu.hh"
+#include "arch/generic/page_walk_cache.hh"
 #include "arch/x86/pagetable.hh"
 #include "arch/x86/tlb.hh"
+#include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/packet.hh"
 #include "params/X86PagetableWalker.hh"
@@ -115,6 +117,9 @@ namespace X86ISA
             bool retrying;
             bool started;
             bool squashed;
+            // Level and issue tick of the read in flight, for the stats
+            int readLevel;
+            Tick readIssued;
           public:
             WalkerState(Walker * _walker, BaseMMU::Translation *_translation,
                         const RequestPtr &_req, bool _isFunctional = false) :
@@ -122,7 +127,8 @@ namespace X86ISA
                 nextState(Ready), inflight(0),
                 translation(_translation),
                 functional(_isFunctional), timing(false),
-                retrying(false), started(false), squashed(false)
+                retrying(false), started(false), squashed(false),
+                readLevel(0), readIssued(0)
             {
             }
             void initState(ThreadContext * _tc, BaseMMU::Mode _mode,
@@ -144,6 +150,13 @@ namespace X86ISA
             void sendPackets();
             void endWalk();
             Fault pageFault(bool present);
+            void sendAtomicRead();
+
+            /**
+             * Number of levels a state is above the leaf of the walk,
+             * with the last level page table being level 0.
+             */
+            static int levelOf(State state);
         };
 
         friend class WalkerState;
@@ -191,8 +204,54 @@ namespace X86ISA
         void recvReqRetry();
         bool sendTiming(WalkerState * sendingState, PacketPtr pkt);
 
+        // Whether page walk cache is in use, and its access latency.
+        const bool enablePWC;
+        const Cycles pwcLatency;
+
+        // Upper level page table entries read by previous walks.
+        PageWalkCache pwc;
+
+        // Whether to finish queued walks which hit in the TLB by the
+        // time they reach the head of the queue without walking.
+        const bool coalesceWalks;
+
+        /**
+         * Fill a read of a directory entry from the page walk cache.
+         *
+         * @param pkt Read of the page table entry.
+         * @param level Level of the entry, see WalkerState::levelOf().
+         * @return True if the packet data was filled in.
+         */
+        bool pwcLookup(PacketPtr pkt, int level);
+
+        // Remember a directory entry read from memory.
+        void pwcInsert(PacketPtr pkt, uint64_t pte);
+
+        // Respond to a timing read which hit in the page walk cache.
+        void sendPWCResponse(WalkerState *sendingState, PacketPtr pkt);
+
+        // Check whether a queued walk can be satisfied by the TLB.
+        bool canCoalesce(WalkerState *state);
+
+        struct WalkerStats : public statistics::Group
+        {
+            WalkerStats(statistics::Group *parent);
+
+            statistics::Scalar walks;
+            statistics::Scalar coalescedWalks;
+            statistics::Scalar pwcHits;
+            statistics::Scalar pwcMisses;
+            statistics::Vector levelReads;
+            statistics::Vector levelLatency;
+            statistics::Formula avgLevelLatency;
+        } stats;
+
       public:
 
+        // Drop all cached directory entries. Called whenever the TLB
+        // is flushed, since a page table update is not snooped.
+        void invalidatePWC() { pwc.clear(); }
+
         void setTLB(TLB * _tlb)
         {
             tlb = _tlb;
@@ -205,7 +264,12 @@ namespace X86ISA
             funcState(this, NULL, NULL, true), tlb(NULL), sys(params.system),
             requestorId(sys->getRequestorId(this)),
             numSquashable(params.num_squash_per_cycle),
-            startWalkWrapperEvent([this]{ startWalkWrapper(); }, name())
+            startWalkWrapperEvent([this]{ startWalkWrapper(); }, name()),
+            enablePWC(params.enable_pwc), pwcLatency(params.pwc_latency),
+            pwc(name() + ".pwc", params.pwc_size, params.pwc_assoc,
+                params.pwc_replacement_policy, params.pwc_indexing_policy),
+            coalesceWalks(params.coalesce_walks),
+            stats(this)
         {
         }
     };
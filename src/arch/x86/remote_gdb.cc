@@ -91,7 +91,7 @@ RemoteGDB::acc(Addr va, size_t len)
                                         BaseMMU::Read);
         return fault == NoFault;
     } else {
-        return context()->getProcessPtr()->pTable->lookup(va) != nullptr;
+        return context()->getProcessPtr()->pTable->lookup(va).has_value();
     }
 }
 
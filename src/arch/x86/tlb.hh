@@ -38,12 +38,9 @@
 #ifndef __ARCH_X86_TLB_HH__
 #define __ARCH_X86_TLB_HH__
 
-#include <list>
-#include <vector>
-
+#include "arch/generic/page_tlb.hh"
 #include "arch/generic/tlb.hh"
 #include "arch/x86/pagetable.hh"
-#include "base/trie.hh"
 #include "mem/request.hh"
 #include "params/X86TLB.hh"
 #include "sim/stats.hh"
@@ -62,8 +59,6 @@ namespace X86ISA
       protected:
         friend class Walker;
 
-        typedef std::list<TlbEntry *> EntryList;
-
         uint32_t configAddress;
 
       public:
@@ -73,19 +68,12 @@ namespace X86ISA
 
         void takeOverFrom(BaseTLB *otlb) override {}
 
-        TlbEntry *lookup(Addr va, bool update_lru = true);
+        TlbEntry *lookup(Addr va, uint64_t pcid, bool update_lru = true);
 
         void setConfigAddress(uint32_t addr);
-        //concatenate Page Addr and pcid
-        inline Addr concAddrPcid(Addr vpn, uint64_t pcid)
-        {
-          return (vpn | pcid);
-        }
 
       protected:
 
-        EntryList::iterator lookupIt(Addr va, bool update_lru = true);
-
         Walker * walker;
 
       public:
@@ -100,12 +88,7 @@ namespace X86ISA
       protected:
         uint32_t size;
 
-        std::vector<TlbEntry> tlb;
-
-        EntryList freeList;
-
-        TlbEntryTrie trie;
-        uint64_t lruSeq;
+        PageTLB<TlbEntry> tlb;
 
         AddrRange m5opRange;
 
@@ -127,14 +110,6 @@ namespace X86ISA
 
       public:
 
-        void evictLRU();
-
-        uint64_t
-        nextSeq()
-        {
-            return ++lruSeq;
-        }
-
         Fault translateAtomic(
             const RequestPtr &req, ThreadContext *tc,
             BaseMMU::Mode mode) override;
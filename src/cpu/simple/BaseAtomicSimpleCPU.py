@@ -61,6 +61,22 @@ class BaseAtomicSimpleCPU(BaseSimpleCPU):
     width = Param.Int(1, "CPU width")
     simulate_data_stalls = Param.Bool(False, "Simulate dcache stall cycles")
     simulate_inst_stalls = Param.Bool(False, "Simulate icache stall cycles")
+    fuse_microops = Param.Bool(
+        False,
+        "Execute the micro-ops of a macro-op, including the ones of "
+        "microcode ROM routines, in a single step up to the first micro-op "
+        "branching backwards. This speeds up fast-forwarding ISAs with "
+        "many microcoded instructions, such as x86, but each such group "
+        "of micro-ops, e.g. each iteration of a REP string instruction, "
+        "then counts as a single cycle.",
+    )
+    bulk_execute = Param.Bool(
+        False,
+        "Let macro-ops which support it, such as x86 repeated string "
+        "instructions, do their work directly on host memory in chunks "
+        "rather than one micro-op at a time. This only takes effect when "
+        "the system bypasses the caches.",
+    )
 
     def addSimPointProbe(self, interval):
         simpoint = SimPoint()
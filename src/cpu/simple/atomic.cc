@@ -78,6 +78,8 @@ AtomicSimpleCPU::AtomicSimpleCPU(const BaseAtomicSimpleCPUParams &p)
       width(p.width), locked(false),
       simulate_data_stalls(p.simulate_data_stalls),
       simulate_inst_stalls(p.simulate_inst_stalls),
+      fuseMicroops(p.fuse_microops),
+      bulkExecute(p.bulk_execute),
       icachePort(name() + ".icache_port"),
       dcachePort(name() + ".dcache_port", this),
       dcache_access(false), dcache_latency(0),
@@ -271,6 +273,7 @@ AtomicSimpleCPU::suspendContext(ThreadID thread_num)
 Tick
 AtomicSimpleCPU::sendPacket(RequestPort &port, const PacketPtr &pkt)
 {
+    EventQueue::ScopedMigration migrate(memEventQueue(), inParallelMode);
     return port.sendAtomic(pkt);
 }
 
@@ -379,6 +382,11 @@ AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
     bool predicate;
     Fault fault = NoFault;
 
+    if (inParallelMode && (flags & Request::LOCKED_RMW)) {
+        assert(!lockedRMWMigration);
+        lockedRMWMigration.emplace(memEventQueue());
+    }
+
     while (1) {
         predicate = genMemFragmentRequest(req, frag_addr, size, flags,
                                           byte_enable, frag_size, size_left);
@@ -392,6 +400,8 @@ AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
         // Now do the access.
         if (predicate && fault == NoFault &&
             !req->getFlags().isSet(Request::NO_ACCESS)) {
+            EventQueue::ScopedMigration migrate(memEventQueue(),
+                                                inParallelMode);
             Packet pkt(req, Packet::makeReadCmd(req));
             pkt.dataStatic(data);
 
@@ -411,8 +421,10 @@ AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
         }
 
         //If there's a fault, return it
-        if (fault != NoFault)
+        if (fault != NoFault) {
+            lockedRMWMigration.reset();
             return req->isPrefetch() ? NoFault : fault;
+        }
 
         // If we don't need to access further cache lines, stop now.
         if (size_left == 0) {
@@ -477,6 +489,8 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
 
         // Now do the access.
         if (predicate && fault == NoFault) {
+            EventQueue::ScopedMigration migrate(memEventQueue(),
+                                                inParallelMode);
             bool do_access = true;  // flag to suppress cache access
 
             if (req->isLLSC()) {
@@ -521,6 +535,9 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
         //If there's a fault or we don't need to access a second cache line,
         //stop now.
         if (fault != NoFault || size_left == 0) {
+            // The locked RMW ends here whether or not the write faulted.
+            if (flags & Request::LOCKED_RMW)
+                lockedRMWMigration.reset();
             if (req->isLockedRMW() && fault == NoFault) {
                 assert(!req->isMasked());
                 locked = false;
@@ -581,6 +598,8 @@ AtomicSimpleCPU::amoMem(Addr addr, uint8_t* data, unsigned size,
 
     // Now do the access.
     if (fault == NoFault && !req->getFlags().isSet(Request::NO_ACCESS)) {
+        EventQueue::ScopedMigration migrate(memEventQueue(), inParallelMode);
+
         // We treat AMO accesses as Write accesses with SwapReq command
         // data will hold the return data of the AMO access
         Packet pkt(req, Packet::makeWriteCmd(req));
@@ -630,8 +649,20 @@ AtomicSimpleCPU::tick()
 
     Tick latency = 0;
 
-    for (int i = 0; i < width || locked; ++i) {
-        baseStats.numCycles++;
+    // When fusing micro-ops, keep going through the micro-ops of a
+    // macro-op, even when it branches into the microcode ROM, until one
+    // branches backwards. Interrupts are only taken between macro-ops
+    // anyway, so this skips nothing but the rescheduling of the tick
+    // event. A backwards branch is a microcode loop, like the one of a
+    // REP string instruction, so each of its iterations is a new group
+    // which takes a cycle of its own.
+    bool fused = false;
+
+    for (int i = 0; i < width || locked || fused; ++i) {
+        // A fused group takes a single cycle, however many micro-ops it
+        // is made of.
+        if (!fused)
+            baseStats.numCycles++;
         updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
         if (!curStaticInst || !curStaticInst->isDelayedCommit()) {
@@ -650,6 +681,7 @@ AtomicSimpleCPU::tick()
         Fault fault = NoFault;
 
         const PCStateBase &pc = thread->pcState();
+        const MicroPC upc = pc.microPC();
 
         bool needToFetch = !isRomMicroPC(pc.microPC()) && !curMacroStaticInst;
         if (needToFetch) {
@@ -681,7 +713,15 @@ AtomicSimpleCPU::tick()
 
             Tick stall_ticks = 0;
             if (curStaticInst) {
-                fault = curStaticInst->execute(&t_info, traceData);
+                if (bulkExecute && curMacroStaticInst &&
+                        curStaticInst->isFirstMicroop()) {
+                    EventQueue::ScopedMigration migrate(memEventQueue(),
+                                                        inParallelMode);
+                    fault = curMacroStaticInst->executeBulk(
+                            thread->getTC());
+                }
+                if (fault == NoFault)
+                    fault = curStaticInst->execute(&t_info, traceData);
 
                 // keep an instruction count
                 if (fault == NoFault) {
@@ -725,6 +765,16 @@ AtomicSimpleCPU::tick()
         }
         if (fault != NoFault || !t_info.stayAtPC)
             advancePC(fault);
+
+        // A restarted macro-op hasn't done anything yet as far as
+        // interrupts are concerned.
+        if (fault != NoFault && std::dynamic_pointer_cast<ReExec>(fault))
+            curStaticInst = nullStaticInstPtr;
+
+        fused = fuseMicroops && fault == NoFault && !t_info.stayAtPC &&
+            (curMacroStaticInst ||
+             isRomMicroPC(thread->pcState().microPC())) &&
+            thread->pcState().microPC() > upc;
     }
 
     if (tryCompleteDrain())
@@ -41,6 +41,8 @@
 #ifndef __CPU_SIMPLE_ATOMIC_HH__
 #define __CPU_SIMPLE_ATOMIC_HH__
 
+#include <optional>
+
 #include "cpu/simple/base.hh"
 #include "cpu/simple/exec_context.hh"
 #include "mem/request.hh"
@@ -64,8 +66,18 @@ class AtomicSimpleCPU : public BaseSimpleCPU
 
     const int width;
     bool locked;
+
+    /**
+     * Held from the read of a locked read-modify-write to its write when
+     * running in parallel with other CPUs, so that none of them accesses
+     * memory in between.
+     */
+    std::optional<EventQueue::ScopedMigration> lockedRMWMigration;
+
     const bool simulate_data_stalls;
     const bool simulate_inst_stalls;
+    const bool fuseMicroops;
+    const bool bulkExecute;
 
     // main simulation loop (one cycle)
     void tick();
@@ -103,6 +115,15 @@ class AtomicSimpleCPU : public BaseSimpleCPU
      */
     bool tryCompleteDrain();
 
+    /**
+     * The event queue of the memory system. CPUs placed on their own event
+     * queues to be simulated in parallel, e.g. to fast-forward a
+     * multithreaded SE workload, migrate to it for every access so the
+     * memory system and the LL/SC monitors the accesses snoop are only
+     * ever used by one host thread at a time.
+     */
+    EventQueue *memEventQueue() const { return system->eventQueue(); }
+
     virtual Tick sendPacket(RequestPort &port, const PacketPtr &pkt);
     virtual Tick fetchInstMem();
 
@@ -135,6 +135,11 @@ SimpleThread::activate()
     if (status() == ThreadContext::Active)
         return;
 
+    // Emulated system calls on another CPU's event queue wake up and put
+    // to sleep threads of this CPU, so change its state under its queue.
+    EventQueue::ScopedMigration migrate(baseCpu->eventQueue(),
+                                        inParallelMode);
+
     lastActivate = curTick();
     _status = ThreadContext::Active;
     baseCpu->activateContext(_threadId);
@@ -146,6 +151,9 @@ SimpleThread::suspend()
     if (status() == ThreadContext::Suspended)
         return;
 
+    EventQueue::ScopedMigration migrate(baseCpu->eventQueue(),
+                                        inParallelMode);
+
     lastActivate = curTick();
     lastSuspend = curTick();
     _status = ThreadContext::Suspended;
@@ -159,6 +167,9 @@ SimpleThread::halt()
     if (status() == ThreadContext::Halted)
         return;
 
+    EventQueue::ScopedMigration migrate(baseCpu->eventQueue(),
+                                        inParallelMode);
+
     _status = ThreadContext::Halted;
     baseCpu->haltContext(_threadId);
 }
@@ -333,6 +333,18 @@ class StaticInst : public RefCounted, public StaticInstFlags
      */
     virtual StaticInstPtr fetchMicroop(MicroPC upc) const;
 
+    /**
+     * Functionally do part of the work of a long running macroop, e.g.
+     * the first iterations of a repeated string instruction, in a single
+     * step. CPUs which access memory atomically and don't need to see
+     * the individual accesses of the microops may call this before the
+     * first microop of the macroop.
+     *
+     * @return NoFault to go on with the microops, which complete the work
+     * left, or a fault, typically ReExec, to restart the macroop.
+     */
+    virtual Fault executeBulk(ThreadContext *tc) const { return NoFault; }
+
     /**
      * Return the target address for a PC-relative branch.
      * Invalid if not a PC-relative branch (i.e. isDirectCtrl()
@@ -407,7 +407,7 @@ AMDGPUDevice::readFrame(PacketPtr pkt, Addr offset)
     readPkt->dataDynamic(dataPtr);
     readPkt->req->setGPUFuncAccess(true);
     readPkt->setSuppressFuncError();
-    cp->shader()->cuList[0]->memPort[0].sendFunctional(readPkt);
+    cp->shader()->cuList[0]->memPort[0].sendMemSideFunctional(readPkt);
     if (readPkt->cmd == MemCmd::FunctionalReadError) {
         delete readPkt;
         delete[] dataPtr;
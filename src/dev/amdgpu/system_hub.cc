@@ -41,6 +41,9 @@ namespace gem5
 void
 AMDGPUSystemHub::sendRequest(PacketPtr pkt, Event *callback)
 {
+    // GPU compute units on their own event queue call in directly
+    EventQueue::ScopedMigration migrate(eventQueue(), inParallelMode);
+
     // Some requests, in particular atomics, need to be sent in order
     // to receive the correct values. If there is an atomic in progress
     // we must block it until that request is complete. This is overly
@@ -87,11 +87,25 @@ class DistEtherLink(SimObject):
     dist_size = Param.UInt32("1", "Number of gem5 processes (dist run)")
     sync_start = Param.Latency("5200000000000t", "first dist sync barrier")
     sync_repeat = Param.Latency("10us", "dist sync barrier repeat")
+    sync_max_repeat = Param.Latency(
+        "0ns",
+        "Upper bound for the interval between dist sync barriers when "
+        "lookahead skips the barriers no packet can cross (0 disables "
+        "lookahead)",
+    )
     server_name = Param.String("localhost", "Message server name")
     server_port = Param.UInt32("2200", "Message server port")
     is_switch = Param.Bool(False, "true if this a link in etherswitch")
     dist_sync_on_pseudo_op = Param.Bool(False, "Start sync with pseudo_op")
     num_nodes = Param.UInt32("2", "Number of simulate nodes")
+    shm = Param.Bool(
+        False,
+        "Use shared memory instead of TCP (all gem5 peers on one host)",
+    )
+    shm_name = Param.String("gem5-dist", "Base name of the shm segments")
+    shm_ring_size = Param.MemorySize(
+        "1MiB", "Size of the shm ring for each direction"
+    )
 
 
 class EtherBus(SimObject):
@@ -41,9 +41,11 @@
 
 #include "dev/net/dist_iface.hh"
 
+#include <algorithm>
 #include <queue>
 #include <thread>
 
+#include "base/intmath.hh"
 #include "base/trace.hh"
 #include "cpu/thread_context.hh"
 #include "debug/DistEthernet.hh"
@@ -66,7 +68,7 @@ DistIface *DistIface::primary = nullptr;
 bool DistIface::isSwitch = false;
 
 void
-DistIface::Sync::init(Tick start_tick, Tick repeat_tick)
+DistIface::Sync::init(Tick start_tick, Tick repeat_tick, Tick max_repeat)
 {
     if (start_tick < nextAt) {
         nextAt = start_tick;
@@ -81,6 +83,43 @@ DistIface::Sync::init(Tick start_tick, Tick repeat_tick)
         inform("Dist synchronisation interval is changed to %lu.\n",
                nextRepeat);
     }
+    baseRepeat = nextRepeat;
+
+    if (max_repeat > maxRepeat)
+        maxRepeat = max_repeat;
+}
+
+void
+DistIface::Sync::packetSent(Tick arrival)
+{
+    std::lock_guard<std::mutex> sync_lock(lock);
+    nextArrival = std::min(nextArrival, arrival);
+}
+
+Tick
+DistIface::Sync::earliestSendTick()
+{
+    // A peer can't react to a packet we sent before it receives it.
+    Tick next_send = nextArrival;
+    nextArrival = MaxTick;
+
+    // Nothing happens in this gem5 process before its next event. The
+    // other simulation threads are waiting at the sync barrier with their
+    // queues unlocked, so pull in the events they've been sent by other
+    // threads and look at the heads of all the queues.
+    EventQueue *cur_eq = curEventQueue();
+    for (uint32_t i = 0; i < numMainEventQueues; ++i) {
+        EventQueue *eq = mainEventQueue[i];
+        curEventQueue(eq);
+        eq->lock();
+        eq->handleAsyncInsertions();
+        if (!eq->empty())
+            next_send = std::min(next_send, eq->nextTick());
+        eq->unlock();
+    }
+    curEventQueue(cur_eq);
+
+    return std::max(next_send, curTick());
 }
 
 void
@@ -100,11 +139,15 @@ DistIface::SyncSwitch::SyncSwitch(int num_nodes)
     numExitReq = 0;
     numCkptReq = 0;
     numStopSyncReq = 0;
+    minNextSendTick = MaxTick;
     doExit = false;
     doCkpt = false;
     doStopSync = false;
     nextAt = std::numeric_limits<Tick>::max();
     nextRepeat = std::numeric_limits<Tick>::max();
+    baseRepeat = std::numeric_limits<Tick>::max();
+    maxRepeat = 0;
+    nextArrival = MaxTick;
     isAbort = false;
 }
 
@@ -119,6 +162,9 @@ DistIface::SyncNode::SyncNode()
     doStopSync = false;
     nextAt = std::numeric_limits<Tick>::max();
     nextRepeat = std::numeric_limits<Tick>::max();
+    baseRepeat = std::numeric_limits<Tick>::max();
+    maxRepeat = 0;
+    nextArrival = MaxTick;
     isAbort = false;
 }
 
@@ -134,7 +180,10 @@ DistIface::SyncNode::run(bool same_tick)
     // initiate the global synchronisation
     header.msgType = MsgType::cmdSyncReq;
     header.sendTick = curTick();
-    header.syncRepeat = nextRepeat;
+    // Always request the configured repeat value, the switch decides if
+    // syncs can be skipped.
+    header.syncRepeat = baseRepeat;
+    header.nextSendTick = same_tick ? earliestSendTick() : curTick();
     header.needCkpt = needCkpt;
     header.needStopSync = needStopSync;
     if (needCkpt != ReqType::none)
@@ -169,6 +218,24 @@ DistIface::SyncSwitch::run(bool same_tick)
         return false;
     assert(!same_tick || (nextAt == curTick()));
     waitNum = numNodes;
+    // Skip the periodic syncs ending a quantum in which no gem5 process
+    // can send anything. The next sync ends the quantum of the earliest
+    // announced send tick, as it would without skipping, so packets are
+    // received at the same ticks. Syncs out of the periodic schedule
+    // (start, checkpoint) always use the configured repeat value.
+    nextRepeat = baseRepeat;
+    if (same_tick && maxRepeat > baseRepeat) {
+        Tick next_send = std::min(minNextSendTick, earliestSendTick());
+        Tick max_quanta = maxRepeat / baseRepeat;
+        Tick quanta = next_send - curTick() >= maxRepeat ? max_quanta :
+            std::max<Tick>(divCeil(next_send - curTick(), baseRepeat), 1);
+        nextRepeat = quanta * baseRepeat;
+        if (quanta > 1) {
+            DPRINTF(DistEthernet, "Nothing to send before %lu, skipping "
+                    "%lu syncs\n", next_send, quanta - 1);
+        }
+    }
+    minNextSendTick = MaxTick;
     // Complete the global synchronisation
     header.msgType = MsgType::cmdSyncAck;
     header.sendTick = nextAt;
@@ -200,6 +267,7 @@ DistIface::SyncSwitch::run(bool same_tick)
 bool
 DistIface::SyncSwitch::progress(Tick send_tick,
                                  Tick sync_repeat,
+                                 Tick next_send_tick,
                                  ReqType need_ckpt,
                                  ReqType need_exit,
                                  ReqType need_stop_sync)
@@ -211,8 +279,9 @@ DistIface::SyncSwitch::progress(Tick send_tick,
 
     if (send_tick > nextAt)
         nextAt = send_tick;
-    if (nextRepeat > sync_repeat)
-        nextRepeat = sync_repeat;
+    if (baseRepeat > sync_repeat)
+        baseRepeat = sync_repeat;
+    minNextSendTick = std::min(minNextSendTick, next_send_tick);
 
     if (need_ckpt == ReqType::collective)
         numCkptReq++;
@@ -241,6 +310,7 @@ DistIface::SyncSwitch::progress(Tick send_tick,
 bool
 DistIface::SyncNode::progress(Tick max_send_tick,
                                Tick next_repeat,
+                               Tick next_send_tick,
                                ReqType do_ckpt,
                                ReqType do_exit,
                                ReqType do_stop_sync)
@@ -605,10 +675,12 @@ DistIface::DistIface(unsigned dist_rank,
                      unsigned dist_size,
                      Tick sync_start,
                      Tick sync_repeat,
+                     Tick sync_max_repeat,
                      EventManager *em,
                      bool use_pseudo_op,
                      bool is_switch, int num_nodes) :
     syncStart(sync_start), syncRepeat(sync_repeat),
+    syncMaxRepeat(sync_max_repeat),
     recvThread(nullptr), recvScheduler(em), syncStartOnPseudoOp(use_pseudo_op),
     rank(dist_rank), size(dist_size)
 {
@@ -659,6 +731,8 @@ DistIface::packetOut(EthPacketPtr pkt, Tick send_delay)
     header.dataPacketLength = pkt->length;
     header.simLength = pkt->simLength;
 
+    sync->packetSent(curTick() + send_delay);
+
     // Send out the packet and the meta info.
     sendPacket(header, pkt);
 
@@ -704,6 +778,7 @@ DistIface::recvThreadFunc(Event *recv_done, Tick link_delay)
             // everything else must be synchronisation related command
             if (!sync->progress(header.sendTick,
                                 header.syncRepeat,
+                                header.nextSendTick,
                                 header.needCkpt,
                                 header.needExit,
                                 header.needStopSync))
@@ -799,7 +874,7 @@ DistIface::init(const Event *done_event, Tick link_delay)
     // might have different requirements. The singleton sync object
     // will select the minimum values for both params.
     assert(sync != nullptr);
-    sync->init(syncStart, syncRepeat);
+    sync->init(syncStart, syncRepeat, syncMaxRepeat);
 
     // Initialize the seed for random generator to avoid the same sequence
     // in all gem5 peer processes
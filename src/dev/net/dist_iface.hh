@@ -150,6 +150,22 @@ class DistIface : public Drainable, public Serializable
          * The repeat value for the next periodic sync
          */
         Tick nextRepeat;
+        /**
+         * The smallest configured repeat value. Lookahead may skip some of
+         * the periodic syncs, the actual repeat value is then a multiple
+         * of this.
+         */
+        Tick baseRepeat;
+        /**
+         * Upper bound for the repeat value when skipping syncs (0 if
+         * lookahead is disabled)
+         */
+        Tick maxRepeat;
+        /**
+         * The earliest tick at which a peer may receive a data packet sent
+         * by this gem5 process since the last sync (MaxTick if none).
+         */
+        Tick nextArrival;
         /**
          * Tick for the next periodic sync (if the event is not scheduled yet)
          */
@@ -167,9 +183,25 @@ class DistIface : public Drainable, public Serializable
          *
          * @param start Start tick for dist synchronisation
          * @param repeat Frequency of dist synchronisation
+         * @param max_repeat Upper bound for the interval between syncs
+         * when lookahead skips some of them
+         *
+         */
+        void init(Tick start, Tick repeat, Tick max_repeat);
+        /**
+         * Record a data packet sent by this gem5 process.
          *
+         * @param arrival The earliest tick at which the peer may receive
+         * the packet
+         */
+        void packetSent(Tick arrival);
+        /**
+         * The earliest tick at which this gem5 process may send a data
+         * packet. It must only be called from a periodic sync, with the
+         * sync lock held and all the simulation threads waiting at the
+         * sync barrier.
          */
-        void init(Tick start, Tick repeat);
+        Tick earliestSendTick();
         /**
          *  Core method to perform a full dist sync.
          *
@@ -184,6 +216,7 @@ class DistIface : public Drainable, public Serializable
          */
         virtual bool progress(Tick send_tick,
                               Tick next_repeat,
+                              Tick next_send_tick,
                               ReqType do_ckpt,
                               ReqType do_exit,
                               ReqType do_stop_sync) = 0;
@@ -226,6 +259,7 @@ class DistIface : public Drainable, public Serializable
         bool run(bool same_tick) override;
         bool progress(Tick max_req_tick,
                       Tick next_repeat,
+                      Tick next_send_tick,
                       ReqType do_ckpt,
                       ReqType do_exit,
                       ReqType do_stop_sync) override;
@@ -257,6 +291,11 @@ class DistIface : public Drainable, public Serializable
          *  Number of connected simulated nodes
          */
         unsigned numNodes;
+        /**
+         * The earliest send tick announced by the nodes for the current
+         * sync
+         */
+        Tick minNextSendTick;
 
       public:
         SyncSwitch(int num_nodes);
@@ -265,6 +304,7 @@ class DistIface : public Drainable, public Serializable
         bool run(bool same_tick) override;
         bool progress(Tick max_req_tick,
                       Tick next_repeat,
+                      Tick next_send_tick,
                       ReqType do_ckpt,
                       ReqType do_exit,
                       ReqType do_stop_sync) override;
@@ -294,6 +334,16 @@ class DistIface : public Drainable, public Serializable
      * for each simulated Ethernet link.
      * 3. Simulation thread(s) then waits until all receiver threads
      * complete the ongoing barrier. The global sync event is done.
+     *
+     * If lookahead is enabled, each gem5 process announces the earliest
+     * tick at which it may send a data packet in its periodic sync
+     * request: that is its next event, or the arrival of a packet it sent
+     * during the last quantum if that is earlier. Nothing can be sent
+     * before the earliest of these ticks, so the switch skips the periodic
+     * syncs which would end a quantum before it (up to a limit). The next
+     * sync stays on the grid of the configured interval and ends the
+     * quantum in which the first packet may be sent, so every packet is
+     * received at the same tick as when no sync is skipped.
      */
     class SyncEvent : public GlobalSyncEvent
     {
@@ -462,6 +512,11 @@ class DistIface : public Drainable, public Serializable
      * Frequency of dist sync events in ticks.
      */
     Tick syncRepeat;
+    /**
+     * Upper bound for the interval between dist sync events in ticks when
+     * lookahead skips some of them.
+     */
+    Tick syncMaxRepeat;
     /**
      * Receiver thread pointer.
      * Each DistIface object must have exactly one receiver thread.
@@ -574,12 +629,15 @@ class DistIface : public Drainable, public Serializable
      * @param dist_rank Rank of this gem5 process within the dist run
      * @param sync_start Start tick for dist synchronisation
      * @param sync_repeat Frequency for dist synchronisation
+     * @param sync_max_repeat Upper bound for the interval between syncs
+     * when lookahead skips some of them (0 disables lookahead)
      * @param em The event manager associated with the simulated Ethernet link
      */
     DistIface(unsigned dist_rank,
               unsigned dist_size,
               Tick sync_start,
               Tick sync_repeat,
+              Tick sync_max_repeat,
               EventManager *em,
               bool use_pseudo_op,
               bool is_switch,
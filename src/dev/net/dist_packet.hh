@@ -87,11 +87,19 @@ class DistHeaderPkt
          */
         MsgType msgType;
         Tick sendTick;
-        /**
-         * Length used for modeling timing in the simulator.
-         * (from EthPacketData::simLength).
-         */
-        unsigned simLength;
+        union
+        {
+            /**
+             * Length used for modeling timing in the simulator.
+             * (from EthPacketData::simLength).
+             */
+            unsigned simLength;
+            /**
+             * Earliest tick at which the sender may send its next data
+             * packet (used by sync request messages for lookahead).
+             */
+            Tick nextSendTick;
+        };
         union
         {
             Tick sendDelay;
@@ -29,14 +29,78 @@
 #include "dev/net/etherpkt.hh"
 
 #include <iostream>
+#include <vector>
 
 #include "base/inet.hh"
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "sim/serialize.hh"
 
 namespace gem5
 {
 
+namespace
+{
+
+/** Smallest pooled buffer size (log2). */
+const unsigned MinBufferShift = 6;
+/** Largest pooled buffer size (log2); larger buffers are not pooled. */
+const unsigned MaxBufferShift = 16;
+/** Maximum number of free buffers kept per size class. */
+const size_t MaxFreeBuffers = 64;
+
+struct BufferPool
+{
+    std::vector<uint8_t *> freeLists[MaxBufferShift - MinBufferShift + 1];
+
+    ~BufferPool()
+    {
+        for (auto &list : freeLists) {
+            for (auto buf : list)
+                delete [] buf;
+        }
+    }
+};
+
+thread_local BufferPool bufferPool;
+
+} // anonymous namespace
+
+uint8_t *
+EthPacketData::allocBuffer(unsigned size, unsigned &alloc_size)
+{
+    const unsigned shift = std::max(ceilLog2(std::max(size, 1U)),
+                                    (int)MinBufferShift);
+    if (shift > MaxBufferShift) {
+        alloc_size = size;
+        return new uint8_t[size];
+    }
+
+    alloc_size = 1U << shift;
+    auto &list = bufferPool.freeLists[shift - MinBufferShift];
+    if (list.empty())
+        return new uint8_t[alloc_size];
+
+    uint8_t *buf = list.back();
+    list.pop_back();
+    return buf;
+}
+
+void
+EthPacketData::freeBuffer(uint8_t *buf, unsigned alloc_size)
+{
+    if (alloc_size > (1U << MaxBufferShift)) {
+        delete [] buf;
+        return;
+    }
+
+    auto &list = bufferPool.freeLists[floorLog2(alloc_size) - MinBufferShift];
+    if (list.size() < MaxFreeBuffers)
+        list.push_back(buf);
+    else
+        delete [] buf;
+}
+
 void
 EthPacketData::serialize(const std::string &base, CheckpointOut &cp) const
 {
@@ -65,7 +129,7 @@ EthPacketData::unserialize(const std::string &base, CheckpointIn &cp)
     }
     assert(length <= bufLength);
     if (!data)
-        data = new uint8_t[bufLength];
+        data = allocBuffer(bufLength, allocLength);
     arrayParamIn(cp, base + ".data", data, length);
     if (!optParamIn(cp, base + ".simLength", simLength))
         simLength = length;
@@ -74,17 +74,39 @@ class EthPacketData
     unsigned simLength;
 
     EthPacketData()
-        : data(nullptr), bufLength(0), length(0), simLength(0)
+        : data(nullptr), bufLength(0), length(0), simLength(0), allocLength(0)
     { }
 
     explicit EthPacketData(unsigned size)
-        : data(new uint8_t[size]), bufLength(size), length(0), simLength(0)
+        : data(allocBuffer(size, allocLength)), bufLength(size), length(0),
+          simLength(0)
     { }
 
-    ~EthPacketData() { if (data) delete [] data; }
+    ~EthPacketData() { if (data) freeBuffer(data, allocLength); }
 
     void serialize(const std::string &base, CheckpointOut &cp) const;
     void unserialize(const std::string &base, CheckpointIn &cp);
+
+  private:
+    /**
+     * Size of the allocation backing the data buffer, which may be
+     * larger than bufLength.
+     */
+    unsigned allocLength;
+
+    /**
+     * Get a data buffer of at least size bytes. Buffers are recycled
+     * through per-thread free lists of power-of-two size classes, so
+     * the common case of one maximum-sized buffer per frame does not
+     * hit the host allocator.
+     *
+     * @param size Requested buffer size.
+     * @param alloc_size Actual size of the returned buffer.
+     */
+    static uint8_t *allocBuffer(unsigned size, unsigned &alloc_size);
+
+    /** Return a buffer obtained from allocBuffer(). */
+    static void freeBuffer(uint8_t *buf, unsigned alloc_size);
 };
 
 typedef std::shared_ptr<EthPacketData> EthPacketPtr;
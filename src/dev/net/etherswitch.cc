@@ -77,15 +77,24 @@ EtherSwitch::Interface::PortFifo::push(EthPacketPtr ptr, unsigned senderId)
     assert(ptr->length);
 
     _size += ptr->length;
-    fifo.emplace_hint(fifo.end(), ptr, curTick(), senderId);
+
+    // Packets arrive in tick order, so the new packet only needs to be
+    // ordered by sender among the packets received in this tick, which
+    // are at the back of the fifo
+    auto pos = fifo.end();
+    while (pos != fifo.begin() && std::prev(pos)->recvTick == curTick() &&
+           std::prev(pos)->srcId > senderId) {
+        --pos;
+    }
+    fifo.emplace(pos, ptr, curTick(), senderId);
 
     // Drop the extra pushed packets from end of the fifo
     while (avail() < 0) {
         DPRINTF(Ethernet, "Fifo is full. Drop packet: len=%d\n",
-                std::prev(fifo.end())->packet->length);
+                fifo.back().packet->length);
 
-        _size -= std::prev(fifo.end())->packet->length;
-        fifo.erase(std::prev(fifo.end()));
+        _size -= fifo.back().packet->length;
+        fifo.pop_back();
     }
 
     if (empty()) {
@@ -97,7 +106,7 @@ EtherSwitch::Interface::PortFifo::push(EthPacketPtr ptr, unsigned senderId)
     // at the head of the queue, otherwise return false
     // We need this information to deschedule the event that has been
     // scheduled for the old head of queue packet and schedule a new one
-    if (!empty() && fifo.begin()->packet == ptr) {
+    if (!empty() && fifo.front().packet == ptr) {
         return true;
     }
     return false;
@@ -109,10 +118,10 @@ EtherSwitch::Interface::PortFifo::pop()
     if (empty())
         return;
 
-    assert(_size >= fifo.begin()->packet->length);
+    assert(_size >= fifo.front().packet->length);
     // Erase the packet at the head of the queue
-    _size -= fifo.begin()->packet->length;
-    fifo.erase(fifo.begin());
+    _size -= fifo.front().packet->length;
+    fifo.pop_front();
 }
 
 void
@@ -342,7 +351,7 @@ EtherSwitch::Interface::PortFifo::unserialize(CheckpointIn &cp)
 
         entry.unserializeSection(cp, csprintf("entry%d", i));
 
-        fifo.insert(entry);
+        fifo.push_back(entry);
 
     }
 }
@@ -33,9 +33,9 @@
 #ifndef __DEV_ETHERSWITCH_HH__
 #define __DEV_ETHERSWITCH_HH__
 
-#include <map>
-#include <set>
+#include <deque>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "base/inet.hh"
@@ -122,18 +122,11 @@ class EtherSwitch : public SimObject
         class PortFifo : public Serializable
         {
           protected:
-            struct EntryOrder
-            {
-                bool operator() (const PortFifoEntry& lhs,
-                                 const PortFifoEntry& rhs) const
-                {
-                    if (lhs.recvTick == rhs.recvTick)
-                        return lhs.srcId < rhs.srcId;
-                    else
-                        return lhs.recvTick < rhs.recvTick;
-                }
-            };
-            std::set<PortFifoEntry, EntryOrder> fifo;
+            /**
+             * Packets ordered by receive tick and, for packets received
+             * in the same tick, by the id of the port they came from.
+             */
+            std::deque<PortFifoEntry> fifo;
 
             const std::string objName;
             const unsigned _maxsize;
@@ -152,7 +145,7 @@ class EtherSwitch : public SimObject
             // and remove packets from the end of fifo
             int avail() const { return _maxsize - _size; }
 
-            EthPacketPtr front() { return fifo.begin()->packet; }
+            EthPacketPtr front() { return fifo.front().packet; }
             bool empty() const { return _size == 0; }
             unsigned size() const { return _size; }
 
@@ -189,7 +182,7 @@ class EtherSwitch : public SimObject
     // all interfaces of the switch
     std::vector<Interface*> interfaces;
     // table that maps MAC address to interfaces
-    std::map<uint64_t, SwitchTableEntry> forwardingTable;
+    std::unordered_map<uint64_t, SwitchTableEntry> forwardingTable;
 
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
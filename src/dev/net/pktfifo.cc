@@ -33,6 +33,22 @@
 namespace gem5
 {
 
+void
+PacketFifo::append(const PacketFifoEntry &entry)
+{
+    if (tail - head == ring.size()) {
+        // Grow the ring, keeping every entry at its absolute position
+        std::vector<PacketFifoEntry> old(std::max<size_t>(ring.size() * 2,
+                                                          16));
+        old.swap(ring);
+        for (uint64_t pos = head; pos < tail; ++pos)
+            slot(pos) = old[pos & (old.size() - 1)];
+    }
+
+    slot(tail++) = entry;
+    ++_packets;
+}
+
 bool
 PacketFifo::copyout(void *dest, unsigned offset, unsigned len)
 {
@@ -40,8 +56,8 @@ PacketFifo::copyout(void *dest, unsigned offset, unsigned len)
     if (offset + len >= size())
         return false;
 
-    iterator i = fifo.begin();
-    iterator end = fifo.end();
+    iterator i = begin();
+    iterator end = this->end();
     while (len > 0) {
         EthPacketPtr &pkt = i->packet;
         while (offset >= pkt->length) {
@@ -89,28 +105,28 @@ PacketFifo::serialize(const std::string &base, CheckpointOut &cp) const
     paramOut(cp, base + ".size", _size);
     paramOut(cp, base + ".maxsize", _maxsize);
     paramOut(cp, base + ".reserved", _reserved);
-    paramOut(cp, base + ".packets", fifo.size());
+    paramOut(cp, base + ".packets", packets());
 
     int i = 0;
-    for (const auto &entry : fifo)
-        entry.serialize(csprintf("%s.entry%d", base, i++), cp);
+    for (auto entry = begin(); entry != end(); ++entry)
+        entry->serialize(csprintf("%s.entry%d", base, i++), cp);
 }
 
 void
 PacketFifo::unserialize(const std::string &base, CheckpointIn &cp)
 {
+    clear();
+
     paramIn(cp, base + ".size", _size);
 //  paramIn(cp, base + ".maxsize", _maxsize);
     paramIn(cp, base + ".reserved", _reserved);
     int fifosize;
     paramIn(cp, base + ".packets", fifosize);
 
-    fifo.clear();
-
     for (int i = 0; i < fifosize; ++i) {
         PacketFifoEntry entry;
         entry.unserialize(csprintf("%s.entry%d", base, i), cp);
-        fifo.push_back(entry);
+        append(entry);
     }
 }
 
@@ -29,9 +29,12 @@
 #ifndef __DEV_NET_PKTFIFO_HH__
 #define __DEV_NET_PKTFIFO_HH__
 
+#include <cstddef>
 #include <iosfwd>
-#include <list>
+#include <iterator>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "base/logging.hh"
 #include "dev/net/etherpkt.hh"
@@ -54,11 +57,6 @@ struct PacketFifoEntry
         clear();
     }
 
-    PacketFifoEntry(const PacketFifoEntry &s)
-        : packet(s.packet), number(s.number), slack(s.slack), priv(s.priv)
-    {
-    }
-
     PacketFifoEntry(EthPacketPtr p, uint64_t n)
         : packet(p), number(n), slack(0), priv(-1)
     {
@@ -80,24 +78,164 @@ struct PacketFifoEntry
 class PacketFifo
 {
   public:
+    /** Position of the past-the-end iterator. */
+    static const uint64_t EndPos = ~(uint64_t)0;
+
+    /**
+     * Iterator over the packets in the fifo. Iterators refer to
+     * positions in the fifo rather than to storage, so they remain
+     * valid when packets are pushed. Like list iterators, the end
+     * iterator is a sentinel that does not move when packets are
+     * pushed, and decrementing it yields the last packet.
+     */
+    template <class Fifo, class Entry>
+    class Iterator
+    {
+      public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef Entry value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Entry *pointer;
+        typedef Entry &reference;
+
+        Iterator() : fifo(nullptr), pos(EndPos) {}
+        Iterator(Fifo *f, uint64_t p) : fifo(f), pos(p) {}
+
+        /** Convert an iterator to a const_iterator. */
+        template <class F, class E, class = typename std::enable_if<
+            std::is_convertible<F *, Fifo *>::value>::type>
+        Iterator(const Iterator<F, E> &other)
+            : fifo(other.fifo), pos(other.pos)
+        {}
+
+        Entry &operator*() const { return fifo->slot(pos); }
+        Entry *operator->() const { return &fifo->slot(pos); }
+
+        Iterator &
+        operator++()
+        {
+            pos = fifo->nextPos(pos + 1);
+            return *this;
+        }
+
+        Iterator
+        operator++(int)
+        {
+            Iterator it(*this);
+            ++*this;
+            return it;
+        }
+
+        Iterator &
+        operator--()
+        {
+            pos = fifo->prevPos(pos);
+            return *this;
+        }
 
-    typedef std::list<PacketFifoEntry> fifo_list;
-    typedef fifo_list::iterator iterator;
-    typedef fifo_list::const_iterator const_iterator;
+        Iterator
+        operator--(int)
+        {
+            Iterator it(*this);
+            --*this;
+            return it;
+        }
+
+        friend bool
+        operator==(const Iterator &lhs, const Iterator &rhs)
+        {
+            return lhs.pos == rhs.pos;
+        }
+
+        friend bool
+        operator!=(const Iterator &lhs, const Iterator &rhs)
+        {
+            return lhs.pos != rhs.pos;
+        }
+
+      private:
+        friend class PacketFifo;
+        template <class F, class E>
+        friend class Iterator;
+
+        Fifo *fifo;
+        uint64_t pos;
+    };
+
+    typedef Iterator<PacketFifo, PacketFifoEntry> iterator;
+    typedef Iterator<const PacketFifo, const PacketFifoEntry> const_iterator;
 
   protected:
-    std::list<PacketFifoEntry> fifo;
+    /**
+     * Entries are stored in a ring indexed by their absolute position
+     * in the fifo. Removing an entry from the middle of the fifo
+     * leaves a hole (an entry without a packet) that iterators skip
+     * and that is reclaimed once it reaches either end of the fifo.
+     */
+    std::vector<PacketFifoEntry> ring;
+    /** Position of the first packet. */
+    uint64_t head;
+    /** Position after the last packet. */
+    uint64_t tail;
+    unsigned _packets;
     uint64_t _counter;
     unsigned _maxsize;
     unsigned _size;
     unsigned _reserved;
 
+    PacketFifoEntry &
+    slot(uint64_t pos)
+    {
+        return ring[pos & (ring.size() - 1)];
+    }
+
+    const PacketFifoEntry &
+    slot(uint64_t pos) const
+    {
+        return ring[pos & (ring.size() - 1)];
+    }
+
+    /** Position of the first packet at or after pos. */
+    uint64_t
+    nextPos(uint64_t pos) const
+    {
+        while (pos < tail && !slot(pos).packet)
+            ++pos;
+        return pos < tail ? pos : EndPos;
+    }
+
+    /** Position of the last packet before pos. */
+    uint64_t
+    prevPos(uint64_t pos) const
+    {
+        if (pos == EndPos)
+            pos = tail;
+        while (pos > head && !slot(--pos).packet)
+            ;
+        return pos;
+    }
+
+    /** Drop holes from both ends of the fifo. */
+    void
+    trim()
+    {
+        while (head < tail && !slot(head).packet)
+            ++head;
+        while (tail > head && !slot(tail - 1).packet)
+            --tail;
+    }
+
+    /** Append an entry, growing the ring if necessary. */
+    void append(const PacketFifoEntry &entry);
+
   public:
     explicit PacketFifo(int max)
-        : _counter(0), _maxsize(max), _size(0), _reserved(0) {}
+        : head(0), tail(0), _packets(0), _counter(0), _maxsize(max),
+          _size(0), _reserved(0)
+    {}
     virtual ~PacketFifo() {}
 
-    unsigned packets() const { return fifo.size(); }
+    unsigned packets() const { return _packets; }
     unsigned maxsize() const { return _maxsize; }
     unsigned size() const { return _size; }
     unsigned reserved() const { return _reserved; }
@@ -113,13 +251,17 @@ class PacketFifo
         return _reserved;
     }
 
-    iterator begin() { return fifo.begin(); }
-    iterator end() { return fifo.end(); }
+    iterator begin() { return iterator(this, head < tail ? head : EndPos); }
+    iterator end() { return iterator(this, EndPos); }
 
-    const_iterator begin() const { return fifo.begin(); }
-    const_iterator end() const { return fifo.end(); }
+    const_iterator
+    begin() const
+    {
+        return const_iterator(this, head < tail ? head : EndPos);
+    }
+    const_iterator end() const { return const_iterator(this, EndPos); }
 
-    EthPacketPtr front() { return fifo.begin()->packet; }
+    EthPacketPtr front() { return slot(head).packet; }
 
     bool
     push(EthPacketPtr ptr)
@@ -131,10 +273,7 @@ class PacketFifo
 
         _size += ptr->length;
 
-        PacketFifoEntry entry;
-        entry.packet = ptr;
-        entry.number = _counter++;
-        fifo.push_back(entry);
+        append(PacketFifoEntry(ptr, _counter++));
         _reserved = 0;
         return true;
     }
@@ -145,19 +284,21 @@ class PacketFifo
         if (empty())
             return;
 
-        iterator entry = fifo.begin();
-        _size -= entry->packet->length;
-        _size -= entry->slack;
-        entry->packet = NULL;
-        fifo.pop_front();
+        PacketFifoEntry &entry = slot(head);
+        _size -= entry.packet->length;
+        _size -= entry.slack;
+        entry.clear();
+        --_packets;
+        trim();
     }
 
     void
     clear()
     {
-        for (iterator i = begin(); i != end(); ++i)
-            i->clear();
-        fifo.clear();
+        for (uint64_t pos = head; pos < tail; ++pos)
+            slot(pos).clear();
+        head = tail;
+        _packets = 0;
         _size = 0;
         _reserved = 0;
     }
@@ -165,19 +306,19 @@ class PacketFifo
     void
     remove(iterator i)
     {
-        if (i != fifo.begin()) {
-            iterator prev = i;
-            --prev;
-            assert(prev != fifo.end());
-            prev->slack += i->packet->length;
-            prev->slack += i->slack;
+        PacketFifoEntry &entry = slot(i.pos);
+        if (i.pos != head) {
+            PacketFifoEntry &prev = slot(prevPos(i.pos));
+            prev.slack += entry.packet->length;
+            prev.slack += entry.slack;
         } else {
-            _size -= i->packet->length;
-            _size -= i->slack;
+            _size -= entry.packet->length;
+            _size -= entry.slack;
         }
 
-        i->clear();
-        fifo.erase(i);
+        entry.clear();
+        --_packets;
+        trim();
     }
 
     bool copyout(void *dest, unsigned offset, unsigned len);
@@ -185,18 +326,17 @@ class PacketFifo
     int
     countPacketsBefore(const_iterator i) const
     {
-        if (i == fifo.end())
+        if (i == end())
             return 0;
-        return i->number - fifo.begin()->number;
+        return i->number - slot(head).number;
     }
 
     int
     countPacketsAfter(const_iterator i) const
     {
-        auto end = fifo.end();
-        if (i == end)
+        if (i == end())
             return 0;
-        return (--end)->number - i->number;
+        return slot(prevPos(EndPos)).number - i->number;
     }
 
     void
@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Shared memory based interface class for dist-gem5 runs where all gem5
+ * peers run on the same host.
+ */
+
+#include "dev/net/shm_iface.hh"
+
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/DistEthernet.hh"
+#include "debug/DistEthernetCmd.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+              std::atomic<uint32_t>::is_always_lock_free,
+              "Shared memory rings need lock free atomics");
+
+std::vector<SHMIface *> SHMIface::ifaceRegistry;
+
+namespace
+{
+
+/** Number of polls before a blocked reader or writer goes to sleep. */
+const unsigned SpinCount = 4096;
+
+/** Upper bound on the time spent asleep between two liveness checks. */
+const long SleepNs = 100 * 1000 * 1000;
+
+void
+waitFor(std::atomic<uint32_t> &seq, uint32_t old_seq)
+{
+#if defined(__linux__)
+    struct timespec ts = { 0, SleepNs };
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&seq), FUTEX_WAIT,
+            old_seq, &ts, nullptr, 0);
+#else
+    if (seq.load() == old_seq)
+        sched_yield();
+#endif
+}
+
+void
+wakeUp(std::atomic<uint32_t> &seq, std::atomic<uint32_t> &waiters)
+{
+    seq.fetch_add(1);
+    if (waiters.load() == 0)
+        return;
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&seq), FUTEX_WAKE,
+            INT32_MAX, nullptr, nullptr, 0);
+#endif
+}
+
+} // anonymous namespace
+
+SHMIface::SHMIface(const std::string &shm_name, uint64_t ring_size,
+                   unsigned dist_rank, unsigned dist_size,
+                   Tick sync_start, Tick sync_repeat, Tick sync_max_repeat,
+                   EventManager *em, bool use_pseudo_op, bool is_switch,
+                   int num_nodes) :
+    DistIface(dist_rank, dist_size, sync_start, sync_repeat, sync_max_repeat,
+              em, use_pseudo_op, is_switch, num_nodes),
+    ringSize(ring_size), isSwitch(is_switch), seg(nullptr), segSize(0),
+    txRing(nullptr), txData(nullptr), rxRing(nullptr), rxData(nullptr),
+    closing(false)
+{
+    fatal_if(!isPowerOf2(ringSize), "shm_ring_size (%d) must be a power "
+             "of two", ringSize);
+
+    // A switch has one link per node, and node k always talks to the k-th
+    // link of the switch. Nodes only ever have a single link.
+    segName = "/" + shm_name + "." +
+        std::to_string(is_switch ? distIfaceId : dist_rank);
+
+    if (isSwitch)
+        mapSegment(true);
+}
+
+SHMIface::~SHMIface()
+{
+    // Tell the peer that no more messages will come, and stop our own
+    // receiver thread. The mapping itself is kept alive since the receiver
+    // thread is only joined by the DistIface destructor.
+    closing = true;
+    if (seg) {
+        txRing->closed = 1;
+        wakeUp(txRing->tailSeq, txRing->tailWaiters);
+        wakeUp(txRing->headSeq, txRing->headWaiters);
+        wakeUp(rxRing->tailSeq, rxRing->tailWaiters);
+        wakeUp(rxRing->headSeq, rxRing->headWaiters);
+    }
+    if (isSwitch)
+        shm_unlink(segName.c_str());
+}
+
+void
+SHMIface::mapSegment(bool create)
+{
+    const uint64_t data_offset = roundUp(sizeof(Segment), 64);
+    segSize = data_offset + 2 * ringSize;
+
+    int fd;
+    if (create) {
+        // Remove any segment left behind by an earlier run that crashed.
+        shm_unlink(segName.c_str());
+        fd = shm_open(segName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        fatal_if(fd < 0, "Can't create shared memory segment %s: %s",
+                 segName, strerror(errno));
+        fatal_if(ftruncate(fd, segSize) < 0,
+                 "Can't resize shared memory segment %s: %s",
+                 segName, strerror(errno));
+    } else {
+        // The switch may not have created the segment yet.
+        while ((fd = shm_open(segName.c_str(), O_RDWR, 0)) < 0) {
+            fatal_if(errno != ENOENT, "Can't open shared memory segment "
+                     "%s: %s", segName, strerror(errno));
+            usleep(10000);
+        }
+        struct stat st;
+        while (true) {
+            fatal_if(fstat(fd, &st) < 0, "fstat() failed: %s",
+                     strerror(errno));
+            if ((uint64_t)st.st_size >= segSize)
+                break;
+            usleep(10000);
+        }
+    }
+
+    void *addr = mmap(nullptr, segSize, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      fd, 0);
+    fatal_if(addr == MAP_FAILED, "Can't map shared memory segment %s: %s",
+             segName, strerror(errno));
+    close(fd);
+
+    seg = static_cast<Segment *>(addr);
+    uint8_t *to_node = static_cast<uint8_t *>(addr) + data_offset;
+    uint8_t *to_switch = to_node + ringSize;
+
+    if (isSwitch) {
+        txRing = &seg->toNode;
+        txData = to_node;
+        rxRing = &seg->toSwitch;
+        rxData = to_switch;
+    } else {
+        txRing = &seg->toSwitch;
+        txData = to_switch;
+        rxRing = &seg->toNode;
+        rxData = to_node;
+    }
+
+    if (create) {
+        // The new segment is zero filled, which makes both rings empty.
+        seg->ringSize = ringSize;
+        seg->switchPid = getpid();
+        seg->ready.store(1, std::memory_order_release);
+    } else {
+        while (!seg->ready.load(std::memory_order_acquire))
+            usleep(10000);
+        fatal_if(seg->ringSize != ringSize, "shm_ring_size mismatch "
+                 "between switch (%d) and node (%d)", seg->ringSize,
+                 ringSize);
+        seg->nodePid = getpid();
+    }
+}
+
+bool
+SHMIface::peerAlive() const
+{
+    pid_t pid = isSwitch ? seg->nodePid.load() : seg->switchPid.load();
+    return pid == 0 || kill(pid, 0) == 0 || errno != ESRCH;
+}
+
+void
+SHMIface::sendSHM(const void *buf, unsigned length)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(buf);
+    const uint64_t mask = ringSize - 1;
+    uint64_t tail = txRing->tail.load(std::memory_order_relaxed);
+    unsigned spins = 0;
+
+    while (length > 0) {
+        uint32_t seq = txRing->headSeq.load();
+        uint64_t used = tail - txRing->head.load(std::memory_order_acquire);
+        uint64_t avail = ringSize - used;
+        if (avail == 0) {
+            if (closing || rxRing->closed || !peerAlive()) {
+                exitSimLoop("Message server closed connection, simulation "
+                            "is exiting");
+                return;
+            }
+            if (++spins < SpinCount)
+                continue;
+            txRing->headWaiters.fetch_add(1);
+            waitFor(txRing->headSeq, seq);
+            txRing->headWaiters.fetch_sub(1);
+            continue;
+        }
+        spins = 0;
+
+        // Messages larger than the free space are written in pieces, the
+        // reader consumes them as they come in.
+        uint64_t chunk = std::min<uint64_t>(avail, length);
+        uint64_t off = tail & mask;
+        uint64_t first = std::min(chunk, ringSize - off);
+        std::memcpy(txData + off, src, first);
+        std::memcpy(txData, src + first, chunk - first);
+
+        tail += chunk;
+        src += chunk;
+        length -= chunk;
+        txRing->tail.store(tail, std::memory_order_release);
+        wakeUp(txRing->tailSeq, txRing->tailWaiters);
+    }
+}
+
+bool
+SHMIface::recvSHM(void *buf, unsigned length)
+{
+    uint8_t *dst = static_cast<uint8_t *>(buf);
+    const uint64_t mask = ringSize - 1;
+    uint64_t head = rxRing->head.load(std::memory_order_relaxed);
+    unsigned spins = 0;
+
+    while (length > 0) {
+        uint32_t seq = rxRing->tailSeq.load();
+        uint64_t ready = rxRing->tail.load(std::memory_order_acquire) - head;
+        if (ready == 0) {
+            if (closing) {
+                return false;
+            } else if (rxRing->closed) {
+                inform("shm_iface: Connection closed");
+                return false;
+            } else if (!peerAlive()) {
+                inform("shm_iface: gem5 peer terminated");
+                return false;
+            }
+            if (++spins < SpinCount)
+                continue;
+            rxRing->tailWaiters.fetch_add(1);
+            waitFor(rxRing->tailSeq, seq);
+            rxRing->tailWaiters.fetch_sub(1);
+            continue;
+        }
+        spins = 0;
+
+        uint64_t chunk = std::min<uint64_t>(ready, length);
+        uint64_t off = head & mask;
+        uint64_t first = std::min(chunk, ringSize - off);
+        std::memcpy(dst, rxData + off, first);
+        std::memcpy(dst + first, rxData, chunk - first);
+
+        head += chunk;
+        dst += chunk;
+        length -= chunk;
+        rxRing->head.store(head, std::memory_order_release);
+        wakeUp(rxRing->headSeq, rxRing->headWaiters);
+    }
+    return true;
+}
+
+void
+SHMIface::sendPacket(const Header &header, const EthPacketPtr &packet)
+{
+    std::lock_guard<std::mutex> lock(txLock);
+    sendSHM(&header, sizeof(header));
+    sendSHM(packet->data, packet->length);
+}
+
+void
+SHMIface::sendCmd(const Header &header)
+{
+    DPRINTF(DistEthernetCmd, "SHMIface::sendCmd() type: %d\n",
+            static_cast<int>(header.msgType));
+    // Global commands are sent by the primary DistIface to every peer, the
+    // same way TCPIface does it.
+    for (auto iface: ifaceRegistry) {
+        std::lock_guard<std::mutex> lock(iface->txLock);
+        iface->sendSHM(&header, sizeof(header));
+    }
+}
+
+bool
+SHMIface::recvHeader(Header &header)
+{
+    bool ret = recvSHM(&header, sizeof(header));
+    DPRINTF(DistEthernetCmd, "SHMIface::recvHeader() type: %d ret: %d\n",
+            static_cast<int>(header.msgType), ret);
+    return ret;
+}
+
+void
+SHMIface::recvPacket(const Header &header, EthPacketPtr &packet)
+{
+    packet = std::make_shared<EthPacketData>(header.dataPacketLength);
+    bool ret = recvSHM(packet->data, header.dataPacketLength);
+    panic_if(!ret, "Error while reading shared memory ring");
+    packet->simLength = header.simLength;
+    packet->length = header.dataPacketLength;
+}
+
+void
+SHMIface::initTransport()
+{
+    if (!isSwitch) {
+        fatal_if(distIfaceNum > 1, "SHMIface supports a single dist link "
+                 "per node");
+        DPRINTF(DistEthernet, "Attaching to shared memory segment %s\n",
+                segName);
+        mapSegment(false);
+    }
+    inform("Link okay  (iface:%d -> shm segment %s)", distIfaceId, segName);
+    ifaceRegistry.push_back(this);
+}
+
+} // namespace gem5
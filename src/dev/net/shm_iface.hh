@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Shared memory based interface class for dist-gem5 runs where all gem5
+ * peers run on the same host.
+ */
+
+#ifndef __DEV_NET_SHM_IFACE_HH__
+#define __DEV_NET_SHM_IFACE_HH__
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "dev/net/dist_iface.hh"
+
+namespace gem5
+{
+
+class EventManager;
+
+/**
+ * Dist interface that exchanges messages with a peer gem5 process through
+ * a pair of single-producer single-consumer byte rings in a POSIX shared
+ * memory segment. It carries the same DistHeaderPkt protocol as TCPIface.
+ *
+ * Every link of the switch process creates its own segment, and the node
+ * process with the matching rank attaches to it. Readers and writers spin
+ * for a short while before sleeping on a futex, so messages do not go
+ * through the kernel while both ends are busy.
+ */
+class SHMIface : public DistIface
+{
+  private:
+    /**
+     * Control block of a byte ring in shared memory. The memory starts out
+     * zeroed, which is a valid empty ring.
+     */
+    struct Ring
+    {
+        /** Total number of bytes consumed, only written by the reader. */
+        alignas(64) std::atomic<uint64_t> head;
+        /** Bumped whenever head moves, to wake up a blocked writer. */
+        std::atomic<uint32_t> headSeq;
+        std::atomic<uint32_t> headWaiters;
+
+        /** Total number of bytes produced, only written by the writer. */
+        alignas(64) std::atomic<uint64_t> tail;
+        /** Bumped whenever tail moves, to wake up a blocked reader. */
+        std::atomic<uint32_t> tailSeq;
+        std::atomic<uint32_t> tailWaiters;
+
+        /** Set by the writer when it will not produce any more data. */
+        alignas(64) std::atomic<uint32_t> closed;
+    };
+
+    /** Layout of the start of a shared memory segment. */
+    struct Segment
+    {
+        /** Set by the switch once the segment is initialized. */
+        alignas(64) std::atomic<uint32_t> ready;
+        /** Ring size the switch was configured with. */
+        uint64_t ringSize;
+        /** Process ids of both ends, used to detect dead peers. */
+        std::atomic<int32_t> switchPid;
+        std::atomic<int32_t> nodePid;
+        /** Ring carrying messages from the switch to the node. */
+        Ring toNode;
+        /** Ring carrying messages from the node to the switch. */
+        Ring toSwitch;
+    };
+
+    /** Name of the shared memory segment of this link. */
+    std::string segName;
+    /** Size of the data area of each ring in bytes (a power of two). */
+    uint64_t ringSize;
+    bool isSwitch;
+
+    Segment *seg;
+    uint64_t segSize;
+
+    /** Ring and data area this interface writes to. */
+    Ring *txRing;
+    uint8_t *txData;
+    /** Ring and data area this interface reads from. */
+    Ring *rxRing;
+    uint8_t *rxData;
+
+    /**
+     * Serializes writers, so that a header and its payload are always
+     * contiguous in the ring.
+     */
+    std::mutex txLock;
+
+    /** Set when this interface is destroyed to stop the receiver thread. */
+    std::atomic<bool> closing;
+
+    /** All interfaces in this process, used to broadcast commands. */
+    static std::vector<SHMIface *> ifaceRegistry;
+
+  private:
+    /** Map the shared memory segment, creating it if this is the switch. */
+    void mapSegment(bool create);
+
+    /** Check if the process at the other end of the link is still alive. */
+    bool peerAlive() const;
+
+    /**
+     * Append a message to the transmit ring, waiting for space if
+     * necessary.
+     *
+     * @param buf Start address of the message.
+     * @param length Size of the message in bytes.
+     */
+    void sendSHM(const void *buf, unsigned length);
+
+    /**
+     * Read the next bytes from the receive ring, waiting for them to
+     * arrive if necessary.
+     *
+     * @param buf Start address of buffer to store the message.
+     * @param length Exact size of the expected message in bytes.
+     * @return false if the peer went away before the message arrived.
+     */
+    bool recvSHM(void *buf, unsigned length);
+
+  protected:
+
+    void sendPacket(const Header &header,
+                    const EthPacketPtr &packet) override;
+
+    void sendCmd(const Header &header) override;
+
+    bool recvHeader(Header &header) override;
+
+    void recvPacket(const Header &header, EthPacketPtr &packet) override;
+
+    void initTransport() override;
+
+  public:
+    /**
+     * The ctor creates the shared memory segment if this is a link of the
+     * switch. Nodes attach to the segment in initTransport().
+     * @param shm_name Base name of the shared memory segments.
+     * @param ring_size Size of the ring for each direction in bytes.
+     * @param sync_start The tick for the first dist synchronisation.
+     * @param sync_repeat The frequency of dist synchronisation.
+     * @param sync_max_repeat Upper bound for the sync interval when
+     * lookahead skips syncs.
+     * @param em The EventManager object associated with the simulated
+     * Ethernet link.
+     */
+    SHMIface(const std::string &shm_name, uint64_t ring_size,
+             unsigned dist_rank, unsigned dist_size,
+             Tick sync_start, Tick sync_repeat, Tick sync_max_repeat,
+             EventManager *em, bool use_pseudo_op, bool is_switch,
+             int num_nodes);
+
+    ~SHMIface() override;
+};
+
+} // namespace gem5
+
+#endif // __DEV_NET_SHM_IFACE_HH__
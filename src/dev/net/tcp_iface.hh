@@ -142,13 +142,16 @@ class TCPIface : public DistIface
      * connections.
      * @param sync_start The tick for the first dist synchronisation.
      * @param sync_repeat The frequency of dist synchronisation.
+     * @param sync_max_repeat Upper bound for the sync interval when
+     * lookahead skips syncs.
      * @param em The EventManager object associated with the simulated
      * Ethernet link.
      */
     TCPIface(std::string server_name, unsigned server_port,
              unsigned dist_rank, unsigned dist_size,
-             Tick sync_start, Tick sync_repeat, EventManager *em,
-             bool use_pseudo_op, bool is_switch, int num_nodes);
+             Tick sync_start, Tick sync_repeat, Tick sync_max_repeat,
+             EventManager *em, bool use_pseudo_op, bool is_switch,
+             int num_nodes);
 
     ~TCPIface() override;
 };
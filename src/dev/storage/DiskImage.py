@@ -49,4 +49,10 @@ class CowDiskImage(DiskImage):
     cxx_class = "gem5::CowDiskImage"
     child = Param.DiskImage(RawDiskImage(read_only=True), "child image")
     table_size = Param.Int(65536, "initial table size")
+    incremental_checkpoint = Param.Bool(
+        False,
+        "Append sectors written since the last checkpoint to a log in the "
+        "output directory instead of saving the whole image with every "
+        "checkpoint. Checkpoints then link to or copy that log.",
+    )
     image_file = ""
@@ -32,10 +32,13 @@
 
 #include "dev/storage/disk_image.hh"
 
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <fstream>
@@ -43,6 +46,7 @@
 
 #include "base/callback.hh"
 #include "base/logging.hh"
+#include "base/output.hh"
 #include "base/trace.hh"
 #include "debug/DiskImageRead.hh"
 #include "debug/DiskImageWrite.hh"
@@ -53,12 +57,37 @@
 namespace gem5
 {
 
+////////////////////////////////////////////////////////////////////////
+//
+// Generic Disk image
+//
+std::streampos
+DiskImage::readSectors(uint8_t *data, std::streampos offset,
+                       size_t count) const
+{
+    uint64_t bytes = 0;
+    for (size_t i = 0; i < count; i++)
+        bytes += read(data + i * SectorSize, offset + (std::streamoff)i);
+    return bytes;
+}
+
+std::streampos
+DiskImage::writeSectors(const uint8_t *data, std::streampos offset,
+                        size_t count)
+{
+    uint64_t bytes = 0;
+    for (size_t i = 0; i < count; i++)
+        bytes += write(data + i * SectorSize, offset + (std::streamoff)i);
+    return bytes;
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Raw Disk image
 //
 RawDiskImage::RawDiskImage(const Params &p)
-    : DiskImage(p), disk_size(0)
+    : DiskImage(p), fd(-1), readonly(p.read_only), disk_size(0),
+      mapping(nullptr), mapSize(0)
 {
     open(p.image_file, p.read_only);
 }
@@ -87,58 +116,106 @@ RawDiskImage::open(const std::string &filename, bool rd_only)
         readonly = rd_only;
         file = filename;
 
-        std::ios::openmode mode = std::ios::in | std::ios::binary;
-        if (!readonly)
-            mode |= std::ios::out;
-        stream.open(file.c_str(), mode);
-        if (!stream.is_open())
+        fd = ::open(file.c_str(), readonly ? O_RDONLY : O_RDWR);
+        if (fd < 0)
             panic("Error opening %s", filename);
+
+        off_t end = lseek(fd, 0, SEEK_END);
+        if (end < 0)
+            panic("Could not determine the size of %s", filename);
+        disk_size = end;
+
+        if (disk_size > 0) {
+            int prot = readonly ? PROT_READ : PROT_READ | PROT_WRITE;
+            void *pmem = mmap(NULL, disk_size, prot, MAP_SHARED, fd, 0);
+            if (pmem != MAP_FAILED) {
+                mapping = (uint8_t *)pmem;
+                mapSize = disk_size;
+            } else {
+                warn("Could not mmap %s, falling back to file I/O: %s",
+                     filename, strerror(errno));
+            }
+        }
     }
 }
 
 void
 RawDiskImage::close()
 {
-    stream.close();
+    if (mapping)
+        munmap(mapping, mapSize);
+    mapping = nullptr;
+    mapSize = 0;
+
+    if (fd >= 0)
+        ::close(fd);
+    fd = -1;
+    disk_size = 0;
 }
 
 std::streampos
 RawDiskImage::size() const
 {
-    if (disk_size == 0) {
-        if (!stream.is_open())
-            panic("file not open!\n");
-        stream.seekg(0, std::ios::end);
-        disk_size = stream.tellg();
-    }
+    if (fd < 0)
+        panic("file not open!\n");
 
     return disk_size / SectorSize;
 }
 
 std::streampos
 RawDiskImage::read(uint8_t *data, std::streampos offset) const
+{
+    return readSectors(data, offset, 1);
+}
+
+std::streampos
+RawDiskImage::write(const uint8_t *data, std::streampos offset)
+{
+    return writeSectors(data, offset, 1);
+}
+
+std::streampos
+RawDiskImage::readSectors(uint8_t *data, std::streampos offset,
+                          size_t count) const
 {
     if (!initialized)
         panic("RawDiskImage not initialized");
 
-    if (!stream.is_open())
+    if (fd < 0)
         panic("file not open!\n");
 
-    stream.seekg(offset * SectorSize, std::ios::beg);
-    if (!stream.good())
-        panic("Could not seek to location in file");
+    const uint64_t start = (uint64_t)offset * SectorSize;
+    uint64_t len = 0;
+    if (start < disk_size)
+        len = std::min<uint64_t>(count * SectorSize, disk_size - start);
 
-    std::streampos pos = stream.tellg();
-    stream.read((char *)data, SectorSize);
+    if (mapping && start + len <= mapSize) {
+        std::memcpy(data, mapping + start, len);
+    } else {
+        uint64_t done = 0;
+        while (done < len) {
+            ssize_t ret = pread(fd, data + done, len - done, start + done);
+            if (ret < 0 && errno == EINTR)
+                continue;
+            if (ret < 0)
+                panic("Could not read from %s: %s", file, strerror(errno));
+            if (ret == 0)
+                break;
+            done += ret;
+        }
+        len = done;
+    }
 
-    DPRINTF(DiskImageRead, "read: offset=%d\n", (uint64_t)offset);
-    DDUMP(DiskImageRead, data, SectorSize);
+    DPRINTF(DiskImageRead, "read: offset=%d count=%d\n", (uint64_t)offset,
+            count);
+    DDUMP(DiskImageRead, data, len);
 
-    return stream.tellg() - pos;
+    return len;
 }
 
 std::streampos
-RawDiskImage::write(const uint8_t *data, std::streampos offset)
+RawDiskImage::writeSectors(const uint8_t *data, std::streampos offset,
+                           size_t count)
 {
     if (!initialized)
         panic("RawDiskImage not initialized");
@@ -146,19 +223,33 @@ RawDiskImage::write(const uint8_t *data, std::streampos offset)
     if (readonly)
         panic("Cannot write to a read only disk image");
 
-    if (!stream.is_open())
+    if (fd < 0)
         panic("file not open!\n");
 
-    stream.seekp(offset * SectorSize, std::ios::beg);
-    if (!stream.good())
-        panic("Could not seek to location in file");
+    const uint64_t start = (uint64_t)offset * SectorSize;
+    const uint64_t len = count * SectorSize;
 
-    DPRINTF(DiskImageWrite, "write: offset=%d\n", (uint64_t)offset);
-    DDUMP(DiskImageWrite, data, SectorSize);
+    DPRINTF(DiskImageWrite, "write: offset=%d count=%d\n", (uint64_t)offset,
+            count);
+    DDUMP(DiskImageWrite, data, len);
 
-    std::streampos pos = stream.tellp();
-    stream.write((const char *)data, SectorSize);
-    return stream.tellp() - pos;
+    if (mapping && start + len <= mapSize) {
+        std::memcpy(mapping + start, data, len);
+    } else {
+        // Writes past the end of the mapping extend the file.
+        uint64_t done = 0;
+        while (done < len) {
+            ssize_t ret = pwrite(fd, data + done, len - done, start + done);
+            if (ret < 0 && errno == EINTR)
+                continue;
+            if (ret < 0)
+                panic("Could not write to %s: %s", file, strerror(errno));
+            done += ret;
+        }
+        disk_size = std::max(disk_size, start + len);
+    }
+
+    return len;
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -167,9 +258,14 @@ RawDiskImage::write(const uint8_t *data, std::streampos offset)
 //
 const uint32_t CowDiskImage::VersionMajor = 1;
 const uint32_t CowDiskImage::VersionMinor = 0;
+const uint32_t CowDiskImage::LogVersionMajor = 2;
+const uint32_t CowDiskImage::LogVersionMinor = 0;
 
 CowDiskImage::CowDiskImage(const Params &p)
-    : DiskImage(p), filename(p.image_file), child(p.child), table(NULL)
+    : DiskImage(p), filename(p.image_file), child(p.child), table(NULL),
+      sectorCount(0), incremental(p.incremental_checkpoint),
+      logName(simout.resolve(name() + ".cowlog")), logSize(0),
+      lastPageNum(0), lastPage(nullptr)
 {
     if (filename.empty()) {
         initSectorTable(p.table_size);
@@ -187,13 +283,7 @@ CowDiskImage::CowDiskImage(const Params &p)
 
 CowDiskImage::~CowDiskImage()
 {
-    SectorTable::iterator i = table->begin();
-    SectorTable::iterator end = table->end();
-
-    while (i != end) {
-        delete (*i).second;
-        ++i;
-    }
+    delete table;
 }
 
 void
@@ -235,14 +325,66 @@ SafeReadSwap(std::ifstream &stream, T &data)
     data = letoh(data); //is this the proper byte order conversion?
 }
 
+CowDiskImage::Page *
+CowDiskImage::findPage(uint64_t page_num) const
+{
+    if (lastPage && lastPageNum == page_num)
+        return lastPage;
+
+    SectorTable::const_iterator i = table->find(page_num);
+    if (i == table->end())
+        return nullptr;
+
+    lastPageNum = page_num;
+    lastPage = i->second.get();
+    return lastPage;
+}
+
+CowDiskImage::Page *
+CowDiskImage::allocPage(uint64_t page_num)
+{
+    std::unique_ptr<Page> &page = (*table)[page_num];
+    if (!page)
+        page = std::make_unique<Page>();
+
+    lastPageNum = page_num;
+    lastPage = page.get();
+    return lastPage;
+}
+
+void
+CowDiskImage::insertSector(uint64_t offset, const uint8_t *data)
+{
+    Page *page = findPage(offset / SectorsPerPage);
+    if (!page)
+        page = allocPage(offset / SectorsPerPage);
+
+    const int idx = offset % SectorsPerPage;
+    if (!page->valid[idx]) {
+        page->valid.set(idx);
+        sectorCount++;
+    }
+    page->dirty.set(idx);
+    memcpy(page->data + idx * SectorSize, data, SectorSize);
+}
+
 bool
 CowDiskImage::open(const std::string &file)
 {
     std::ifstream stream(file.c_str());
     if (!stream.is_open())
         return false;
+    stream.close();
 
-    if (stream.fail() || stream.bad())
+    load(file);
+    return true;
+}
+
+void
+CowDiskImage::load(const std::string &file, uint64_t limit)
+{
+    std::ifstream stream(file.c_str(), std::ios::in | std::ios::binary);
+    if (!stream.is_open() || stream.fail() || stream.bad())
         panic("Error opening %s", file);
 
     uint64_t magic;
@@ -255,36 +397,47 @@ CowDiskImage::open(const std::string &file)
     SafeReadSwap(stream, major_version);
     SafeReadSwap(stream, minor_version);
 
-    if (major_version != VersionMajor && minor_version != VersionMinor)
-        panic("Could not open %s: invalid version %d.%d != %d.%d",
-              file, major_version, minor_version, VersionMajor, VersionMinor);
-
-    uint64_t sector_count;
-    SafeReadSwap(stream, sector_count);
-    table = new SectorTable(sector_count);
-
-
-    for (uint64_t i = 0; i < sector_count; i++) {
-        uint64_t offset;
-        SafeReadSwap(stream, offset);
-
-        Sector *sector = new Sector;
-        SafeRead(stream, sector, sizeof(Sector));
-
-        assert(table->find(offset) == table->end());
-        (*table)[offset] = sector;
+    uint8_t data[SectorSize];
+    if (major_version == VersionMajor) {
+        uint64_t sector_count;
+        SafeReadSwap(stream, sector_count);
+        initSectorTable(sector_count);
+
+        for (uint64_t i = 0; i < sector_count; i++) {
+            uint64_t offset;
+            SafeReadSwap(stream, offset);
+            SafeRead(stream, data, SectorSize);
+            insertSector(offset, data);
+        }
+    } else if (major_version == LogVersionMajor) {
+        // A log is a sequence of sector records, later records
+        // superseding earlier ones for the same sector.
+        initSectorTable(0);
+
+        while ((limit == 0 || (uint64_t)stream.tellg() < limit) &&
+               stream.peek() != std::ifstream::traits_type::eof()) {
+            uint64_t offset;
+            SafeReadSwap(stream, offset);
+            SafeRead(stream, data, SectorSize);
+            insertSector(offset, data);
+        }
+    } else {
+        panic("Could not open %s: invalid version %d.%d", file,
+              major_version, minor_version);
     }
 
     stream.close();
 
     initialized = true;
-    return true;
 }
 
 void
 CowDiskImage::initSectorTable(int hash_size)
 {
-    table = new SectorTable(hash_size);
+    delete table;
+    table = new SectorTable(hash_size / SectorsPerPage);
+    sectorCount = 0;
+    lastPage = nullptr;
 
     initialized = true;
 }
@@ -343,19 +496,66 @@ CowDiskImage::save(const std::string &file) const
 
     SafeWriteSwap(stream, (uint32_t)VersionMajor);
     SafeWriteSwap(stream, (uint32_t)VersionMinor);
-    SafeWriteSwap(stream, (uint64_t)table->size());
+    SafeWriteSwap(stream, (uint64_t)sectorCount);
+
+    uint64_t written = 0;
+    for (const auto &entry : *table) {
+        const Page *page = entry.second.get();
+        for (int i = 0; i < SectorsPerPage; i++) {
+            if (!page->valid[i])
+                continue;
+            SafeWriteSwap(stream,
+                          (uint64_t)(entry.first * SectorsPerPage + i));
+            SafeWrite(stream, page->data + i * SectorSize, SectorSize);
+            written++;
+        }
+    }
+
+    if (written != sectorCount)
+        panic("Incorrect Table Size during save of COW disk image");
 
-    uint64_t size = table->size();
-    SectorTable::iterator iter = table->begin();
-    SectorTable::iterator end = table->end();
+    stream.close();
+}
 
-    for (uint64_t i = 0; i < size; i++) {
-        if (iter == end)
-            panic("Incorrect Table Size during save of COW disk image");
+void
+CowDiskImage::appendLog() const
+{
+    std::ofstream stream;
+    if (logSize == 0) {
+        // Start a new file rather than truncating, an earlier checkpoint
+        // may still link to the old one.
+        unlink(logName.c_str());
+        stream.open(logName.c_str(), std::ios::out | std::ios::binary);
+    } else {
+        stream.open(logName.c_str(),
+                    std::ios::out | std::ios::binary | std::ios::app);
+    }
+    if (!stream.is_open() || stream.fail() || stream.bad())
+        panic("Error opening %s", logName);
+
+    if (logSize == 0) {
+        uint64_t magic;
+        memcpy(&magic, "COWDISK!", sizeof(magic));
+        SafeWrite(stream, magic);
+        SafeWriteSwap(stream, (uint32_t)LogVersionMajor);
+        SafeWriteSwap(stream, (uint32_t)LogVersionMinor);
+        logSize += sizeof(magic) + 2 * sizeof(uint32_t);
+    }
 
-        SafeWriteSwap(stream, (uint64_t)(*iter).first);
-        SafeWrite(stream, (*iter).second->data, sizeof(Sector));
-        ++iter;
+    for (const auto &entry : *table) {
+        Page *page = entry.second.get();
+        if (page->dirty.none())
+            continue;
+
+        for (int i = 0; i < SectorsPerPage; i++) {
+            if (!page->dirty[i])
+                continue;
+            SafeWriteSwap(stream,
+                          (uint64_t)(entry.first * SectorsPerPage + i));
+            SafeWrite(stream, page->data + i * SectorSize, SectorSize);
+            logSize += sizeof(uint64_t) + SectorSize;
+        }
+        page->dirty.reset();
     }
 
     stream.close();
@@ -364,12 +564,14 @@ CowDiskImage::save(const std::string &file) const
 void
 CowDiskImage::writeback()
 {
-    SectorTable::iterator i = table->begin();
-    SectorTable::iterator end = table->end();
-
-    while (i != end) {
-        child->write((*i).second->data, (*i).first);
-        ++i;
+    for (const auto &entry : *table) {
+        const Page *page = entry.second.get();
+        for (int i = 0; i < SectorsPerPage; i++) {
+            if (page->valid[i]) {
+                child->write(page->data + i * SectorSize,
+                             entry.first * SectorsPerPage + i);
+            }
+        }
     }
 }
 
@@ -379,51 +581,132 @@ CowDiskImage::size() const
 
 std::streampos
 CowDiskImage::read(uint8_t *data, std::streampos offset) const
+{
+    return readSectors(data, offset, 1);
+}
+
+std::streampos
+CowDiskImage::write(const uint8_t *data, std::streampos offset)
+{
+    return writeSectors(data, offset, 1);
+}
+
+std::streampos
+CowDiskImage::readSectors(uint8_t *data, std::streampos offset,
+                          size_t count) const
 {
     if (!initialized)
         panic("CowDiskImage not initialized");
 
-    if (offset > size())
+    const uint64_t first = offset;
+    if (first + count > (uint64_t)size())
         panic("access out of bounds");
 
-    SectorTable::const_iterator i = table->find(offset);
-    if (i == table->end())
-        return child->read(data, offset);
-    else {
-        memcpy(data, (*i).second->data, SectorSize);
-        DPRINTF(DiskImageRead, "read: offset=%d\n", (uint64_t)offset);
-        DDUMP(DiskImageRead, data, SectorSize);
-        return SectorSize;
+    // Sectors missing from the overlay are gathered into runs that are
+    // fetched from the child with a single access.
+    uint64_t bytes = 0;
+    uint64_t run_start = first;
+    size_t run_len = 0;
+    for (uint64_t sector = first; sector < first + count; sector++) {
+        const Page *page = findPage(sector / SectorsPerPage);
+        const int idx = sector % SectorsPerPage;
+        if (page && page->valid[idx]) {
+            if (run_len) {
+                bytes += child->readSectors(
+                    data + (run_start - first) * SectorSize, run_start,
+                    run_len);
+                run_len = 0;
+            }
+            memcpy(data + (sector - first) * SectorSize,
+                   page->data + idx * SectorSize, SectorSize);
+            bytes += SectorSize;
+        } else {
+            if (!run_len)
+                run_start = sector;
+            run_len++;
+        }
+    }
+    if (run_len) {
+        bytes += child->readSectors(data + (run_start - first) * SectorSize,
+                                    run_start, run_len);
     }
+
+    DPRINTF(DiskImageRead, "read: offset=%d count=%d\n", first, count);
+    DDUMP(DiskImageRead, data, count * SectorSize);
+
+    return bytes;
 }
 
 std::streampos
-CowDiskImage::write(const uint8_t *data, std::streampos offset)
+CowDiskImage::writeSectors(const uint8_t *data, std::streampos offset,
+                           size_t count)
 {
     if (!initialized)
         panic("RawDiskImage not initialized");
 
-    if (offset > size())
+    const uint64_t first = offset;
+    if (first + count > (uint64_t)size())
         panic("access out of bounds");
 
-    SectorTable::iterator i = table->find(offset);
-    if (i == table->end()) {
-        Sector *sector = new Sector;
-        memcpy(sector, data, SectorSize);
-        table->insert(make_pair(offset, sector));
-    } else {
-        memcpy((*i).second->data, data, SectorSize);
-    }
+    for (size_t i = 0; i < count; i++)
+        insertSector(first + i, data + i * SectorSize);
 
-    DPRINTF(DiskImageWrite, "write: offset=%d\n", (uint64_t)offset);
-    DDUMP(DiskImageWrite, data, SectorSize);
+    DPRINTF(DiskImageWrite, "write: offset=%d count=%d\n", first, count);
+    DDUMP(DiskImageWrite, data, count * SectorSize);
 
-    return SectorSize;
+    return count * SectorSize;
 }
 
+namespace
+{
+
+/** Copy the first size bytes of from into a new file called to. */
+void
+copyPrefix(const std::string &from, const std::string &to, uint64_t size)
+{
+    std::ifstream in(from.c_str(), std::ios::in | std::ios::binary);
+    if (!in.is_open())
+        panic("Error opening %s", from);
+
+    unlink(to.c_str());
+    std::ofstream out(to.c_str(), std::ios::out | std::ios::binary);
+    if (!out.is_open())
+        panic("Error opening %s", to);
+
+    char buf[64 * 1024];
+    while (size > 0) {
+        std::streamsize chunk = std::min<uint64_t>(size, sizeof(buf));
+        if (!in.read(buf, chunk))
+            panic("premature end-of-file in %s", from);
+        out.write(buf, chunk);
+        size -= chunk;
+    }
+
+    if (out.bad() || out.fail())
+        panic("Error writing %s", to);
+}
+
+} // anonymous namespace
+
 void
 CowDiskImage::serialize(CheckpointOut &cp) const
 {
+    if (incremental) {
+        appendLog();
+        // The checkpoint gets its own link to the log, or a copy if the
+        // two can't be linked. The log is only ever appended to, so the
+        // first cowLogSize bytes seen through a link never change.
+        std::string cowLog = name() + ".cowlog";
+        uint64_t cowLogSize = logSize;
+        const std::string cpt_log = CheckpointIn::dir() + "/" + cowLog;
+        unlink(cpt_log.c_str());
+        if (link(logName.c_str(), cpt_log.c_str()) != 0)
+            copyPrefix(logName, cpt_log, cowLogSize);
+        SERIALIZE_SCALAR(cowLog);
+        SERIALIZE_SCALAR(cowLogSize);
+        return;
+    }
+
     std::string cowFilename = name() + ".cow";
     SERIALIZE_SCALAR(cowFilename);
     save(CheckpointIn::dir() + "/" + cowFilename);
@@ -432,6 +715,24 @@ CowDiskImage::serialize(CheckpointOut &cp) const
 void
 CowDiskImage::unserialize(CheckpointIn &cp)
 {
+    std::string cowLog;
+    if (UNSERIALIZE_OPT_SCALAR(cowLog)) {
+        uint64_t cowLogSize;
+        UNSERIALIZE_SCALAR(cowLogSize);
+        cowLog = cp.getCptDir() + "/" + cowLog;
+        load(cowLog, cowLogSize);
+
+        if (incremental) {
+            // Carry on appending to a private copy of the log, leaving the
+            // checkpoint untouched for anyone else restoring from it.
+            copyPrefix(cowLog, logName, cowLogSize);
+            logSize = cowLogSize;
+            for (auto &entry : *table)
+                entry.second->dirty.reset();
+        }
+        return;
+    }
+
     std::string cowFilename;
     UNSERIALIZE_SCALAR(cowFilename);
     cowFilename = cp.getCptDir() + "/" + cowFilename;
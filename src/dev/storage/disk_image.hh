@@ -33,7 +33,9 @@
 #ifndef __DEV_STORAGE_DISK_IMAGE_HH__
 #define __DEV_STORAGE_DISK_IMAGE_HH__
 
+#include <bitset>
 #include <fstream>
+#include <memory>
 #include <unordered_map>
 
 #include "params/CowDiskImage.hh"
@@ -65,18 +67,46 @@ class DiskImage : public SimObject
                                 std::streampos offset) const = 0;
     virtual std::streampos write(const uint8_t *data,
                                  std::streampos offset) = 0;
+
+    /**
+     * Read count consecutive sectors starting at sector offset. The
+     * default implementation issues one single-sector read per sector;
+     * images that can transfer larger blocks override it.
+     *
+     * @return The number of bytes read.
+     */
+    virtual std::streampos readSectors(uint8_t *data, std::streampos offset,
+                                       size_t count) const;
+
+    /**
+     * Write count consecutive sectors starting at sector offset.
+     *
+     * @return The number of bytes written.
+     */
+    virtual std::streampos writeSectors(const uint8_t *data,
+                                        std::streampos offset, size_t count);
 };
 
 /**
- * Specialization for accessing a raw disk image
+ * Specialization for accessing a raw disk image. The image file is
+ * mapped into the simulator's address space so that accesses of any
+ * number of sectors turn into a single memcpy. Writes land in the host
+ * page cache and are written back to the file asynchronously by the
+ * host kernel. If the file cannot be mapped (e.g., it is empty), the
+ * image falls back to positioned reads and writes on the descriptor.
  */
 class RawDiskImage : public DiskImage
 {
   protected:
-    mutable std::fstream stream;
+    int fd;
     std::string file;
     bool readonly;
-    mutable std::streampos disk_size;
+    uint64_t disk_size;
+
+    /** Host mapping of the image file, nullptr if not mapped. */
+    uint8_t *mapping;
+    /** Size of the host mapping in bytes. */
+    uint64_t mapSize;
 
   public:
     typedef RawDiskImageParams Params;
@@ -92,6 +122,11 @@ class RawDiskImage : public DiskImage
 
     std::streampos read(uint8_t *data, std::streampos offset) const override;
     std::streampos write(const uint8_t *data, std::streampos offset) override;
+
+    std::streampos readSectors(uint8_t *data, std::streampos offset,
+                               size_t count) const override;
+    std::streampos writeSectors(const uint8_t *data, std::streampos offset,
+                                size_t count) override;
 };
 
 /**
@@ -103,24 +138,69 @@ class RawDiskImage : public DiskImage
  * This object is designed to provide a mechanism for persistant
  * changes to a main disk image, or to provide a place for temporary
  * changes to the image to take place that later may be thrown away.
+ *
+ * Overlay sectors are grouped in aligned pages, each holding a bitmap
+ * of the sectors that shadow the child image. When incremental
+ * checkpointing is enabled, sectors written since the previous
+ * checkpoint are appended to a log file in the output directory. Each
+ * checkpoint links to (or copies) that log and records its length,
+ * rather than saving the whole overlay every time.
  */
 class CowDiskImage : public DiskImage
 {
   public:
     static const uint32_t VersionMajor;
     static const uint32_t VersionMinor;
+    static const uint32_t LogVersionMajor;
+    static const uint32_t LogVersionMinor;
 
   protected:
-    struct Sector
+    /** Number of sectors in an overlay page (4 KiB of data). */
+    static const int SectorsPerPage = 8;
+
+    struct Page
     {
-        uint8_t data[SectorSize];
+        /** Sectors present in the overlay. */
+        std::bitset<SectorsPerPage> valid;
+        /** Sectors not yet appended to the checkpoint log. */
+        std::bitset<SectorsPerPage> dirty;
+        uint8_t data[SectorsPerPage * SectorSize];
     };
-    typedef std::unordered_map<uint64_t, Sector *> SectorTable;
+    typedef std::unordered_map<uint64_t, std::unique_ptr<Page>> SectorTable;
 
   protected:
     std::string filename;
     DiskImage *child;
     SectorTable *table;
+    /** Number of valid sectors in the overlay. */
+    uint64_t sectorCount;
+
+    /** Append dirty sectors to a log at checkpoint time. */
+    bool incremental;
+    /** Path of the working log in the output directory. */
+    std::string logName;
+    /** Number of bytes appended to the checkpoint log so far. */
+    mutable uint64_t logSize;
+
+    /** Last page looked up, to speed up sequential accesses. */
+    mutable uint64_t lastPageNum;
+    mutable Page *lastPage;
+
+    Page *findPage(uint64_t page_num) const;
+    Page *allocPage(uint64_t page_num);
+    void insertSector(uint64_t offset, const uint8_t *data);
+
+    /**
+     * Load sectors from a COW image or log file.
+     *
+     * @param file File to read.
+     * @param limit Number of bytes of a log file to replay, 0 to
+     *              replay the whole file.
+     */
+    void load(const std::string &file, uint64_t limit = 0);
+
+    /** Append all dirty sectors to the checkpoint log. */
+    void appendLog() const;
 
   public:
     typedef CowDiskImageParams Params;
@@ -142,6 +222,11 @@ class CowDiskImage : public DiskImage
 
     std::streampos read(uint8_t *data, std::streampos offset) const override;
     std::streampos write(const uint8_t *data, std::streampos offset) override;
+
+    std::streampos readSectors(uint8_t *data, std::streampos offset,
+                               size_t count) const override;
+    std::streampos writeSectors(const uint8_t *data, std::streampos offset,
+                                size_t count) override;
 };
 
 void SafeRead(std::ifstream &stream, void *data, int count);
@@ -48,3 +48,15 @@ class VirtIOBlock(VirtIODeviceBase):
     queueSize = Param.Unsigned(128, "Output queue size (pages)")
 
     image = Param.DiskImage("Disk image")
+
+    latency = Param.Latency(
+        "0ns",
+        "Time from a request being submitted until it completes. Requests "
+        "overlap, so several of them can be outstanding at once.",
+    )
+    useBackdoor = Param.Bool(
+        False,
+        "Access guest buffers directly through memory backdoors. This "
+        "bypasses the cache hierarchy and is only safe when caches cannot "
+        "hold dirty data for the buffers, e.g., with KVM CPUs.",
+    )
@@ -212,6 +212,14 @@ class VirtDescriptor
      */
     size_t size() const { return desc.len; }
 
+    /**
+     * Retrieve the guest physical address of this descriptor's
+     * buffer.
+     *
+     * @return Address of the buffer in guest memory.
+     */
+    Addr addr() const { return desc.addr; }
+
     /**
      * Is this descriptor chained to another descriptor?
      *
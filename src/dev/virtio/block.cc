@@ -37,6 +37,9 @@
 
 #include "dev/virtio/block.hh"
 
+#include <algorithm>
+#include <cstring>
+
 #include "debug/VIOBlock.hh"
 #include "params/VirtIOBlock.hh"
 #include "sim/system.hh"
@@ -48,7 +51,12 @@ VirtIOBlock::VirtIOBlock(const Params &params)
     : VirtIODeviceBase(params, ID_BLOCK, sizeof(Config), 0),
       qRequests(params.system->physProxy, byteOrder,
                 params.queueSize, *this),
-      image(*params.image)
+      image(*params.image),
+      systemPort(params.system->getSystemPort()),
+      useBackdoor(params.useBackdoor),
+      latency(params.latency),
+      unsignalled(0),
+      completeEvent([this]{ completeRequests(); }, name())
 {
     registerQueue(qRequests);
 
@@ -69,11 +77,32 @@ VirtIOBlock::readConfig(PacketPtr pkt, Addr cfgOffset)
     readConfigBlob(pkt, cfgOffset, (uint8_t *)&cfg_out);
 }
 
+DrainState
+VirtIOBlock::drain()
+{
+    return pending.empty() ? DrainState::Drained : DrainState::Draining;
+}
+
+void
+VirtIOBlock::reset()
+{
+    // Requests still waiting for their latency belong to the queue
+    // being reset, so they must never be completed.
+    if (completeEvent.scheduled())
+        deschedule(completeEvent);
+    pending.clear();
+    unsignalled = 0;
+
+    VirtIODeviceBase::reset();
+
+    if (drainState() == DrainState::Draining)
+        signalDrainDone();
+}
+
 VirtIOBlock::Status
 VirtIOBlock::read(const BlkRequest &req, VirtDescriptor *desc_chain,
                   size_t off_data, size_t size)
 {
-    std::vector<uint8_t> data(size);
     uint64_t sector(req.sector);
 
     DPRINTF(VIOBlock, "Read request starting @ sector %i (size: %i)\n",
@@ -82,15 +111,17 @@ VirtIOBlock::read(const BlkRequest &req, VirtDescriptor *desc_chain,
     if (size % SectorSize != 0)
         panic("Unexpected request/sector size relationship\n");
 
-    for (Addr offset = 0; offset < size; offset += SectorSize) {
-        if (image.read(&data[offset], sector) != SectorSize) {
-            warn("Failed to read sector %i\n", sector);
-            return S_IOERR;
-        }
-        ++sector;
+    if (buffer.size() < size)
+        buffer.resize(size);
+
+    if (image.readSectors(buffer.data(), sector, size / SectorSize) !=
+            (std::streamoff)size) {
+        warn("Failed to read sectors %i-%i\n", sector,
+             sector + size / SectorSize - 1);
+        return S_IOERR;
     }
 
-    desc_chain->chainWrite(off_data, &data[0], size);
+    chainCopy(desc_chain, off_data, buffer.data(), size, true);
 
     return S_OK;
 }
@@ -99,7 +130,6 @@ VirtIOBlock::Status
 VirtIOBlock::write(const BlkRequest &req, VirtDescriptor *desc_chain,
                   size_t off_data, size_t size)
 {
-    std::vector<uint8_t> data(size);
     uint64_t sector(req.sector);
 
     DPRINTF(VIOBlock, "Write request starting @ sector %i (size: %i)\n",
@@ -108,21 +138,145 @@ VirtIOBlock::write(const BlkRequest &req, VirtDescriptor *desc_chain,
     if (size % SectorSize != 0)
         panic("Unexpected request/sector size relationship\n");
 
+    if (buffer.size() < size)
+        buffer.resize(size);
 
-    desc_chain->chainRead(off_data, &data[0], size);
+    chainCopy(desc_chain, off_data, buffer.data(), size, false);
 
-    for (Addr offset = 0; offset < size; offset += SectorSize) {
-        if (image.write(&data[offset], sector) != SectorSize) {
-            warn("Failed to write sector %i\n", sector);
-            return S_IOERR;
-        }
-        ++sector;
+    if (image.writeSectors(buffer.data(), sector, size / SectorSize) !=
+            (std::streamoff)size) {
+        warn("Failed to write sectors %i-%i\n", sector,
+             sector + size / SectorSize - 1);
+        return S_IOERR;
     }
 
     return S_OK;
 
 }
 
+void
+VirtIOBlock::chainCopy(VirtDescriptor *desc_chain, size_t offset,
+                       uint8_t *buf, size_t size, bool to_guest)
+{
+    if (!useBackdoor) {
+        if (to_guest)
+            desc_chain->chainWrite(offset, buf, size);
+        else
+            desc_chain->chainRead(offset, buf, size);
+        return;
+    }
+
+    const size_t full_size(size);
+    VirtDescriptor *desc(desc_chain);
+    do {
+        if (offset < desc->size()) {
+            if (to_guest != desc->isOutgoing())
+                panic("Descriptor direction does not match request\n");
+
+            const size_t chunk_size(std::min(desc->size() - offset, size));
+            const Addr addr(desc->addr() + offset);
+            MemBackdoorPtr bd(
+                findBackdoor(RangeSize(addr, chunk_size), to_guest));
+            if (bd) {
+                uint8_t *host = bd->ptr() + (addr - bd->range().start());
+                if (to_guest)
+                    std::memcpy(host, buf, chunk_size);
+                else
+                    std::memcpy(buf, host, chunk_size);
+            } else if (to_guest) {
+                desc->write(offset, buf, chunk_size);
+            } else {
+                desc->read(offset, buf, chunk_size);
+            }
+            buf += chunk_size;
+            size -= chunk_size;
+            offset = 0;
+        } else {
+            offset -= desc->size();
+        }
+    } while ((desc = desc->next()) != NULL && size > 0);
+
+    if (size != 0) {
+        panic("Failed to copy %i bytes of chain of %i bytes @ offset %i\n",
+              full_size, desc_chain->chainSize(), offset);
+    }
+}
+
+MemBackdoorPtr
+VirtIOBlock::findBackdoor(const AddrRange &range, bool write)
+{
+    for (auto bd : backdoors) {
+        if (range.isSubset(bd->range()) &&
+                (write ? bd->writeable() : bd->readable())) {
+            return bd;
+        }
+    }
+
+    MemBackdoorReq req(range,
+            write ? MemBackdoor::Writeable : MemBackdoor::Readable);
+    MemBackdoorPtr bd = nullptr;
+    systemPort.sendMemBackdoorReq(req, bd);
+    if (!bd || !range.isSubset(bd->range()) ||
+            !(write ? bd->writeable() : bd->readable())) {
+        return nullptr;
+    }
+
+    DPRINTF(VIOBlock, "Using backdoor for %s\n", bd->range().to_string());
+    backdoors.push_back(bd);
+    bd->addInvalidationCallback([this](const MemBackdoor &backdoor) {
+        backdoors.remove_if([&backdoor](MemBackdoorPtr b) {
+            return b == &backdoor;
+        });
+    });
+    return bd;
+}
+
+void
+VirtIOBlock::requestDone(VirtDescriptor *desc, uint32_t len)
+{
+    if (latency == 0) {
+        qRequests.produceDescriptor(desc, len);
+        ++unsignalled;
+        return;
+    }
+
+    pending.push_back({desc, len, curTick() + latency});
+    if (!completeEvent.scheduled())
+        schedule(completeEvent, pending.front().when);
+}
+
+void
+VirtIOBlock::completeRequests()
+{
+    // Requests share a fixed latency, so they complete in the order
+    // they were submitted. Notify the guest once for all requests
+    // that complete together.
+    while (!pending.empty() && pending.front().when <= curTick()) {
+        const PendingRequest &req(pending.front());
+        qRequests.produceDescriptor(req.desc, req.len);
+        pending.pop_front();
+    }
+    kick();
+
+    if (!pending.empty())
+        schedule(completeEvent, pending.front().when);
+    else if (drainState() == DrainState::Draining)
+        signalDrainDone();
+}
+
+void
+VirtIOBlock::RequestQueue::onNotify()
+{
+    VirtQueue::onNotify();
+
+    // Notify the guest once for all requests that completed
+    // immediately.
+    if (parent.unsignalled) {
+        parent.unsignalled = 0;
+        parent.kick();
+    }
+}
+
 void
 VirtIOBlock::RequestQueue::onNotifyDescriptor(VirtDescriptor *desc)
 {
@@ -164,8 +318,8 @@ VirtIOBlock::RequestQueue::onNotifyDescriptor(VirtDescriptor *desc)
                      &status, sizeof(status));
 
     // Tell the guest that we are done with this descriptor.
-    produceDescriptor(desc, sizeof(BlkRequest) + data_size + sizeof(Status));
-    parent.kick();
+    parent.requestDone(desc,
+                       sizeof(BlkRequest) + data_size + sizeof(Status));
 }
 
 } // namespace gem5
@@ -38,9 +38,15 @@
 #ifndef __DEV_VIRTIO_BLOCK_HH__
 #define __DEV_VIRTIO_BLOCK_HH__
 
+#include <deque>
+#include <list>
+#include <vector>
+
 #include "base/compiler.hh"
 #include "dev/storage/disk_image.hh"
 #include "dev/virtio/base.hh"
+#include "mem/backdoor.hh"
+#include "sim/eventq.hh"
 
 namespace gem5
 {
@@ -76,6 +82,10 @@ class VirtIOBlock : public VirtIODeviceBase
 
     void readConfig(PacketPtr pkt, Addr cfgOffset);
 
+    DrainState drain() override;
+
+    void reset() override;
+
   protected:
     static const DeviceId ID_BLOCK = 0x02;
 
@@ -159,6 +169,38 @@ class VirtIOBlock : public VirtIODeviceBase
     Status write(const BlkRequest &req, VirtDescriptor *desc_chain,
                  size_t off_data, size_t size);
 
+    /**
+     * Copy request data between a staging buffer and the guest buffers
+     * of a descriptor chain. Guest buffers are accessed directly
+     * through a memory backdoor when one is available, and through
+     * functional accesses otherwise.
+     *
+     * @param desc_chain Request descriptor chain.
+     * @param offset Offset into the descriptor chain.
+     * @param buf Staging buffer.
+     * @param size Number of bytes to copy.
+     * @param to_guest True to copy from buf into the guest.
+     */
+    void chainCopy(VirtDescriptor *desc_chain, size_t offset, uint8_t *buf,
+                   size_t size, bool to_guest);
+
+    /**
+     * Find a backdoor covering a range of guest memory, requesting a
+     * new one from the memory system if necessary.
+     *
+     * @return The backdoor or nullptr if none could be found.
+     */
+    MemBackdoorPtr findBackdoor(const AddrRange &range, bool write);
+
+    /**
+     * Hand a processed request back to the guest, either immediately
+     * or once the request latency has elapsed.
+     */
+    void requestDone(VirtDescriptor *desc, uint32_t len);
+
+    /** Return all requests whose latency has elapsed to the guest. */
+    void completeRequests();
+
   protected:
     /**
      * Virtqueue for disk requests.
@@ -172,6 +214,7 @@ class VirtIOBlock : public VirtIODeviceBase
             : VirtQueue(proxy, bo, size), parent(_parent) {}
         virtual ~RequestQueue() {}
 
+        void onNotify() override;
         void onNotifyDescriptor(VirtDescriptor *desc);
 
         std::string name() const { return parent.name() + ".qRequests"; }
@@ -185,6 +228,33 @@ class VirtIOBlock : public VirtIODeviceBase
 
     /** Image backing this device */
     DiskImage &image;
+
+    /** Staging buffer for request data */
+    std::vector<uint8_t> buffer;
+
+    /** Port used to request backdoors to guest memory */
+    RequestPort &systemPort;
+    /** Access guest buffers through memory backdoors if possible */
+    const bool useBackdoor;
+    /** Backdoors to guest memory handed out by the memory system */
+    std::list<MemBackdoorPtr> backdoors;
+
+    /** Time between a request being submitted and it completing */
+    const Tick latency;
+
+    /** Request waiting for its latency to elapse */
+    struct PendingRequest
+    {
+        VirtDescriptor *desc;
+        uint32_t len;
+        Tick when;
+    };
+    /** Outstanding requests, in completion order */
+    std::deque<PendingRequest> pending;
+    /** Number of requests produced without notifying the guest yet */
+    unsigned unsignalled;
+
+    EventFunctionWrapper completeEvent;
 };
 
 } // namespace gem5
@@ -214,6 +214,12 @@ class ComputeUnit(ClockedObject):
         "Scale how long an mfma consumes the matrix core unit. "
         "Multiplied into mfma cycle count in scoreboard stage",
     )
+    sleep_on_stall = Param.Bool(
+        False,
+        "Stop ticking the CU while every wavefront waits on a memory "
+        "response, barrier, or fetch, and restart it when one arrives. "
+        "Per-cycle pipeline stall stats are not sampled while asleep",
+    )
     system = Param.System(Parent.any, "system object")
     cu_id = Param.Int("CU id")
     vrf_to_coalescer_bus_width = Param.Int(
@@ -330,6 +336,21 @@ class Shader(ClockedObject):
         "value in most cases. Set to 0 to disable.",
     )
 
+    def distributeCUs(self, num_queues):
+        """Spread the compute units round-robin over event queues
+        1..num_queues so they are simulated on separate host threads.
+        Each CU's LDS and LDS bridge go on the CU's queue as they are
+        only used by that CU. Everything else (the shader, dispatcher,
+        TLBs, and caches) stays on the shader's queue, and the CU ports
+        migrate to it whenever they call across. The caller must also
+        set root.sim_quantum; it bounds how far the CUs and the memory
+        system may drift apart and should not exceed the CU-to-L1
+        latency."""
+        for i, cu in enumerate(self.CUs):
+            cu.eventq_index = 1 + i % num_queues
+            cu.ldsBus.eventq_index = cu.eventq_index
+            cu.localDataStore.eventq_index = cu.eventq_index
+
 
 class GPUComputeDriver(EmulatedDriver):
     type = "GPUComputeDriver"
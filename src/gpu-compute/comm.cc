@@ -31,6 +31,7 @@
 
 #include "gpu-compute/comm.hh"
 
+#include <algorithm>
 #include <cassert>
 
 #include "gpu-compute/wavefront.hh"
@@ -90,13 +91,10 @@ ScoreboardCheckToSchedule::updateReadyList(int func_unit_id)
 {
     std::vector<Wavefront*> &func_unit_wf_list = _readyWFs[func_unit_id];
 
-    for (auto it = func_unit_wf_list.begin(); it != func_unit_wf_list.end();) {
-        if ((*it)->instructionBuffer.empty()) {
-            it = func_unit_wf_list.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    func_unit_wf_list.erase(std::remove_if(func_unit_wf_list.begin(),
+        func_unit_wf_list.end(),
+        [](Wavefront *wf) { return wf->instructionBuffer.empty(); }),
+        func_unit_wf_list.end());
 }
 
 /**
@@ -186,6 +186,8 @@ ComputeUnit::ComputeUnit(const Params &p) : ClockedObject(p),
     _cacheLineSize(p.system->cacheLineSize()),
     _numBarrierSlots(p.num_barrier_slots),
     globalSeqNum(0), wavefrontSize(p.wf_size),
+    sleepOnStall(p.sleep_on_stall), stalledAsleep(false),
+    stallSleepCycle(0),
     scoreboardCheckToSchedule(p),
     scheduleToExecute(p),
     stats(this, p.n_wf)
@@ -254,6 +256,10 @@ ComputeUnit::ComputeUnit(const Params &p) : ClockedObject(p),
     lastVaddrCU.resize(wfSize());
 
     lds.setParent(this);
+    // The LDS port sends straight into the LDS, so it must run on the
+    // same event queue as this CU
+    fatal_if(lds.eventQueue() != eventQueue(),
+             "The LDS of %s must be on the CU's event queue\n", name());
 
     if (p.execPolicy == "OLDEST-FIRST") {
         exec_policy = EXEC_POLICY::OLDEST;
@@ -452,7 +458,7 @@ ComputeUnit::startWavefront(Wavefront *w, int waveId, LdsChunk *ldsChunk,
     DPRINTF(GPUDisp, "CU%d: increase ref ctr wg[%d] to [%d]\n",
                     cu_id, w->wgId, refCount);
 
-    w->instructionBuffer.clear();
+    w->flushInstBuffer();
 
     if (w->pendingFetch)
         w->dropFetch = true;
@@ -622,6 +628,7 @@ ComputeUnit::insertInPipeMap(Wavefront *w)
              "Instruction Buffer of WF%d can't be empty", w->wgId);
     GPUDynInstPtr ii = w->instructionBuffer.front();
     pipeMap.emplace(ii->seqNum());
+    scoreboardCheckStage.wakeWave(w);
 }
 
 void
@@ -634,6 +641,7 @@ ComputeUnit::deleteFromPipeMap(Wavefront *w)
     auto it = pipeMap.find(ii->seqNum());
     panic_if(it == pipeMap.end(), "Pipeline Map is empty\n");
     pipeMap.erase(it);
+    scoreboardCheckStage.wakeWave(w);
 }
 
 bool
@@ -839,6 +847,16 @@ ComputeUnit::releaseWFsFromBarrier(int bar_id)
 void
 ComputeUnit::exec()
 {
+    if (stalledAsleep) {
+        // account for the cycles skipped while asleep as if the CU had
+        // been ticked through them
+        Cycles skipped = curCycle() - stallSleepCycle - Cycles(1);
+        stats.totalCycles += skipped;
+        stats.stallSleepCycles += skipped;
+        execCycles += skipped;
+        stalledAsleep = false;
+    }
+
     // process reads and writes in the RFs
     for (auto &vecRegFile : vrf) {
         vecRegFile->exec();
@@ -869,13 +887,47 @@ ComputeUnit::exec()
 
     // Put this CU to sleep if there is no more work to be done.
     if (!isDone()) {
-        schedule(tickEvent, nextCycle());
+        if (sleepOnStall && isStalled()) {
+            // wakeFromStall() restarts the tick on the next response
+            stalledAsleep = true;
+            stallSleepCycle = curCycle();
+            DPRINTF(GPUDisp, "CU%d: All waves stalled, sleeping\n", cu_id);
+        } else {
+            schedule(tickEvent, nextCycle());
+        }
     } else {
         shader->notifyCuSleep();
         DPRINTF(GPUDisp, "CU%d: Going to sleep\n", cu_id);
     }
 }
 
+bool
+ComputeUnit::isStalled()
+{
+    if (!scoreboardCheckStage.wavesStalled() || !scheduleStage.idle() ||
+        !globalMemoryPipe.idle() || !localMemoryPipe.idle() ||
+        !scalarMemoryPipe.idle() || !fetchStage.idle()) {
+        return false;
+    }
+
+    for (int i = 0; i < numExeUnits(); ++i) {
+        if (scheduleToExecute.dispatchStatus(i) != EMPTY) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void
+ComputeUnit::wakeFromStall()
+{
+    if (stalledAsleep && !tickEvent.scheduled()) {
+        DPRINTF(GPUDisp, "CU%d: Waking from stall\n", cu_id);
+        schedule(tickEvent, nextCycle());
+    }
+}
+
 void
 ComputeUnit::init()
 {
@@ -918,6 +970,7 @@ ComputeUnit::init()
     scalarRegsReserved.resize(numVectorALUs, 0);
 
     fetchStage.init();
+    scoreboardCheckStage.init();
     scheduleStage.init();
     execStage.init();
     globalMemoryPipe.init();
@@ -925,6 +978,28 @@ ComputeUnit::init()
     gmTokenPort.setTokenManager(memPortTokens);
 }
 
+EventQueue *
+ComputeUnit::memSideEventQueue() const
+{
+    return shader->eventQueue();
+}
+
+bool
+ComputeUnit::MemSidePort::sendMemSideTimingReq(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(cu->memSideEventQueue(),
+                                        inParallelMode);
+    return RequestPort::sendTimingReq(pkt);
+}
+
+void
+ComputeUnit::MemSidePort::sendMemSideFunctional(PacketPtr pkt) const
+{
+    EventQueue::ScopedMigration migrate(cu->memSideEventQueue(),
+                                        inParallelMode);
+    RequestPort::sendFunctional(pkt);
+}
+
 bool
 ComputeUnit::DataPort::recvTimingResp(PacketPtr pkt)
 {
@@ -934,6 +1009,10 @@ ComputeUnit::DataPort::recvTimingResp(PacketPtr pkt)
 bool
 ComputeUnit::DataPort::handleResponse(PacketPtr pkt)
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
+
     // Ruby has completed the memory op. Schedule the mem_resp_event at the
     // appropriate cycle to process the timing memory response
     // This delay represents the pipeline delay
@@ -1060,6 +1139,10 @@ ComputeUnit::ScalarDataPort::recvTimingResp(PacketPtr pkt)
 bool
 ComputeUnit::ScalarDataPort::handleResponse(PacketPtr pkt)
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
+
     // From scalar cache invalidate that was issued at kernel start.
     if (pkt->req->isKernel()) {
         delete pkt->senderState;
@@ -1106,8 +1189,12 @@ ComputeUnit::ScalarDataPort::handleResponse(PacketPtr pkt)
 void
 ComputeUnit::ScalarDataPort::recvReqRetry()
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
+
     for (const auto &pkt : retries) {
-        if (!sendTimingReq(pkt)) {
+        if (!sendMemSideTimingReq(pkt)) {
             break;
         } else {
             retries.pop_front();
@@ -1118,6 +1205,10 @@ ComputeUnit::ScalarDataPort::recvReqRetry()
 void
 ComputeUnit::DataPort::recvReqRetry()
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
+
     int len = retries.size();
 
     assert(len > 0);
@@ -1132,7 +1223,7 @@ ComputeUnit::DataPort::recvReqRetry()
         /** Currently Ruby can return false due to conflicts for the particular
          *  cache block or address.  Thus other requests should be allowed to
          *  pass and the data port should expect multiple retries. */
-        if (!sendTimingReq(pkt)) {
+        if (!sendMemSideTimingReq(pkt)) {
             DPRINTF(GPUMem, "failed again!\n");
             break;
         } else {
@@ -1145,6 +1236,10 @@ ComputeUnit::DataPort::recvReqRetry()
 bool
 ComputeUnit::SQCPort::recvTimingResp(PacketPtr pkt)
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
+
     SenderState *sender_state = safe_cast<SenderState*>(pkt->senderState);
     /** Process the response only if there is a wavefront associated with it.
      * Otherwise, it is from SQC invalidate that was issued at kernel start
@@ -1181,6 +1276,10 @@ ComputeUnit::handleSQCReturn(PacketPtr pkt)
 void
 ComputeUnit::SQCPort::recvReqRetry()
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
+
     int len = retries.size();
 
     assert(len > 0);
@@ -1191,7 +1290,7 @@ ComputeUnit::SQCPort::recvReqRetry()
         DPRINTF(GPUFetch, "CU%d: WF[%d][%d]: retrying FETCH addr %#x\n",
                 computeUnit->cu_id, wavefront->simdId, wavefront->wfSlotId,
                 pkt->req->getPaddr());
-        if (!sendTimingReq(pkt)) {
+        if (!sendMemSideTimingReq(pkt)) {
             DPRINTF(GPUFetch, "failed again!\n");
             break;
         } else {
@@ -1210,12 +1309,14 @@ ComputeUnit::SQCPort::MemReqEvent::description() const
 void
 ComputeUnit::SQCPort::MemReqEvent::process()
 {
+    sqcPort.computeUnit->wakeFromStall();
+
     SenderState *sender_state = safe_cast<SenderState*>(pkt->senderState);
     [[maybe_unused]] ComputeUnit *compute_unit = sqcPort.computeUnit;
 
     assert(!pkt->req->systemReq());
 
-    if (!(sqcPort.sendTimingReq(pkt))) {
+    if (!(sqcPort.sendMemSideTimingReq(pkt))) {
         sqcPort.retries.push_back(std::pair<PacketPtr, Wavefront*>
                 (pkt, sender_state->wavefront));
     }
@@ -1304,7 +1405,7 @@ ComputeUnit::sendRequest(GPUDynInstPtr gpuDynInst, PortID index, PacketPtr pkt)
         pkt->senderState = translation_state;
 
         if (functionalTLB) {
-            tlbPort[tlbPort_index].sendFunctional(pkt);
+            tlbPort[tlbPort_index].sendMemSideFunctional(pkt);
 
             // update the hitLevel distribution
             int hit_level = translation_state->hitLevel;
@@ -1362,7 +1463,7 @@ ComputeUnit::sendRequest(GPUDynInstPtr gpuDynInst, PortID index, PacketPtr pkt)
                     gpuDynInst->wfSlotId, tmp_vaddr);
 
             tlbPort[tlbPort_index].retries.push_back(pkt);
-        } else if (!tlbPort[tlbPort_index].sendTimingReq(pkt)) {
+        } else if (!tlbPort[tlbPort_index].sendMemSideTimingReq(pkt)) {
             // Stall the data port;
             // No more packet will be issued till
             // ruby indicates resources are freed by
@@ -1394,7 +1495,7 @@ ComputeUnit::sendRequest(GPUDynInstPtr gpuDynInst, PortID index, PacketPtr pkt)
         pkt->senderState = new GpuTranslationState(TLB_mode,
                                                                 shader->gpuTc);
 
-        tlbPort[tlbPort_index].sendFunctional(pkt);
+        tlbPort[tlbPort_index].sendMemSideFunctional(pkt);
 
         // the addr of the packet is not modified, so we need to create a new
         // packet, or otherwise the memory access will have the old virtual
@@ -1404,7 +1505,7 @@ ComputeUnit::sendRequest(GPUDynInstPtr gpuDynInst, PortID index, PacketPtr pkt)
         new_pkt->dataStatic(pkt->getPtr<uint8_t>());
 
         // Translation is done. It is safe to send the packet to memory.
-        memPort[0].sendFunctional(new_pkt);
+        memPort[0].sendMemSideFunctional(new_pkt);
 
         DPRINTF(GPUMem, "Functional sendRequest\n");
         DPRINTF(GPUMem, "CU%d: WF[%d][%d]: index %d: addr %#x\n", cu_id,
@@ -1439,7 +1540,7 @@ ComputeUnit::sendScalarRequest(GPUDynInstPtr gpuDynInst, PacketPtr pkt)
     if (scalarDTLBPort.isStalled()) {
         assert(scalarDTLBPort.retries.size());
         scalarDTLBPort.retries.push_back(pkt);
-    } else if (!scalarDTLBPort.sendTimingReq(pkt)) {
+    } else if (!scalarDTLBPort.sendMemSideTimingReq(pkt)) {
         scalarDTLBPort.stallPort();
         scalarDTLBPort.retries.push_back(pkt);
     } else {
@@ -1551,6 +1652,8 @@ ComputeUnit::sendInvL2(Addr paddr)
 void
 ComputeUnit::DataPort::processMemRespEvent(PacketPtr pkt)
 {
+    computeUnit->wakeFromStall();
+
     DataPort::SenderState *sender_state =
         safe_cast<DataPort::SenderState*>(pkt->senderState);
 
@@ -1633,6 +1736,10 @@ ComputeUnit::DataPort::processMemRespEvent(PacketPtr pkt)
 bool
 ComputeUnit::DTLBPort::recvTimingResp(PacketPtr pkt)
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
+
     Addr line = pkt->req->getPaddr();
 
     DPRINTF(GPUTLB, "CU%d: DTLBPort received %#x->%#x\n", computeUnit->cu_id,
@@ -1762,7 +1869,7 @@ ComputeUnit::DTLBPort::recvTimingResp(PacketPtr pkt)
                     computeUnit->shader->gpuTc, true);
 
             // Currently prefetches are zero-latency, hence the sendFunctional
-            sendFunctional(prefetch_pkt);
+            sendMemSideFunctional(prefetch_pkt);
 
             /* safe_cast the senderState */
             GpuTranslationState *tlb_state =
@@ -1840,6 +1947,8 @@ ComputeUnit::DataPort::createMemRespEvent(PacketPtr pkt)
 void
 ComputeUnit::DataPort::processMemReqEvent(PacketPtr pkt)
 {
+    computeUnit->wakeFromStall();
+
     SenderState *sender_state = safe_cast<SenderState*>(pkt->senderState);
     GPUDynInstPtr gpuDynInst = sender_state->_gpuDynInst;
     [[maybe_unused]] ComputeUnit *compute_unit = computeUnit;
@@ -1848,7 +1957,7 @@ ComputeUnit::DataPort::processMemReqEvent(PacketPtr pkt)
         assert(compute_unit->shader->systemHub);
         SystemHubEvent *resp_event = new SystemHubEvent(pkt, this);
         compute_unit->shader->systemHub->sendRequest(pkt, resp_event);
-    } else if (!(sendTimingReq(pkt))) {
+    } else if (!(sendMemSideTimingReq(pkt))) {
         retries.emplace_back(pkt, gpuDynInst);
 
         if (gpuDynInst) {
@@ -1877,6 +1986,8 @@ ComputeUnit::ScalarDataPort::MemReqEvent::description() const
 void
 ComputeUnit::ScalarDataPort::MemReqEvent::process()
 {
+    scalarDataPort.computeUnit->wakeFromStall();
+
     SenderState *sender_state = safe_cast<SenderState*>(pkt->senderState);
     GPUDynInstPtr gpuDynInst = sender_state->_gpuDynInst;
     [[maybe_unused]] ComputeUnit *compute_unit = scalarDataPort.computeUnit;
@@ -1885,7 +1996,7 @@ ComputeUnit::ScalarDataPort::MemReqEvent::process()
         assert(compute_unit->shader->systemHub);
         SystemHubEvent *resp_event = new SystemHubEvent(pkt, &scalarDataPort);
         compute_unit->shader->systemHub->sendRequest(pkt, resp_event);
-    } else if (!(scalarDataPort.sendTimingReq(pkt))) {
+    } else if (!(scalarDataPort.sendMemSideTimingReq(pkt))) {
         scalarDataPort.retries.emplace_back(pkt);
 
         DPRINTF(GPUPort,
@@ -1910,6 +2021,10 @@ ComputeUnit::ScalarDataPort::MemReqEvent::process()
 void
 ComputeUnit::DTLBPort::recvReqRetry()
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
+
     int len = retries.size();
 
     DPRINTF(GPUTLB, "CU%d: DTLB recvReqRetry - %d pending requests\n",
@@ -1926,7 +2041,7 @@ ComputeUnit::DTLBPort::recvReqRetry()
         [[maybe_unused]] Addr vaddr = pkt->req->getVaddr();
         DPRINTF(GPUTLB, "CU%d: retrying D-translaton for address%#x", vaddr);
 
-        if (!sendTimingReq(pkt)) {
+        if (!sendMemSideTimingReq(pkt)) {
             // Stall port
             stallPort();
             DPRINTF(GPUTLB, ": failed again\n");
@@ -1941,6 +2056,10 @@ ComputeUnit::DTLBPort::recvReqRetry()
 bool
 ComputeUnit::ScalarDTLBPort::recvTimingResp(PacketPtr pkt)
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
+
     assert(pkt->senderState);
 
     GpuTranslationState *translation_state =
@@ -2012,6 +2131,10 @@ ComputeUnit::ScalarDTLBPort::recvTimingResp(PacketPtr pkt)
 bool
 ComputeUnit::ITLBPort::recvTimingResp(PacketPtr pkt)
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
+
     [[maybe_unused]] Addr line = pkt->req->getPaddr();
     DPRINTF(GPUTLB, "CU%d: ITLBPort received %#x->%#x\n",
             computeUnit->cu_id, pkt->req->getVaddr(), line);
@@ -2065,6 +2188,9 @@ ComputeUnit::ITLBPort::recvTimingResp(PacketPtr pkt)
 void
 ComputeUnit::ITLBPort::recvReqRetry()
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
 
     int len = retries.size();
     DPRINTF(GPUTLB, "CU%d: ITLB recvReqRetry - %d pending requests\n", len);
@@ -2081,7 +2207,7 @@ ComputeUnit::ITLBPort::recvReqRetry()
         [[maybe_unused]] Addr vaddr = pkt->req->getVaddr();
         DPRINTF(GPUTLB, "CU%d: retrying I-translaton for address%#x", vaddr);
 
-        if (!sendTimingReq(pkt)) {
+        if (!sendMemSideTimingReq(pkt)) {
             stallPort(); // Stall port
             DPRINTF(GPUTLB, ": failed again\n");
             break;
@@ -2106,8 +2232,7 @@ ComputeUnit::updateInstStats(GPUDynInstPtr gpuDynInst)
         }
     } else {
         if (gpuDynInst->isALU()) {
-            shader->total_valu_insts++;
-            if (shader->total_valu_insts == shader->max_valu_insts) {
+            if (++shader->total_valu_insts == shader->max_valu_insts) {
                 exitSimLoop("max vALU insts");
             }
             stats.vALUInsts++;
@@ -2338,6 +2463,10 @@ ComputeUnit::printProgress()
 bool
 ComputeUnit::LDSPort::recvTimingResp(PacketPtr packet)
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
+
     const ComputeUnit::LDSPort::SenderState *senderState =
         dynamic_cast<ComputeUnit::LDSPort::SenderState *>(packet->senderState);
 
@@ -2402,6 +2531,10 @@ ComputeUnit::LDSPort::sendTimingReq(PacketPtr pkt)
 void
 ComputeUnit::LDSPort::recvReqRetry()
 {
+    EventQueue::ScopedMigration migrate(computeUnit->eventQueue(),
+                                        inParallelMode);
+    computeUnit->wakeFromStall();
+
     auto queueSize = retries.size();
 
     DPRINTF(GPUPort, "CU%d: LDSPort recvReqRetry - %d pending requests\n",
@@ -2587,6 +2720,8 @@ ComputeUnit::ComputeUnitStats::ComputeUnitStats(statistics::Group *parent,
       ADD_STAT(numVecOpsExecutedTwoOpFP,
                "number of two op FP vec ops executed (e.g. WF size/inst)"),
       ADD_STAT(totalCycles, "number of cycles the CU ran for"),
+      ADD_STAT(stallSleepCycles, "number of cycles the CU slept while all "
+               "wavefronts were stalled"),
       ADD_STAT(vpc, "Vector Operations per cycle (this CU only)"),
       ADD_STAT(vpc_f16, "F16 Vector Operations per cycle (this CU only)"),
       ADD_STAT(vpc_f32, "F32 Vector Operations per cycle (this CU only)"),
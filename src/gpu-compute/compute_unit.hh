@@ -482,6 +482,27 @@ class ComputeUnit : public ClockedObject
     bool isDone() const;
     bool isVectorAluIdle(uint32_t simdId) const;
 
+    /**
+     * True if no pipeline stage can make progress until an external
+     * event (a memory, TLB, or fetch response, or a port retry)
+     * arrives, in which case the CU may stop ticking.
+     */
+    bool isStalled();
+
+    /**
+     * Restart the tick event of a CU that went to sleep because all
+     * of its wavefronts were stalled. Called from every path that
+     * delivers an external event to the CU.
+     */
+    void wakeFromStall();
+
+    /**
+     * True if the CU still has work but is not ticking because all of
+     * its wavefronts are stalled. Such a CU is still active from the
+     * shader's point of view.
+     */
+    bool sleepingOnStall() const { return stalledAsleep; }
+
     void handleSQCReturn(PacketPtr pkt);
 
     void sendInvL2(Addr paddr);
@@ -530,12 +551,42 @@ class ComputeUnit : public ClockedObject
     TokenManager *memPortTokens;
     GMTokenPort gmTokenPort;
 
+    /**
+     * Event queue of the shader, the dispatcher, and the TLBs and
+     * caches the CU's ports connect to. It differs from eventQueue()
+     * only when the CUs are spread over several event queues to be
+     * simulated in parallel, in which case every call that crosses
+     * between the two migrates to the callee's queue.
+     */
+    EventQueue *memSideEventQueue() const;
+
+    /**
+     * A port to the shared memory side of the GPU. The CU sends
+     * through sendMemSideTimingReq() and sendMemSideFunctional(), which
+     * migrate to memSideEventQueue() so the peer always runs under its
+     * own queue's lock. They have their own names rather than hiding
+     * the RequestPort functions, which aren't virtual.
+     */
+    class MemSidePort : public RequestPort
+    {
+      public:
+        MemSidePort(const std::string &_name, ComputeUnit *_cu,
+                    PortID id=InvalidPortID)
+            : RequestPort(_name, id), cu(_cu) { }
+
+        bool sendMemSideTimingReq(PacketPtr pkt);
+        void sendMemSideFunctional(PacketPtr pkt) const;
+
+      private:
+        ComputeUnit *cu;
+    };
+
     /** Data access Port **/
-    class DataPort : public RequestPort
+    class DataPort : public MemSidePort
     {
       public:
         DataPort(const std::string &_name, ComputeUnit *_cu, PortID id)
-            : RequestPort(_name, id), computeUnit(_cu) { }
+            : MemSidePort(_name, _cu, id), computeUnit(_cu) { }
 
         bool snoopRangeSent;
 
@@ -610,11 +661,11 @@ class ComputeUnit : public ClockedObject
     };
 
     // Scalar data cache access port
-    class ScalarDataPort : public RequestPort
+    class ScalarDataPort : public MemSidePort
     {
       public:
         ScalarDataPort(const std::string &_name, ComputeUnit *_cu)
-            : RequestPort(_name), computeUnit(_cu)
+            : MemSidePort(_name, _cu), computeUnit(_cu)
         {
         }
 
@@ -681,11 +732,11 @@ class ComputeUnit : public ClockedObject
     };
 
     // Instruction cache access port
-    class SQCPort : public RequestPort
+    class SQCPort : public MemSidePort
     {
       public:
         SQCPort(const std::string &_name, ComputeUnit *_cu)
-            : RequestPort(_name), computeUnit(_cu) { }
+            : MemSidePort(_name, _cu), computeUnit(_cu) { }
 
         bool snoopRangeSent;
 
@@ -753,11 +804,11 @@ class ComputeUnit : public ClockedObject
      };
 
     /** Data TLB port **/
-    class DTLBPort : public RequestPort
+    class DTLBPort : public MemSidePort
     {
       public:
         DTLBPort(const std::string &_name, ComputeUnit *_cu, PortID id)
-            : RequestPort(_name, id), computeUnit(_cu),
+            : MemSidePort(_name, _cu, id), computeUnit(_cu),
               stalled(false)
         { }
 
@@ -800,11 +851,11 @@ class ComputeUnit : public ClockedObject
         virtual void recvReqRetry();
     };
 
-    class ScalarDTLBPort : public RequestPort
+    class ScalarDTLBPort : public MemSidePort
     {
       public:
         ScalarDTLBPort(const std::string &_name, ComputeUnit *_cu)
-            : RequestPort(_name), computeUnit(_cu), stalled(false)
+            : MemSidePort(_name, _cu), computeUnit(_cu), stalled(false)
         {
         }
 
@@ -828,11 +879,11 @@ class ComputeUnit : public ClockedObject
         bool stalled;
     };
 
-    class ITLBPort : public RequestPort
+    class ITLBPort : public MemSidePort
     {
       public:
         ITLBPort(const std::string &_name, ComputeUnit *_cu)
-            : RequestPort(_name), computeUnit(_cu), stalled(false) { }
+            : MemSidePort(_name, _cu), computeUnit(_cu), stalled(false) { }
 
 
         bool isStalled() { return stalled; }
@@ -1000,6 +1051,13 @@ class ComputeUnit : public ClockedObject
     int wavefrontSize;
     uint64_t execCycles;
 
+    // stop ticking while every wavefront waits on an external event
+    const bool sleepOnStall;
+    // the tick event is descheduled because the CU is stalled
+    bool stalledAsleep;
+    // cycle of the last tick before the CU went to sleep
+    Cycles stallSleepCycle;
+
     /**
      * TODO: Update these comments once the pipe stage interface has
      *       been fully refactored.
@@ -1177,6 +1235,8 @@ class ComputeUnit : public ClockedObject
         statistics::Scalar numVecOpsExecutedTwoOpFP;
         // Total cycles that something is running on the GPU
         statistics::Scalar totalCycles;
+        // Cycles the CU was not ticked because all waves were stalled
+        statistics::Scalar stallSleepCycles;
         statistics::Formula vpc; // vector ops per cycle
         statistics::Formula vpc_f16; // vector ops per cycle
         statistics::Formula vpc_f32; // vector ops per cycle
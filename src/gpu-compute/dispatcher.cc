@@ -247,6 +247,7 @@ GPUDispatcher::isReachingKernelEnd(Wavefront *wf)
  */
 void
 GPUDispatcher::updateInvCounter(int kern_id, int val) {
+    EventQueue::ScopedMigration migrate(eventQueue(), inParallelMode);
     assert(val == -1 || val == 1);
 
     auto task = hsaQueueEntries[kern_id];
@@ -267,6 +268,7 @@ GPUDispatcher::updateInvCounter(int kern_id, int val) {
  */
 bool
 GPUDispatcher::updateWbCounter(int kern_id, int val) {
+    EventQueue::ScopedMigration migrate(eventQueue(), inParallelMode);
     assert(val == -1 || val == 1);
 
     auto task = hsaQueueEntries[kern_id];
@@ -297,6 +299,8 @@ GPUDispatcher::getOutstandingWbs(int kernId) {
 void
 GPUDispatcher::notifyWgCompl(Wavefront *wf)
 {
+    // called by the CUs, which may run on other event queues
+    EventQueue::ScopedMigration migrate(eventQueue(), inParallelMode);
     int kern_id = wf->kernId;
     DPRINTF(GPUDisp, "notify WgCompl %d\n", wf->wgId);
     auto task = hsaQueueEntries[kern_id];
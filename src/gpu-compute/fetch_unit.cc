@@ -133,6 +133,30 @@ FetchUnit::exec()
     }
 }
 
+bool
+FetchUnit::idle()
+{
+    if (!fetchQueue.empty()) {
+        return false;
+    }
+
+    for (int j = 0; j < fetchBuf.size(); ++j) {
+        if (fetchBuf[j].canDecode()) {
+            return false;
+        }
+
+        Wavefront *wf = fetchStatusQueue[j].first;
+        if ((wf->getStatus() == Wavefront::S_RUNNING ||
+             wf->getStatus() == Wavefront::S_WAITCNT) &&
+            fetchBuf[j].hasFreeSpace() && !wf->stopFetch() &&
+            !wf->pendingFetch) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void
 FetchUnit::initiateFetch(Wavefront *wavefront)
 {
@@ -186,7 +210,7 @@ FetchUnit::initiateFetch(Wavefront *wavefront)
                     vaddr);
 
             computeUnit.sqcTLBPort.retries.push_back(pkt);
-        } else if (!computeUnit.sqcTLBPort.sendTimingReq(pkt)) {
+        } else if (!computeUnit.sqcTLBPort.sendMemSideTimingReq(pkt)) {
             // Stall the data port;
             // No more packet is issued till
             // ruby indicates resources are freed by
@@ -205,7 +229,7 @@ FetchUnit::initiateFetch(Wavefront *wavefront)
             new GpuTranslationState(BaseMMU::Execute,
                                                  computeUnit.shader->gpuTc);
 
-        computeUnit.sqcTLBPort.sendFunctional(pkt);
+        computeUnit.sqcTLBPort.sendMemSideFunctional(pkt);
 
         /**
          * For full system, if this is a device request we need to set the
@@ -286,7 +310,7 @@ FetchUnit::fetch(PacketPtr pkt, Wavefront *wavefront)
             SystemHubEvent *resp_event = new SystemHubEvent(pkt, this);
             assert(computeUnit.shader->systemHub);
             computeUnit.shader->systemHub->sendRequest(pkt, resp_event);
-        } else if (!computeUnit.sqcPort.sendTimingReq(pkt)) {
+        } else if (!computeUnit.sqcPort.sendMemSideTimingReq(pkt)) {
             computeUnit.sqcPort.retries.push_back(std::make_pair(pkt,
                                                                    wavefront));
 
@@ -299,7 +323,7 @@ FetchUnit::fetch(PacketPtr pkt, Wavefront *wavefront)
                     pkt->req->getPaddr());
         }
     } else {
-        computeUnit.sqcPort.sendFunctional(pkt);
+        computeUnit.sqcPort.sendMemSideFunctional(pkt);
         processFetchReturn(pkt);
     }
 }
@@ -515,6 +539,13 @@ FetchUnit::FetchBufDesc::hasFetchDataToProcess() const
     return fetchBytesRemaining() >= sizeof(TheGpuISA::RawMachInst);
 }
 
+bool
+FetchUnit::FetchBufDesc::canDecode() const
+{
+    return hasFetchDataToProcess() &&
+        (splitDecode() || wavefront->instructionBuffer.size() < maxIbSize);
+}
+
 void
 FetchUnit::FetchBufDesc::checkWaveReleaseBuf()
 {
@@ -598,7 +629,7 @@ FetchUnit::FetchBufDesc::decodeInsts()
                                                wavefront, gpu_static_inst,
                                                wavefront->computeUnit->
                                                 getAndIncSeqNum());
-            wavefront->instructionBuffer.push_back(gpu_dyn_inst);
+            wavefront->pushInstBuffer(gpu_dyn_inst);
 
             DPRINTF(GPUFetch, "WF[%d][%d]: Id%ld decoded %s (%d bytes). "
                     "%d bytes remain.\n", wavefront->simdId,
@@ -638,7 +669,7 @@ FetchUnit::FetchBufDesc::decodeSplitInst()
                                        wavefront, gpu_static_inst,
                                        wavefront->computeUnit->
                                            getAndIncSeqNum());
-    wavefront->instructionBuffer.push_back(gpu_dyn_inst);
+    wavefront->pushInstBuffer(gpu_dyn_inst);
 
     DPRINTF(GPUFetch, "WF[%d][%d]: Id%d decoded split inst %s (%#x) "
             "(%d bytes). %d bytes remain in %d buffered lines.\n",
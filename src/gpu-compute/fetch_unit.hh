@@ -59,6 +59,14 @@ class FetchUnit
     ~FetchUnit();
     void init();
     void exec();
+
+    /**
+     * True if exec() has nothing to do until a fetch returns: no wave
+     * waiting to fetch or able to start a fetch, and no buffered data
+     * that could be decoded.
+     */
+    bool idle();
+
     void bindWaveList(std::vector<Wavefront*> *list);
     void initiateFetch(Wavefront *wavefront);
     void fetch(PacketPtr pkt, Wavefront *wavefront);
@@ -147,6 +155,14 @@ class FetchUnit
          */
         bool hasFetchDataToProcess() const;
 
+        /**
+         * returns true if decodeInsts() would decode at least one
+         * instruction, i.e., there is buffered data and either room in
+         * the wave's instruction buffer or a split instruction to
+         * decode.
+         */
+        bool canDecode() const;
+
         /**
          * each time the fetch stage is ticked, we check if there
          * are any data in the fetch buffer that may be decoded and
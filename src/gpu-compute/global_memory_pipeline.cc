@@ -107,6 +107,16 @@ GlobalMemPipeline::outstandingReqsCheck(GPUDynInstPtr mp) const
     return true;
 }
 
+bool
+GlobalMemPipeline::idle() const
+{
+    // responses are returned in program order, so only a finished
+    // request at the head of the buffer can make progress
+    return gmIssuedRequests.empty() &&
+        (gmOrderedRespBuffer.empty() ||
+         !gmOrderedRespBuffer.begin()->second.second);
+}
+
 void
 GlobalMemPipeline::exec()
 {
@@ -152,17 +162,20 @@ GlobalMemPipeline::exec()
         Tick accessTime = curTick() - m->getAccessTime();
 
         // Decrement outstanding requests count
-        computeUnit.shader->ScheduleAdd(&w->outstandingReqs, m->time, -1);
+        computeUnit.shader->ScheduleAdd(&computeUnit, &w->outstandingReqs,
+                                        m->time, -1);
         if (m->isStore() || m->isAtomic() || m->isMemSync()) {
             computeUnit.shader->sampleStore(accessTime);
-            computeUnit.shader->ScheduleAdd(&w->outstandingReqsWrGm,
-                                             m->time, -1);
+            computeUnit.shader->ScheduleAdd(&computeUnit,
+                                            &w->outstandingReqsWrGm,
+                                            m->time, -1);
         }
 
         if (m->isLoad() || m->isAtomic() || m->isMemSync()) {
             computeUnit.shader->sampleLoad(accessTime);
-            computeUnit.shader->ScheduleAdd(&w->outstandingReqsRdGm,
-                                             m->time, -1);
+            computeUnit.shader->ScheduleAdd(&computeUnit,
+                                            &w->outstandingReqsRdGm,
+                                            m->time, -1);
         }
 
         w->validateRequestCounters();
@@ -63,6 +63,13 @@ class GlobalMemPipeline
     void init();
     void exec();
 
+    /**
+     * True if there is nothing for exec() to do until a response
+     * arrives: no request waiting to be issued and no finished response
+     * waiting to be returned.
+     */
+    bool idle() const;
+
     /**
      * Find the next ready response to service. In order to ensure
      * that no waitcnts are violated, we pop the oldest (in program order)
@@ -116,7 +116,7 @@ GPUCommandProcessor::performTimingRead(PacketPtr pkt, int dispType)
     sender_state->dispatchType = dispType;
     ComputeUnit::SQCPort sqc_port = cu->sqcPort;
 
-    if (!sqc_port.sendTimingReq(pkt)) {
+    if (!sqc_port.sendMemSideTimingReq(pkt)) {
         sqc_port.retries.push_back(
             std::pair<PacketPtr, Wavefront*>(pkt, sender_state->wavefront)
         );
@@ -126,6 +126,8 @@ GPUCommandProcessor::performTimingRead(PacketPtr pkt, int dispType)
 void
 GPUCommandProcessor::completeTimingRead(int dispType)
 {
+    // called from the SQC port of a CU, which may run on another queue
+    EventQueue::ScopedMigration migrate(eventQueue(), inParallelMode);
     struct KernelDispatchData dispatchData = kernelDispatchList.front();
     kernelDispatchList.pop_front();
     delete dispatchData.readPkt;
@@ -213,13 +213,13 @@ class LdsState: public ClockedObject
         void
         schedule(Tick when)
         {
-            mainEventQueue[0]->schedule(this, when);
+            ldsState->schedule(this, when);
         }
 
         void
         deschedule()
         {
-            mainEventQueue[0]->deschedule(this);
+            ldsState->deschedule(this);
         }
     };
 
@@ -59,6 +59,14 @@ class LocalMemPipeline
   public:
     LocalMemPipeline(const ComputeUnitParams &p, ComputeUnit &cu);
     void exec();
+
+    // True if no request is waiting to be issued or returned
+    bool
+    idle() const
+    {
+        return lmIssuedRequests.empty() && lmReturnedRequests.empty();
+    }
+
     std::queue<GPUDynInstPtr> &getLMRespFIFO() { return lmReturnedRequests; }
 
     void issueRequest(GPUDynInstPtr gpuDynInst);
@@ -98,16 +98,19 @@ ScalarMemPipeline::exec()
         }
 
         // Decrement outstanding register count
-        computeUnit.shader->ScheduleAdd(&w->outstandingReqs, m->time, -1);
+        computeUnit.shader->ScheduleAdd(&computeUnit, &w->outstandingReqs,
+                                        m->time, -1);
 
         if (m->isStore() || m->isAtomic()) {
-            computeUnit.shader->ScheduleAdd(&w->scalarOutstandingReqsWrGm,
-                                             m->time, -1);
+            computeUnit.shader->ScheduleAdd(&computeUnit,
+                                            &w->scalarOutstandingReqsWrGm,
+                                            m->time, -1);
         }
 
         if (m->isLoad() || m->isAtomic()) {
-            computeUnit.shader->ScheduleAdd(&w->scalarOutstandingReqsRdGm,
-                                             m->time, -1);
+            computeUnit.shader->ScheduleAdd(&computeUnit,
+                                            &w->scalarOutstandingReqsRdGm,
+                                            m->time, -1);
         }
 
         // Mark write bus busy for appropriate amount of time
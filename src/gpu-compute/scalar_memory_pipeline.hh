@@ -62,6 +62,14 @@ class ScalarMemPipeline
     ScalarMemPipeline(const ComputeUnitParams &p, ComputeUnit &cu);
     void exec();
 
+    // True if no request is waiting to be issued or returned
+    bool
+    idle() const
+    {
+        return issuedRequests.empty() && returnedStores.empty() &&
+            returnedLoads.empty();
+    }
+
     std::queue<GPUDynInstPtr> &getGMReqFIFO() { return issuedRequests; }
     std::queue<GPUDynInstPtr> &getGMStRespFIFO() { return returnedStores; }
     std::queue<GPUDynInstPtr> &getGMLdRespFIFO() { return returnedLoads; }
@@ -31,7 +31,7 @@
 
 #include "gpu-compute/schedule_stage.hh"
 
-#include <unordered_set>
+#include <algorithm>
 
 #include "base/compiler.hh"
 #include "debug/GPUSched.hh"
@@ -83,10 +83,27 @@ ScheduleStage::init()
         scheduler[j].bindList(&fromScoreboardCheck.readyWFs(j));
     }
 
+    wavesInSch.resize(computeUnit.numVectorALUs);
+    for (int j = 0; j < computeUnit.numVectorALUs; ++j) {
+        wavesInSch[j].assign(computeUnit.wfList[j].size(), false);
+    }
+
     assert(computeUnit.numVectorGlobalMemUnits == 1);
     assert(computeUnit.numVectorSharedMemUnits == 1);
 }
 
+bool
+ScheduleStage::idle() const
+{
+    for (const auto &sch_list : schList) {
+        if (!sch_list.empty()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void
 ScheduleStage::exec()
 {
@@ -100,15 +117,11 @@ ScheduleStage::exec()
          * execution within a wave.
          */
         fromScoreboardCheck.updateReadyList(j);
-        for (auto wIt = fromScoreboardCheck.readyWFs(j).begin();
-             wIt != fromScoreboardCheck.readyWFs(j).end();) {
-            if (wavesInSch.find((*wIt)->wfDynId) != wavesInSch.end()) {
-                *wIt = nullptr;
-                wIt = fromScoreboardCheck.readyWFs(j).erase(wIt);
-            } else {
-                wIt++;
-            }
-        }
+        auto &ready_wfs = fromScoreboardCheck.readyWFs(j);
+        ready_wfs.erase(std::remove_if(ready_wfs.begin(), ready_wfs.end(),
+            [this](Wavefront *wf) {
+                return wavesInSch[wf->simdId][wf->wfSlotId];
+            }), ready_wfs.end());
     }
 
     // Attempt to add another wave for each EXE type to schList queues
@@ -321,7 +334,7 @@ ScheduleStage::addToSchList(int exeType, const GPUDynInstPtr &gpu_dyn_inst)
                 gpu_dyn_inst->seqNum(), gpu_dyn_inst->disassemble());
 
         computeUnit.insertInPipeMap(wf);
-        wavesInSch.emplace(wf->wfDynId);
+        wavesInSch[wf->simdId][wf->wfSlotId] = true;
         schList.at(exeType).push_back(std::make_pair(gpu_dyn_inst, RFBUSY));
         if (wf->isOldestInstBarrier() && wf->hasBarrier()) {
             wf->setStatus(Wavefront::S_BARRIER);
@@ -799,7 +812,7 @@ ScheduleStage::reserveResources()
 void
 ScheduleStage::deleteFromSch(Wavefront *w)
 {
-    wavesInSch.erase(w->wfDynId);
+    wavesInSch[w->simdId][w->wfSlotId] = false;
 }
 
 ScheduleStage::ScheduleStageStats::ScheduleStageStats(
@@ -34,7 +34,6 @@
 
 #include <deque>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -69,6 +68,9 @@ class ScheduleStage
     void init();
     void exec();
 
+    // True if no instruction is waiting in the schedule lists
+    bool idle() const;
+
     // Stats related variables and methods
     const std::string& name() const { return _name; }
     enum SchNonRdyType
@@ -169,9 +171,10 @@ class ScheduleStage
                                   const GPUDynInstPtr &gpu_dyn_inst);
     void doDispatchListTransition(int unitId, DISPATCH_STATUS s);
 
-    // Set tracking wfDynId for each wave present in schedule stage
-    // Used to allow only one instruction per wave in schedule
-    std::unordered_set<uint64_t> wavesInSch;
+    // Bitmap per SIMD, indexed by WF slot, of the waves present in
+    // schedule stage. Used to allow only one instruction per wave in
+    // schedule
+    std::vector<std::vector<bool>> wavesInSch;
 
     // List of waves (one list per exe resource) that are in schedule
     // stage. Waves are added to this list after selected by scheduler
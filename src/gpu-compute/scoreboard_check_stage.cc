@@ -50,7 +50,8 @@ ScoreboardCheckStage::ScoreboardCheckStage(const ComputeUnitParams &p,
                                            ScoreboardCheckToSchedule
                                            &to_schedule)
     : computeUnit(cu), toSchedule(to_schedule),
-      _name(cu.name() + ".ScoreboardCheckStage"), stats(&cu)
+      _name(cu.name() + ".ScoreboardCheckStage"), _wavesStalled(false),
+      stats(&cu)
 {
 }
 
@@ -58,6 +59,33 @@ ScoreboardCheckStage::~ScoreboardCheckStage()
 {
 }
 
+void
+ScoreboardCheckStage::init()
+{
+    wavesToCheck.resize(computeUnit.numVectorALUs);
+    parkedStatus.resize(computeUnit.numVectorALUs);
+    for (int simdId = 0; simdId < computeUnit.numVectorALUs; ++simdId) {
+        wavesToCheck[simdId].assign(computeUnit.wfList[simdId].size(), true);
+        parkedStatus[simdId].assign(computeUnit.wfList[simdId].size(),
+                                    NRDY_ILLEGAL);
+    }
+    numParked.assign(NRDY_CONDITIONS, 0);
+}
+
+void
+ScoreboardCheckStage::wakeWave(Wavefront *w)
+{
+    // waves may change state before the CU is initialised
+    if (wavesToCheck.empty() || wavesToCheck[w->simdId][w->wfSlotId]) {
+        return;
+    }
+
+    nonrdytype_e &status = parkedStatus[w->simdId][w->wfSlotId];
+    numParked[status]--;
+    status = NRDY_ILLEGAL;
+    wavesToCheck[w->simdId][w->wfSlotId] = true;
+}
+
 void
 ScoreboardCheckStage::collectStatistics(nonrdytype_e rdyStatus)
 {
@@ -122,6 +150,8 @@ ScoreboardCheckStage::ready(Wavefront *w, nonrdytype_e *rdyStatus,
                 w->simdId, w->wfSlotId, w->wfDynId, bar_id);
         computeUnit.resetBarrier(bar_id);
         computeUnit.releaseWFsFromBarrier(bar_id);
+        // waves already checked this cycle may have been released
+        _wavesStalled = false;
     }
 
     // Check WF status: it has to be running
@@ -162,7 +192,7 @@ ScoreboardCheckStage::ready(Wavefront *w, nonrdytype_e *rdyStatus,
     DPRINTF(GPUExec, "CU%d: WF[%d][%d]: Checking Ready for Inst : %s\n",
             computeUnit.cu_id, w->simdId, w->wfSlotId, ii->disassemble());
     w->lastInstSeqNum = ii->seqNum();
-    w->lastInstDisasm = ii->disassemble();
+    w->lastInst = ii;
 
     // Non-scalar (i.e., vector) instructions may use VGPRs
     if (!ii->isScalar()) {
@@ -227,6 +257,24 @@ ScoreboardCheckStage::ready(Wavefront *w, nonrdytype_e *rdyStatus,
     return true;
 }
 
+bool
+ScoreboardCheckStage::waitsOnExternalEvent(Wavefront *w,
+                                           nonrdytype_e rdyStatus) const
+{
+    switch (rdyStatus) {
+      case NRDY_WAIT_CNT:
+      case NRDY_BARRIER_WAIT:
+      case NRDY_IB_EMPTY:
+        return true;
+      case NRDY_WF_STOP:
+        return w->getStatus() == Wavefront::S_STOPPED ||
+               w->getStatus() == Wavefront::S_RETURNING;
+      default:
+        // sleeping, operand and matrix core stalls resolve with time
+        return false;
+    }
+}
+
 int
 ScoreboardCheckStage::mapWaveToExeUnit(Wavefront *w)
 {
@@ -277,10 +325,22 @@ ScoreboardCheckStage::exec()
      * constructed every cycle because resource availability may change.
      */
     toSchedule.reset();
+    _wavesStalled = true;
 
-    // Iterate over all WF slots across all SIMDs.
+    // Parked waves are not ready for the same reason as last cycle. They
+    // all wait on external events, so they don't affect _wavesStalled.
+    for (int status = 0; status < NRDY_CONDITIONS; ++status) {
+        if (numParked[status]) {
+            stats.stallCycles[status] += numParked[status];
+        }
+    }
+
+    // Iterate over the WF slots to check across all SIMDs.
     for (int simdId = 0; simdId < computeUnit.numVectorALUs; ++simdId) {
         for (int wfSlot = 0; wfSlot < computeUnit.shader->n_wf; ++wfSlot) {
+            if (!wavesToCheck[simdId][wfSlot]) {
+                continue;
+            }
             // reset the ready status of each wavefront
             Wavefront *curWave = computeUnit.wfList[simdId][wfSlot];
             nonrdytype_e rdyStatus = NRDY_ILLEGAL;
@@ -300,6 +360,15 @@ ScoreboardCheckStage::exec()
             } else {
                 curWave->lastInstRdyStatus = rdyStatusStr(rdyStatus);
             }
+            if (!waitsOnExternalEvent(curWave, rdyStatus)) {
+                _wavesStalled = false;
+            } else if (rdyStatus != NRDY_BARRIER_WAIT) {
+                // Barriers are released by other waves reaching them, so
+                // waves at a barrier keep being checked.
+                wavesToCheck[simdId][wfSlot] = false;
+                parkedStatus[simdId][wfSlot] = rdyStatus;
+                numParked[rdyStatus]++;
+            }
             collectStatistics(rdyStatus);
         }
     }
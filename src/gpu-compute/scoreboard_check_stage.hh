@@ -79,14 +79,33 @@ class ScoreboardCheckStage
     ScoreboardCheckStage(const ComputeUnitParams &p, ComputeUnit &cu,
                          ScoreboardCheckToSchedule &to_schedule);
     ~ScoreboardCheckStage();
+    void init();
     void exec();
 
+    /**
+     * Called when something a parked wave's readiness depends on has
+     * changed: its status, its instruction buffer, its outstanding
+     * memory counts or its waitcnts. The wave is checked again on the
+     * next cycle.
+     */
+    void wakeWave(Wavefront *w);
+
+    /**
+     * True if, in the last cycle, no wave was ready and every wave was
+     * either inactive or blocked on something only an external event
+     * can resolve: outstanding memory counts (waitcnt), a barrier, or
+     * an empty instruction buffer. Used by the CU to decide whether it
+     * may sleep until the next memory response.
+     */
+    bool wavesStalled() const { return _wavesStalled; }
+
     // Stats related variables and methods
     const std::string& name() const { return _name; }
 
   private:
     void collectStatistics(nonrdytype_e rdyStatus);
     int mapWaveToExeUnit(Wavefront *w);
+    bool waitsOnExternalEvent(Wavefront *w, nonrdytype_e rdyStatus) const;
     bool ready(Wavefront *w, nonrdytype_e *rdyStatus,
                int *exeResType, int wfSlot);
     ComputeUnit &computeUnit;
@@ -100,7 +119,25 @@ class ScoreboardCheckStage
 
     const std::string _name;
 
-    std::string rdyStatusStr(const nonrdytype_e& rdyStatus) {
+    bool _wavesStalled;
+
+    /**
+     * Bitmap per SIMD, indexed by WF slot, of the waves whose readiness
+     * has to be checked each cycle. A wave that is stopped, has an empty
+     * instruction buffer or is waiting on its waitcnts stays not ready
+     * until one of the events reported through wakeWave(), so it is
+     * parked: its bit is cleared and it isn't checked again until then.
+     */
+    std::vector<std::vector<bool>> wavesToCheck;
+
+    // Why each parked wave is not ready, indexed like wavesToCheck
+    std::vector<std::vector<nonrdytype_e>> parkedStatus;
+
+    // Number of parked waves for each not ready reason, so that their
+    // stall cycles are counted without visiting them
+    std::vector<int> numParked;
+
+    const char *rdyStatusStr(const nonrdytype_e& rdyStatus) {
         switch (rdyStatus) {
             case NRDY_ILLEGAL: return "NRDY_ILLEGAL";
             case NRDY_WF_STOP: return "NRDY_WF_STOP";
@@ -176,6 +176,7 @@ Shader::execScheduledAdds()
     assert(!sa_when.empty());
 
     // apply any scheduled adds
+    bool applied = false;
     for (int i = 0; i < sa_n; ++i) {
         if (sa_when[i] <= curTick()) {
             *sa_val[i] += sa_x[i];
@@ -185,6 +186,17 @@ Shader::execScheduledAdds()
             sa_when.erase(sa_when.begin() + i);
             --sa_n;
             --i;
+            applied = true;
+        }
+    }
+
+    // the counters may gate issue in a CU that is asleep on a stall;
+    // CUs on other event queues apply their own adds (see ScheduleAdd)
+    if (applied) {
+        for (auto *cu : cuList) {
+            if (cu->eventQueue() == eventQueue()) {
+                cu->wakeFromStall();
+            }
         }
     }
     if (!sa_when.empty()) {
@@ -220,9 +232,6 @@ Shader::prepareInvalidate(HSAQueueEntry *task) {
                                                  0, -1);
 
         _dispatcher.updateInvCounter(kernId, +1);
-        // all necessary INV flags are all set now, call cu to execute
-        cuList[i_cu]->doInvalidate(tcc_req, task->dispatchId());
-
 
         // A set of CUs share a single SQC cache. Send a single invalidate
         // request to each SQC
@@ -230,6 +239,12 @@ Shader::prepareInvalidate(HSAQueueEntry *task) {
                                                  cuList[i_cu]->requestorId(),
                                                  0, -1);
 
+        EventQueue::ScopedMigration migrate(cuList[i_cu]->eventQueue(),
+                                            inParallelMode);
+
+        // all necessary INV flags are all set now, call cu to execute
+        cuList[i_cu]->doInvalidate(tcc_req, task->dispatchId());
+
         if ((i_cu % n_cu_per_sqc) == 0) {
             cuList[i_cu]->doSQCInvalidate(sqc_req, task->dispatchId());
         }
@@ -252,6 +267,9 @@ Shader::prepareFlush(GPUDynInstPtr gpuDynInst){
     // assuming that L2 cache is shared by all cus in the shader
     int i_cu = 0;
     _dispatcher.updateWbCounter(kernId, +1);
+
+    EventQueue::ScopedMigration migrate(cuList[i_cu]->eventQueue(),
+                                        inParallelMode);
     cuList[i_cu]->doFlush(gpuDynInst);
 }
 
@@ -270,8 +288,15 @@ Shader::dispatchWorkgroups(HSAQueueEntry *task)
         // dispatch workgroup iff the following two conditions are met:
         // (a) wg_rem is true - there are unassigned workgroups in the grid
         // (b) there are enough free slots in cu cuList[i] for this wg
+        ComputeUnit *cu = cuList[curCu];
         int num_wfs_in_wg = 0;
-        bool can_disp = cuList[curCu]->hasDispResources(task, num_wfs_in_wg);
+        bool can_disp = false;
+        {
+            // the CU may run on its own event queue
+            EventQueue::ScopedMigration migrate(cu->eventQueue(),
+                                                inParallelMode);
+            can_disp = cu->hasDispResources(task, num_wfs_in_wg);
+        }
         if (!task->dispComplete() && can_disp) {
             scheduledSomething = true;
             DPRINTF(GPUDisp, "Dispatching a workgroup to CU %d: WG %d\n",
@@ -281,7 +306,16 @@ Shader::dispatchWorkgroups(HSAQueueEntry *task)
             DPRINTF(GPUWgLatency, "WG Begin cycle:%d wg:%d cu:%d\n",
                     curTick(), task->globalWgId(), curCu);
 
-            if (!cuList[curCu]->tickEvent.scheduled()) {
+            bool cu_idle = false;
+            {
+                EventQueue::ScopedMigration migrate(cu->eventQueue(),
+                                                    inParallelMode);
+                cu_idle = !cu->tickEvent.scheduled() &&
+                    !cu->sleepingOnStall();
+                cu->dispWorkgroup(task, num_wfs_in_wg);
+            }
+
+            if (cu_idle) {
                 if (!_activeCus)
                     _lastInactiveTick = curTick();
                 _activeCus++;
@@ -289,7 +323,6 @@ Shader::dispatchWorkgroups(HSAQueueEntry *task)
 
             panic_if(_activeCus <= 0 || _activeCus > cuList.size(),
                      "Invalid activeCu size\n");
-            cuList[curCu]->dispWorkgroup(task, num_wfs_in_wg);
 
             task->markWgDispatch();
             ++disp_count;
@@ -351,8 +384,8 @@ Shader::doFunctionalAccess(const RequestPtr &req, MemCmd cmd, void *data,
 
         // fixme: this should be cuList[cu_id] if cu_id != n_cu
         // The latter requires a memPort in the dispatcher
-        cuList[0]->memPort[0].sendFunctional(new_pkt1);
-        cuList[0]->memPort[0].sendFunctional(new_pkt2);
+        cuList[0]->memPort[0].sendMemSideFunctional(new_pkt1);
+        cuList[0]->memPort[0].sendMemSideFunctional(new_pkt2);
 
         delete new_pkt1;
         delete new_pkt2;
@@ -370,7 +403,7 @@ Shader::doFunctionalAccess(const RequestPtr &req, MemCmd cmd, void *data,
 
         // fixme: this should be cuList[cu_id] if cu_id != n_cu
         // The latter requires a memPort in the dispatcher
-        cuList[0]->memPort[0].sendFunctional(new_pkt);
+        cuList[0]->memPort[0].sendMemSideFunctional(new_pkt);
 
         delete new_pkt;
         delete pkt;
@@ -378,8 +411,20 @@ Shader::doFunctionalAccess(const RequestPtr &req, MemCmd cmd, void *data,
 }
 
 void
-Shader::ScheduleAdd(int *val,Tick when,int x)
+Shader::ScheduleAdd(ComputeUnit *cu, int *val, Tick when, int x)
 {
+    if (curEventQueue() != eventQueue()) {
+        // A CU on its own event queue applies its adds on that queue,
+        // so the counters are only ever touched by its thread.
+        curEventQueue()->schedule(new EventFunctionWrapper(
+            [cu, val, x]{
+                *val += x;
+                panic_if(*val < 0, "Negative counter value\n");
+                cu->wakeFromStall();
+            }, "Shader scheduled add event", true), curTick() + when);
+        return;
+    }
+
     sa_val.push_back(val);
     when += curTick();
     sa_when.push_back(when);
@@ -458,7 +503,7 @@ Shader::functionalTLBAccess(PacketPtr pkt, int cu_id, BaseMMU::Mode mode)
     // it's ok tp send all accesses through lane 0
     // since the lane # is not known here,
     // This isn't important since these are functional accesses.
-    cuList[cu_id]->tlbPort[0].sendFunctional(pkt);
+    cuList[cu_id]->tlbPort[0].sendMemSideFunctional(pkt);
 
     /* safe_cast the senderState */
     GpuTranslationState *sender_state =
@@ -474,6 +519,7 @@ Shader::functionalTLBAccess(PacketPtr pkt, int cu_id, BaseMMU::Mode mode)
 void
 Shader::sampleStore(const Tick accessTime)
 {
+    auto lock = lockCuStats();
     stats.storeLatencyDist.sample(accessTime);
     stats.allLatencyDist.sample(accessTime);
 }
@@ -484,6 +530,7 @@ Shader::sampleStore(const Tick accessTime)
 void
 Shader::sampleLoad(const Tick accessTime)
 {
+    auto lock = lockCuStats();
     stats.loadLatencyDist.sample(accessTime);
     stats.allLatencyDist.sample(accessTime);
 }
@@ -491,6 +538,8 @@ Shader::sampleLoad(const Tick accessTime)
 void
 Shader::sampleInstRoundTrip(std::vector<Tick> roundTripTime)
 {
+    auto lock = lockCuStats();
+
     // Only sample instructions that go all the way to main memory
     if (roundTripTime.size() != InstMemoryHop::InstMemoryHopMax) {
         return;
@@ -511,6 +560,7 @@ Shader::sampleInstRoundTrip(std::vector<Tick> roundTripTime)
 void
 Shader::sampleLineRoundTrip(const std::map<Addr, std::vector<Tick>>& lineMap)
 {
+    auto lock = lockCuStats();
     stats.coalsrLineAddresses.sample(lineMap.size());
     std::vector<Tick> netTimes;
 
@@ -539,6 +589,7 @@ Shader::sampleLineRoundTrip(const std::map<Addr, std::vector<Tick>>& lineMap)
 
 void
 Shader::notifyCuSleep() {
+    EventQueue::ScopedMigration migrate(eventQueue(), inParallelMode);
     // If all CUs attached to his shader are asleep, update shaderActiveTicks
     panic_if(_activeCus <= 0 || _activeCus > cuList.size(),
              "Invalid activeCu size\n");
@@ -557,9 +608,17 @@ Shader::notifyCuSleep() {
     }
 }
 
+void
+Shader::incNumOutstandingInvL2s()
+{
+    EventQueue::ScopedMigration migrate(eventQueue(), inParallelMode);
+    num_outstanding_invl2s++;
+}
+
 void
 Shader::decNumOutstandingInvL2s()
 {
+    EventQueue::ScopedMigration migrate(eventQueue(), inParallelMode);
     num_outstanding_invl2s--;
 
     if (num_outstanding_invl2s == 0 && !deferred_dispatches.empty()) {
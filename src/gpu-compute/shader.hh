@@ -32,7 +32,9 @@
 #ifndef __SHADER_HH__
 #define __SHADER_HH__
 
+#include <atomic>
 #include <functional>
+#include <mutex>
 #include <string>
 
 #include "arch/gpu_isa.hh"
@@ -109,6 +111,22 @@ class Shader : public ClockedObject
     int num_outstanding_invl2s = 0;
     std::vector<std::tuple<void *, uint32_t, Addr>> deferred_dispatches;
 
+    // Protects the stats the CUs sample directly, see lockCuStats()
+    std::mutex cuStatsLock;
+
+    /**
+     * The CUs may be spread over several event queues (see
+     * ComputeUnit::memSideEventQueue()). The latency and operand
+     * stats they sample on every instruction are then updated under
+     * cuStatsLock rather than by migrating to the shader's queue.
+     */
+    std::unique_lock<std::mutex>
+    lockCuStats()
+    {
+        return inParallelMode ? std::unique_lock<std::mutex>(cuStatsLock)
+                              : std::unique_lock<std::mutex>();
+    }
+
   public:
     typedef ShaderParams Params;
     enum hsail_mode_e {SIMT,VECTOR_SCALAR};
@@ -273,7 +291,7 @@ class Shader : public ClockedObject
     AMDGPUSystemHub *systemHub;
 
     int64_t max_valu_insts;
-    int64_t total_valu_insts;
+    std::atomic<int64_t> total_valu_insts;
 
     // Member and methods related to printing of GPU progress
     const Tick progressInterval;
@@ -286,8 +304,9 @@ class Shader : public ClockedObject
     // Run shader scheduled adds
     void execScheduledAdds();
 
-    // Schedule a 32-bit value to be incremented some time in the future
-    void ScheduleAdd(int *val, Tick when, int x);
+    // Schedule a 32-bit value of a CU to be incremented some time in the
+    // future, waking the CU once it has been applied
+    void ScheduleAdd(ComputeUnit *cu, int *val, Tick when, int x);
     bool processTimingPacket(PacketPtr pkt);
 
     void AccessMem(uint64_t address, void *ptr, uint32_t size, int cu_id,
@@ -324,12 +343,14 @@ class Shader : public ClockedObject
     void
     incVectorInstSrcOperand(int num_operands)
     {
+        auto lock = lockCuStats();
         stats.vectorInstSrcOperand[num_operands]++;
     }
 
     void
     incVectorInstDstOperand(int num_operands)
     {
+        auto lock = lockCuStats();
         stats.vectorInstDstOperand[num_operands]++;
     }
 
@@ -341,7 +362,7 @@ class Shader : public ClockedObject
     }
 
     void decNumOutstandingInvL2s();
-    void incNumOutstandingInvL2s() { num_outstanding_invl2s++; };
+    void incNumOutstandingInvL2s();
     int getNumOutstandingInvL2s() const { return num_outstanding_invl2s; };
 
     void addDeferredDispatch(void *raw_pkt, uint32_t queue_id,
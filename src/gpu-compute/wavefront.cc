@@ -49,7 +49,8 @@ namespace gem5
 
 Wavefront::Wavefront(const Params &p)
   : SimObject(p), wfSlotId(p.wf_slot_id), simdId(p.simdId),
-    maxIbSize(p.max_ib_size), _gpuISA(*this),
+    maxIbSize(p.max_ib_size), instructionBuffer(p.max_ib_size + 1),
+    _gpuISA(*this),
     vmWaitCnt(-1), expWaitCnt(-1), lgkmWaitCnt(-1),
     vmemInstsIssued(0), expInstsIssued(0), lgkmInstsIssued(0),
     sleepCnt(0), barId(WFBarrier::InvalidID), stats(this)
@@ -100,7 +101,7 @@ Wavefront::Wavefront(const Params &p)
     vecReads.clear();
 
     lastInstSeqNum = 0;
-    lastInstDisasm = "none";
+    lastInstRdyStatus = "none";
 }
 
 void
@@ -630,6 +631,7 @@ Wavefront::setStatus(status_e newStatus)
         }
     }
     status = newStatus;
+    computeUnit->scoreboardCheckStage.wakeWave(this);
 }
 
 void
@@ -639,6 +641,7 @@ Wavefront::start(uint64_t _wf_dyn_id, Addr init_pc)
     _pc = init_pc;
 
     status = S_RUNNING;
+    computeUnit->scoreboardCheckStage.wakeWave(this);
 
     vecReads.resize(maxVgprs, 0);
 }
@@ -1041,7 +1044,7 @@ Wavefront::exec()
     if (pc() == old_pc) {
         // PC not modified by instruction, proceed to next
         _gpuISA.advancePC(ii);
-        instructionBuffer.pop_front();
+        popInstBuffer();
     } else {
         DPRINTF(GPUExec, "CU%d: WF[%d][%d]: wave%d %s taken branch\n",
                 computeUnit->cu_id, simdId, wfSlotId, wfDynId,
@@ -1290,7 +1293,7 @@ Wavefront::nextInstr()
 void
 Wavefront::discardFetch()
 {
-    instructionBuffer.clear();
+    flushInstBuffer();
     dropFetch |= pendingFetch;
 
     /**
@@ -1300,6 +1303,33 @@ Wavefront::discardFetch()
     computeUnit->fetchStage.fetchUnit(simdId).flushBuf(wfSlotId);
 }
 
+void
+Wavefront::pushInstBuffer(const GPUDynInstPtr &gpu_dyn_inst)
+{
+    instructionBuffer.push_back(gpu_dyn_inst);
+    computeUnit->scoreboardCheckStage.wakeWave(this);
+}
+
+void
+Wavefront::popInstBuffer()
+{
+    // The ring does not destroy popped entries, release the instruction
+    // here so it does not linger until the slot gets reused.
+    instructionBuffer.front() = nullptr;
+    instructionBuffer.pop_front();
+    computeUnit->scoreboardCheckStage.wakeWave(this);
+}
+
+void
+Wavefront::flushInstBuffer(int keep)
+{
+    while (instructionBuffer.size() > keep) {
+        instructionBuffer.back() = nullptr;
+        instructionBuffer.pop_back();
+    }
+    computeUnit->scoreboardCheckStage.wakeWave(this);
+}
+
 bool
 Wavefront::waitCntsSatisfied()
 {
@@ -1412,6 +1442,8 @@ Wavefront::setWaitCnts(int vm_wait_cnt, int exp_wait_cnt, int lgkm_wait_cnt)
 
     if (lgkm_wait_cnt != 0x1f)
         lgkmWaitCnt = lgkm_wait_cnt;
+
+    computeUnit->scoreboardCheckStage.wakeWave(this);
 }
 
 void
@@ -1450,18 +1482,21 @@ void
 Wavefront::decVMemInstsIssued()
 {
     --vmemInstsIssued;
+    computeUnit->scoreboardCheckStage.wakeWave(this);
 }
 
 void
 Wavefront::decExpInstsIssued()
 {
     --expInstsIssued;
+    computeUnit->scoreboardCheckStage.wakeWave(this);
 }
 
 void
 Wavefront::decLGKMInstsIssued()
 {
     --lgkmInstsIssued;
+    computeUnit->scoreboardCheckStage.wakeWave(this);
 }
 
 void
@@ -1662,7 +1697,8 @@ Wavefront::printProgress()
 {
     std::cout << "wave[" << wfDynId << "] status: "
               << statusToString(getStatus()) << " last inst: "
-              << lastInstDisasm << " waitcnts: vmem: " << vmemInstsIssued
+              << (lastInst ? lastInst->disassemble() : "none")
+              << " waitcnts: vmem: " << vmemInstsIssued
               << "/" << vmWaitCnt << "(";
     for (auto &elem : vmemIssued) {
         std::cout << elem << ' ';
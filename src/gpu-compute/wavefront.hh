@@ -33,7 +33,6 @@
 #define __GPU_COMPUTE_WAVEFRONT_HH__
 
 #include <cassert>
-#include <deque>
 #include <list>
 #include <memory>
 #include <set>
@@ -41,6 +40,7 @@
 #include <vector>
 
 #include "arch/gpu_isa.hh"
+#include "base/circular_queue.hh"
 #include "base/logging.hh"
 #include "base/statistics.hh"
 #include "base/stats/group.hh"
@@ -109,7 +109,10 @@ class Wavefront : public SimObject
     ComputeUnit *computeUnit;
     int maxIbSize;
 
-    std::deque<GPUDynInstPtr> instructionBuffer;
+    // fixed size ring of decoded instructions, oldest first. It has room
+    // for one extra instruction since a split instruction is decoded even
+    // when the buffer is already full.
+    CircularQueue<GPUDynInstPtr> instructionBuffer;
 
     bool pendingFetch;
     bool dropFetch;
@@ -276,6 +279,12 @@ class Wavefront : public SimObject
 
 
     void discardFetch();
+    // add a newly decoded instruction to the instruction buffer
+    void pushInstBuffer(const GPUDynInstPtr &gpu_dyn_inst);
+    // remove the oldest instruction from the instruction buffer
+    void popInstBuffer();
+    // drop all but the keep oldest instructions from the instruction buffer
+    void flushInstBuffer(int keep=0);
 
     bool waitCntsSatisfied();
     void setWaitCnts(int vm_wait_cnt, int exp_wait_cnt, int lgkm_wait_cnt);
@@ -325,8 +334,8 @@ class Wavefront : public SimObject
 
     // Tracking variables for periodic progress
     InstSeqNum lastInstSeqNum;
-    std::string lastInstDisasm;
-    std::string lastInstRdyStatus;
+    GPUDynInstPtr lastInst;
+    const char *lastInstRdyStatus;
     bool lastVrfStatus, lastSrfStatus;
 
   private:
@@ -33,6 +33,8 @@
  */
 #include "mem/page_table.hh"
 
+#include <algorithm>
+#include <mutex>
 #include <string>
 
 #include "base/compiler.hh"
@@ -47,6 +49,8 @@ namespace gem5
 void
 EmulationPageTable::map(Addr vaddr, Addr paddr, int64_t size, uint64_t flags)
 {
+    std::unique_lock lock(pTableMutex);
+
     bool clobber = flags & Clobber;
     // starting address must be page aligned
     assert(pageOffset(vaddr) == 0);
@@ -74,6 +78,8 @@ EmulationPageTable::map(Addr vaddr, Addr paddr, int64_t size, uint64_t flags)
 void
 EmulationPageTable::remap(Addr vaddr, int64_t size, Addr new_vaddr)
 {
+    std::unique_lock lock(pTableMutex);
+
     assert(pageOffset(vaddr) == 0);
     assert(pageOffset(new_vaddr) == 0);
 
@@ -96,13 +102,44 @@ EmulationPageTable::remap(Addr vaddr, int64_t size, Addr new_vaddr)
 void
 EmulationPageTable::getMappings(std::vector<std::pair<Addr, Addr>> *addr_maps)
 {
+    std::shared_lock lock(pTableMutex);
+
     for (auto &iter : pTable)
         addr_maps->push_back(std::make_pair(iter.first, iter.second.paddr));
 }
 
+void
+EmulationPageTable::getMappings(Addr vaddr, int64_t size,
+                                std::vector<std::pair<Addr, Addr>> *addr_maps)
+{
+    std::shared_lock lock(pTableMutex);
+
+    assert(pageOffset(vaddr) == 0);
+
+    if (size / _pageSize > (int64_t)pTable.size()) {
+        auto first = addr_maps->size();
+        for (auto &iter : pTable) {
+            if (iter.first >= vaddr && iter.first - vaddr < size) {
+                addr_maps->push_back(
+                        std::make_pair(iter.first, iter.second.paddr));
+            }
+        }
+        std::sort(addr_maps->begin() + first, addr_maps->end());
+        return;
+    }
+
+    for (int64_t offset = 0; offset < size; offset += _pageSize) {
+        auto it = pTable.find(vaddr + offset);
+        if (it != pTable.end())
+            addr_maps->push_back(std::make_pair(it->first, it->second.paddr));
+    }
+}
+
 void
 EmulationPageTable::unmap(Addr vaddr, int64_t size)
 {
+    std::unique_lock lock(pTableMutex);
+
     assert(pageOffset(vaddr) == 0);
 
     DPRINTF(MMU, "Unmapping page: %#x-%#x\n", vaddr, vaddr + size);
@@ -119,9 +156,21 @@ EmulationPageTable::unmap(Addr vaddr, int64_t size)
 bool
 EmulationPageTable::isUnmapped(Addr vaddr, int64_t size)
 {
+    std::shared_lock lock(pTableMutex);
+
     // starting address must be page aligned
     assert(pageOffset(vaddr) == 0);
 
+    // Large regions are mostly unpopulated, so it is cheaper to walk the
+    // pages which are mapped than to probe every page of the region.
+    if (size / _pageSize > (int64_t)pTable.size()) {
+        for (auto &iter : pTable) {
+            if (iter.first >= vaddr && iter.first - vaddr < size)
+                return false;
+        }
+        return true;
+    }
+
     for (int64_t offset = 0; offset < size; offset += _pageSize)
         if (pTable.find(vaddr + offset) != pTable.end())
             return false;
@@ -129,20 +178,23 @@ EmulationPageTable::isUnmapped(Addr vaddr, int64_t size)
     return true;
 }
 
-const EmulationPageTable::Entry *
+std::optional<EmulationPageTable::Entry>
 EmulationPageTable::lookup(Addr vaddr)
 {
+    std::shared_lock lock(pTableMutex);
+
     Addr page_addr = pageAlign(vaddr);
     PTableItr iter = pTable.find(page_addr);
     if (iter == pTable.end())
-        return nullptr;
-    return &(iter->second);
+        return std::nullopt;
+    // Return a copy, the entry may be remapped once the lock is released.
+    return iter->second;
 }
 
 bool
 EmulationPageTable::translate(Addr vaddr, Addr &paddr)
 {
-    const Entry *entry = lookup(vaddr);
+    auto entry = lookup(vaddr);
     if (!entry) {
         DPRINTF(MMU, "Couldn't Translate: %#x\n", vaddr);
         return false;
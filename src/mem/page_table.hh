@@ -35,6 +35,8 @@
 #ifndef __MEM_PAGE_TABLE_HH__
 #define __MEM_PAGE_TABLE_HH__
 
+#include <optional>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 
@@ -67,6 +69,13 @@ class EmulationPageTable : public Serializable
     typedef PTable::iterator PTableItr;
     PTable pTable;
 
+    /**
+     * CPUs on separate event queues look up the table on their TLB
+     * misses while another one may be changing it to handle a fault or
+     * a system call.
+     */
+    mutable std::shared_mutex pTableMutex;
+
     const Addr _pageSize;
     const Addr offsetMask;
 
@@ -137,9 +146,9 @@ class EmulationPageTable : public Serializable
     /**
      * Lookup function
      * @param vaddr The virtual address.
-     * @return The page table entry corresponding to vaddr.
+     * @return A copy of the page table entry corresponding to vaddr.
      */
-    const Entry *lookup(Addr vaddr);
+    std::optional<Entry> lookup(Addr vaddr);
 
     /**
      * Translate function
@@ -196,6 +205,18 @@ class EmulationPageTable : public Serializable
 
     void getMappings(std::vector<std::pair<Addr, Addr>> *addr_mappings);
 
+    /**
+     * Get the mappings of the pages of a virtual memory region, in
+     * ascending virtual address order. Only the pages which are mapped
+     * are visited when the region is larger than the page table.
+     * @param vaddr The page aligned starting virtual address.
+     * @param size The length of the region.
+     * @param addr_mappings Pairs of virtual and physical page addresses
+     *                      are appended to this vector.
+     */
+    void getMappings(Addr vaddr, int64_t size,
+                     std::vector<std::pair<Addr, Addr>> *addr_mappings);
+
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
 };
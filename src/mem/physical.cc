@@ -275,6 +275,18 @@ PhysicalMemory::isMemAddr(Addr addr) const
     return addrMap.contains(addr) != addrMap.end();
 }
 
+uint8_t *
+PhysicalMemory::toHostAddr(Addr addr, Addr size) const
+{
+    for (const auto &entry : backingStore) {
+        if (entry.inAddrMap && addr >= entry.range.start() &&
+                addr + size <= entry.range.end()) {
+            return entry.pmem + (addr - entry.range.start());
+        }
+    }
+    return nullptr;
+}
+
 AddrRangeList
 PhysicalMemory::getConfAddrRanges() const
 {
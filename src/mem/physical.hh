@@ -245,6 +245,19 @@ class PhysicalMemory : public Serializable
     std::vector<BackingStoreEntry> getBackingStore() const
     { return backingStore; }
 
+    /**
+     * Get a host pointer to a range of physical memory, for simulator
+     * code which copies large amounts of data to or from the guest and
+     * knows that no cache holds a copy of it. As with getBackingStore(),
+     * memory accessed this way bypasses the memory system entirely.
+     *
+     * @param addr Start of the range
+     * @param size Size of the range
+     * @return The host pointer, or nullptr if the range is not all in
+     *         the same backing store
+     */
+    uint8_t *toHostAddr(Addr addr, Addr size) const;
+
     /**
      * Perform an untimed memory access and update all the state
      * (e.g. locked addresses) and statistics accordingly. The packet
@@ -31,6 +31,8 @@
 
 #include "mem/ruby/system/GPUCoalescer.hh"
 
+#include <algorithm>
+
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "base/str.hh"
@@ -69,9 +71,10 @@ UncoalescedTable::insertPacket(PacketPtr pkt)
 {
     uint64_t seqNum = pkt->req->getReqInstSeqNum();
 
-    instMap[seqNum].push_back(pkt);
+    PerInstPackets &pkts = instMap[seqNum].pkts;
+    pkts.push_back(pkt);
     DPRINTF(GPUCoalescer, "Adding 0x%X seqNum %d to map. (map %d vec %d)\n",
-            pkt->getAddr(), seqNum, instMap.size(), instMap[seqNum].size());
+            pkt->getAddr(), seqNum, instMap.size(), pkts.size());
 }
 
 void
@@ -79,7 +82,7 @@ UncoalescedTable::insertReqType(PacketPtr pkt, RubyRequestType type)
 {
     uint64_t seqNum = pkt->req->getReqInstSeqNum();
 
-    reqTypeMap[seqNum] = type;
+    instMap[seqNum].reqType = type;
 }
 
 bool
@@ -91,34 +94,42 @@ UncoalescedTable::packetAvailable()
 void
 UncoalescedTable::initPacketsRemaining(InstSeqNum seqNum, int count)
 {
-    if (!instPktsRemaining.count(seqNum)) {
-        instPktsRemaining[seqNum] = count;
+    InstEntry &inst = instMap[seqNum];
+    if (inst.pktsRemaining < 0) {
+        inst.pktsRemaining = count;
     }
 }
 
+bool
+UncoalescedTable::hasPacketsRemaining(InstSeqNum seqNum)
+{
+    auto it = instMap.find(seqNum);
+    return it != instMap.end() && it->second.pktsRemaining >= 0;
+}
+
 int
 UncoalescedTable::getPacketsRemaining(InstSeqNum seqNum)
 {
-    return instPktsRemaining[seqNum];
+    auto it = instMap.find(seqNum);
+    assert(it != instMap.end() && it->second.pktsRemaining >= 0);
+    return it->second.pktsRemaining;
 }
 
 void
 UncoalescedTable::setPacketsRemaining(InstSeqNum seqNum, int count)
 {
-    instPktsRemaining[seqNum] = count;
+    instMap[seqNum].pktsRemaining = count;
 }
 
-PerInstPackets*
-UncoalescedTable::getInstPackets(int offset)
+void
+UncoalescedTable::getInstPackets(int count,
+                                 std::vector<PerInstPackets*> &insts)
 {
-    if (offset >= instMap.size()) {
-        return nullptr;
+    insts.clear();
+    for (auto it = instMap.begin();
+         it != instMap.end() && insts.size() < count; ++it) {
+        insts.push_back(&it->second.pkts);
     }
-
-    auto instMapIter = instMap.begin();
-    std::advance(instMapIter, offset);
-
-    return &(instMapIter->second);
 }
 
 void
@@ -128,14 +139,13 @@ UncoalescedTable::updateResources()
         InstSeqNum seq_num = iter->first;
         DPRINTF(GPUCoalescer, "%s checking remaining pkts for %d\n",
                 coalescer->name().c_str(), seq_num);
-        assert(instPktsRemaining.count(seq_num));
+        assert(iter->second.pktsRemaining >= 0);
 
-        if (instPktsRemaining[seq_num] == 0) {
-            assert(iter->second.empty());
+        if (iter->second.pktsRemaining == 0) {
+            assert(iter->second.pkts.empty());
+            RubyRequestType req_type = iter->second.reqType;
 
-            // Remove from both maps
             instMap.erase(iter++);
-            instPktsRemaining.erase(seq_num);
 
             // Release the token if the Ruby system is not in cooldown
             // or warmup phases. When in these phases, the RubyPorts
@@ -144,14 +154,12 @@ UncoalescedTable::updateResources()
             // sending tokens through the port unnecessary
             if (!coalescer->getRubySystem()->getWarmupEnabled() &&
                 !coalescer->getRubySystem()->getCooldownEnabled()) {
-                if (reqTypeMap[seq_num] != RubyRequestType_FLUSH) {
+                if (req_type != RubyRequestType_FLUSH) {
                     DPRINTF(GPUCoalescer,
                             "Returning token seqNum %d\n", seq_num);
                     coalescer->getGMTokenPort().sendTokens(1);
                 }
             }
-
-            reqTypeMap.erase(seq_num);
         } else {
             ++iter;
         }
@@ -160,12 +168,13 @@ UncoalescedTable::updateResources()
 
 bool
 UncoalescedTable::areRequestsDone(const uint64_t instSeqNum) {
-    // iterate the instructions held in UncoalescedTable to see whether there
-    // are more requests to issue; if yes, not yet done; otherwise, done
-    for (auto& inst : instMap) {
-        DPRINTF(GPUCoalescer, "instSeqNum= %d, pending packets=%d\n"
-            ,inst.first, inst.second.size());
-        if (inst.first == instSeqNum) { return false; }
+    // check whether the instruction is still held in UncoalescedTable with
+    // more requests to issue; if yes, not yet done; otherwise, done
+    auto it = instMap.find(instSeqNum);
+    if (it != instMap.end()) {
+        DPRINTF(GPUCoalescer, "instSeqNum= %d, pending packets=%d\n",
+                it->first, it->second.pkts.size());
+        return false;
     }
 
     return true;
@@ -178,7 +187,7 @@ UncoalescedTable::printRequestTable(std::stringstream& ss)
 
     for (auto& inst : instMap) {
         ss << "\tAddr: " << coalescer->printAddress(inst.first) << " with "
-           << inst.second.size() << " pending packets" << std::endl;
+           << inst.second.pkts.size() << " pending packets" << std::endl;
     }
 }
 
@@ -188,7 +197,7 @@ UncoalescedTable::checkDeadlock(Tick threshold)
     Tick current_time = curTick();
 
     for (auto &it : instMap) {
-        for (auto &pkt : it.second) {
+        for (auto &pkt : it.second.pkts) {
             if (current_time - pkt->req->time() > threshold) {
                 std::stringstream ss;
                 printRequestTable(ss);
@@ -289,6 +298,29 @@ GPUCoalescer::GPUCoalescer(const Params &p)
 
 GPUCoalescer::~GPUCoalescer()
 {
+    for (auto creq : coalescedReqPool) {
+        delete creq;
+    }
+}
+
+CoalescedRequest *
+GPUCoalescer::allocCoalescedRequest(uint64_t seq_num)
+{
+    if (coalescedReqPool.empty()) {
+        return new CoalescedRequest(seq_num);
+    }
+
+    CoalescedRequest *creq = coalescedReqPool.back();
+    coalescedReqPool.pop_back();
+    creq->reset(seq_num);
+
+    return creq;
+}
+
+void
+GPUCoalescer::freeCoalescedRequest(CoalescedRequest *creq)
+{
+    coalescedReqPool.push_back(creq);
 }
 
 Port &
@@ -435,22 +467,23 @@ GPUCoalescer::writeCallback(Addr address,
                          bool isRegion)
 {
     assert(address == makeLineAddress(address));
-    assert(coalescedTable.count(address));
+    auto table_it = coalescedTable.find(address);
+    assert(table_it != coalescedTable.end());
+    auto &creqs = table_it->second;
 
-    auto crequest = coalescedTable.at(address).front();
+    auto crequest = creqs.front();
 
     hitCallback(crequest, mach, data, true, crequest->getIssueTime(),
                 forwardRequestTime, firstResponseTime, isRegion, false, false);
 
     // remove this crequest in coalescedTable
-    delete crequest;
-    coalescedTable.at(address).pop_front();
+    freeCoalescedRequest(crequest);
+    creqs.pop_front();
 
-    if (coalescedTable.at(address).empty()) {
-        coalescedTable.erase(address);
+    if (creqs.empty()) {
+        coalescedTable.erase(table_it);
     } else {
-        auto nextRequest = coalescedTable.at(address).front();
-        issueRequest(nextRequest);
+        issueRequest(creqs.front());
     }
 }
 
@@ -525,9 +558,11 @@ GPUCoalescer::readCallback(Addr address,
                         bool externalHit = false)
 {
     assert(address == makeLineAddress(address));
-    assert(coalescedTable.count(address));
+    auto table_it = coalescedTable.find(address);
+    assert(table_it != coalescedTable.end());
+    auto &creqs = table_it->second;
 
-    auto crequest = coalescedTable.at(address).front();
+    auto crequest = creqs.front();
     fatal_if(crequest->getRubyType() != RubyRequestType_LD,
              "readCallback received non-read type response\n");
 
@@ -541,13 +576,13 @@ GPUCoalescer::readCallback(Addr address,
             crequest->getIssueTime(), forwardRequestTime, firstResponseTime,
             isRegion, externalHit, mshr_hit_under_miss);
 
-        delete crequest;
-        coalescedTable.at(address).pop_front();
-        if (coalescedTable.at(address).empty()) {
+        freeCoalescedRequest(crequest);
+        creqs.pop_front();
+        if (creqs.empty()) {
             break;
         }
 
-        crequest = coalescedTable.at(address).front();
+        crequest = creqs.front();
 
         PacketPtr pkt = crequest->getFirstPkt();
         bool is_request_local = !pkt->isGLCSet() && !pkt->isSLCSet();
@@ -558,11 +593,10 @@ GPUCoalescer::readCallback(Addr address,
         mshr_hit_under_miss = true;
     }
 
-    if (coalescedTable.at(address).empty()) {
-        coalescedTable.erase(address);
+    if (creqs.empty()) {
+        coalescedTable.erase(table_it);
     } else {
-        auto nextRequest = coalescedTable.at(address).front();
-        issueRequest(nextRequest);
+        issueRequest(creqs.front());
     }
 }
 
@@ -600,7 +634,7 @@ GPUCoalescer::hitCallback(CoalescedRequest* crequest,
     // update the data
     //
     // MUST ADD DOING THIS FOR EACH REQUEST IN COALESCER
-    std::vector<PacketPtr> pktList = crequest->getPackets();
+    std::vector<PacketPtr> &pktList = crequest->getPackets();
 
     uint8_t* log = nullptr;
     DPRINTF(GPUCoalescer, "Responding to %d packets for addr 0x%X\n",
@@ -720,28 +754,34 @@ GPUCoalescer::makeRequest(PacketPtr pkt)
         // number. The number of packets during simulation depends on the
         // number of lanes actives for that vmem request (i.e., the popcnt
         // of the exec_mask.
-        int num_packets = 1;
-
-        // When Ruby is in warmup or cooldown phase, the requests come from
-        // the cache recorder. There is no dynamic instruction associated
-        // with these requests either
-        if (!m_ruby_system->getWarmupEnabled()
-                && !m_ruby_system->getCooldownEnabled()) {
-            if (!m_usingRubyTester) {
-                num_packets = 0;
-                for (int i = 0; i < TheGpuISA::NumVecElemPerVecReg; i++) {
-                    num_packets += getDynInst(pkt)->getLaneStatus(i);
-                }
-            }
-        }
-
         // the pkt is temporarily stored in the uncoalesced table until
         // it's picked for coalescing process later in this cycle or in a
         // future cycle. Packets remaining is set to the number of excepted
-        // requests from the instruction based on its exec_mask.
+        // requests from the instruction based on its exec_mask. Only the
+        // first packet of an instruction sets it, so only count the lanes
+        // then.
         uncoalescedTable.insertPacket(pkt);
         uncoalescedTable.insertReqType(pkt, getRequestType(pkt));
-        uncoalescedTable.initPacketsRemaining(seq_num, num_packets);
+        if (!uncoalescedTable.hasPacketsRemaining(seq_num)) {
+            int num_packets = 1;
+
+            // When Ruby is in warmup or cooldown phase, the requests come
+            // from the cache recorder. There is no dynamic instruction
+            // associated with these requests either
+            if (!m_ruby_system->getWarmupEnabled()
+                    && !m_ruby_system->getCooldownEnabled()) {
+                if (!m_usingRubyTester) {
+                    GPUDynInstPtr gpu_dyn_inst = getDynInst(pkt);
+                    num_packets = 0;
+                    for (int i = 0; i < TheGpuISA::NumVecElemPerVecReg;
+                         i++) {
+                        num_packets += gpu_dyn_inst->getLaneStatus(i);
+                    }
+                }
+            }
+
+            uncoalescedTable.initPacketsRemaining(seq_num, num_packets);
+        }
         DPRINTF(GPUCoalescer, "Put pkt with addr 0x%X to uncoalescedTable\n",
                 pkt->getAddr());
 
@@ -793,22 +833,88 @@ GPUCoalescer::getDynInst(PacketPtr pkt) const
     return cu_state->_gpuDynInst;
 }
 
+size_t
+GPUCoalescer::coalescePackets(PerInstPackets &pkt_list)
+{
+    // Group the packets of the instruction by cache line so that each
+    // line is looked up in the coalescedTable once rather than once per
+    // lane. Sorting on (line, position) keeps the packets of a line in
+    // their original order, and the groups are then visited in order of
+    // their first packet. Requests are therefore created, filled, and
+    // issued exactly as if the packets were coalesced one at a time.
+    linePkts.clear();
+    int idx = 0;
+    for (auto pkt : pkt_list) {
+        linePkts.push_back({makeLineAddress(pkt->getAddr()), idx++, pkt});
+    }
+
+    std::sort(linePkts.begin(), linePkts.end(),
+        [](const LinePkt &a, const LinePkt &b) {
+            return a.lineAddr < b.lineAddr ||
+                   (a.lineAddr == b.lineAddr && a.idx < b.idx);
+        });
+
+    // (position of the first packet, start in linePkts) for each line
+    lineGroups.clear();
+    for (int i = 0; i < linePkts.size(); ++i) {
+        if (i == 0 || linePkts[i].lineAddr != linePkts[i - 1].lineAddr) {
+            lineGroups.emplace_back(linePkts[i].idx, i);
+        }
+    }
+    std::sort(lineGroups.begin(), lineGroups.end());
+
+    pktCoalesced.assign(linePkts.size(), false);
+    size_t num_coalesced = 0;
+    for (auto &group : lineGroups) {
+        auto begin = linePkts.begin() + group.second;
+        auto end = begin;
+        while (end != linePkts.end() && end->lineAddr == begin->lineAddr) {
+            ++end;
+        }
+
+        if (coalesceLine(begin->lineAddr, begin, end)) {
+            for (auto it = begin; it != end; ++it) {
+                pktCoalesced[it->idx] = true;
+            }
+            num_coalesced += end - begin;
+        }
+    }
+
+    // Leave the packets which could not be coalesced in the list, in
+    // their original order.
+    idx = 0;
+    for (auto it = pkt_list.begin(); it != pkt_list.end(); ) {
+        if (pktCoalesced[idx++]) {
+            it = pkt_list.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    return num_coalesced;
+}
+
+template<typename Iter>
 bool
-GPUCoalescer::coalescePacket(PacketPtr pkt)
+GPUCoalescer::coalesceLine(Addr line_addr, Iter begin, Iter end)
 {
+    PacketPtr pkt = begin->pkt;
     uint64_t seqNum = pkt->req->getReqInstSeqNum();
-    Addr line_addr = makeLineAddress(pkt->getAddr());
 
-    // If the packet has the same line address as a request already in the
-    // coalescedTable and has the same sequence number, it can be coalesced.
-    if (coalescedTable.count(line_addr)) {
+    // If the packets have the same line address as a request already in
+    // the coalescedTable and have the same sequence number, they can be
+    // coalesced.
+    auto table_it = coalescedTable.find(line_addr);
+    if (table_it != coalescedTable.end()) {
         // Search for a previous coalesced request with the same seqNum.
-        auto& creqQueue = coalescedTable.at(line_addr);
+        auto& creqQueue = table_it->second;
         auto citer = std::find_if(creqQueue.begin(), creqQueue.end(),
             [&](CoalescedRequest* c) { return c->getSeqNum() == seqNum; }
         );
         if (citer != creqQueue.end()) {
-            (*citer)->insertPacket(pkt);
+            for (auto it = begin; it != end; ++it) {
+                (*citer)->insertPacket(it->pkt);
+            }
             return true;
         }
     }
@@ -819,26 +925,24 @@ GPUCoalescer::coalescePacket(PacketPtr pkt)
         DPRINTF(GPUCoalescer, "Creating new or aliased request for 0x%X\n",
                 line_addr);
 
-        CoalescedRequest *creq = new CoalescedRequest(seqNum);
-        creq->insertPacket(pkt);
+        CoalescedRequest *creq = allocCoalescedRequest(seqNum);
+        for (auto it = begin; it != end; ++it) {
+            creq->insertPacket(it->pkt);
+        }
         creq->setRubyType(getRequestType(pkt));
         creq->setIssueTime(curCycle());
 
-        if (!coalescedTable.count(line_addr)) {
+        if (table_it == coalescedTable.end()) {
             // If there is no outstanding request for this line address,
             // create a new coalecsed request and issue it immediately.
-            auto reqList = std::deque<CoalescedRequest*> { creq };
-            coalescedTable.insert(std::make_pair(line_addr, reqList));
-            if (!coalescedReqs.count(seqNum)) {
-                coalescedReqs.insert(std::make_pair(seqNum, reqList));
-            } else {
-                coalescedReqs.at(seqNum).push_back(creq);
-            }
+            coalescedTable.emplace(line_addr,
+                                   std::deque<CoalescedRequest*> { creq });
+            coalescedReqs[seqNum].push_back(creq);
         } else {
             // The request is for a line address that is already outstanding
             // but for a different instruction. Add it as a new request to be
             // issued when the current outstanding request is completed.
-            coalescedTable.at(line_addr).push_back(creq);
+            table_it->second.push_back(creq);
             DPRINTF(GPUCoalescer, "found address 0x%X with new seqNum %d\n",
                     line_addr, seqNum);
         }
@@ -892,15 +996,9 @@ GPUCoalescer::completeIssue()
 {
     // Iterate over the maximum number of instructions we can coalesce
     // per cycle (coalescingWindow).
-    for (int instIdx = 0; instIdx < coalescingWindow; ++instIdx) {
-        PerInstPackets *pkt_list =
-            uncoalescedTable.getInstPackets(instIdx);
-
-        // getInstPackets will return nullptr if no instruction
-        // exists at the current offset.
-        if (!pkt_list) {
-            break;
-        } else if (pkt_list->empty()) {
+    uncoalescedTable.getInstPackets(coalescingWindow, issueInsts);
+    for (auto pkt_list : issueInsts) {
+        if (pkt_list->empty()) {
             // Found something, but it has not been cleaned up by update
             // resources yet. See if there is anything else to coalesce.
             // Assume we can't check anymore if the coalescing window is 1.
@@ -909,32 +1007,23 @@ GPUCoalescer::completeIssue()
             // All packets in the list have the same seqNum, use first.
             InstSeqNum seq_num = pkt_list->front()->req->getReqInstSeqNum();
 
-            // The difference in list size before and after tells us the
-            // number of packets which were coalesced.
-            size_t pkt_list_size = pkt_list->size();
-
             // Since we have a pointer to the list of packets in the inst,
             // erase them from the list if coalescing is successful and
             // leave them in the list otherwise. This aggressively attempts
             // to coalesce as many packets as possible from the current inst.
-            pkt_list->remove_if(
-                [&](PacketPtr pkt) { return coalescePacket(pkt); }
-            );
+            size_t pkt_list_diff = coalescePackets(*pkt_list);
 
-            if (coalescedReqs.count(seq_num)) {
-                auto& creqs = coalescedReqs.at(seq_num);
-                for (auto creq : creqs) {
+            auto creqs_it = coalescedReqs.find(seq_num);
+            if (creqs_it != coalescedReqs.end()) {
+                for (auto creq : creqs_it->second) {
                     DPRINTF(GPUCoalescer, "Issued req type %s seqNum %d\n",
                             RubyRequestType_to_string(creq->getRubyType()),
                                                       seq_num);
                     issueRequest(creq);
                 }
-                coalescedReqs.erase(seq_num);
+                coalescedReqs.erase(creqs_it);
             }
 
-            assert(pkt_list_size >= pkt_list->size());
-            size_t pkt_list_diff = pkt_list_size - pkt_list->size();
-
             int num_remaining = uncoalescedTable.getPacketsRemaining(seq_num);
             num_remaining -= pkt_list_diff;
             assert(num_remaining >= 0);
@@ -980,9 +1069,11 @@ GPUCoalescer::atomicCallback(Addr address,
                              const DataBlock& data)
 {
     assert(address == makeLineAddress(address));
-    assert(coalescedTable.count(address));
+    auto table_it = coalescedTable.find(address);
+    assert(table_it != coalescedTable.end());
+    auto &creqs = table_it->second;
 
-    auto crequest = coalescedTable.at(address).front();
+    auto crequest = creqs.front();
 
     fatal_if((crequest->getRubyType() != RubyRequestType_ATOMIC &&
               crequest->getRubyType() != RubyRequestType_ATOMIC_RETURN &&
@@ -992,14 +1083,13 @@ GPUCoalescer::atomicCallback(Addr address,
     hitCallback(crequest, mach, (DataBlock&)data, true,
                 crequest->getIssueTime(), Cycles(0), Cycles(0), false, false);
 
-    delete crequest;
-    coalescedTable.at(address).pop_front();
+    freeCoalescedRequest(crequest);
+    creqs.pop_front();
 
-    if (coalescedTable.at(address).empty()) {
-        coalescedTable.erase(address);
+    if (creqs.empty()) {
+        coalescedTable.erase(table_it);
     } else {
-        auto nextRequest = coalescedTable.at(address).front();
-        issueRequest(nextRequest);
+        issueRequest(creqs.front());
     }
 }
 
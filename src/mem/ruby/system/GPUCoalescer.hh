@@ -81,10 +81,12 @@ class UncoalescedTable
     int getPacketsRemaining(InstSeqNum seqNum);
     void setPacketsRemaining(InstSeqNum seqNum, int count);
 
-    // Returns a pointer to the list of packets corresponding to an
-    // instruction in the instruction map or nullptr if there are no
-    // instructions at the offset.
-    PerInstPackets* getInstPackets(int offset);
+    // Returns true once initPacketsRemaining has been called for seqNum.
+    bool hasPacketsRemaining(InstSeqNum seqNum);
+
+    // Fills insts with pointers to the packet lists of the oldest (up to)
+    // count instructions in the instruction map, in age order.
+    void getInstPackets(int count, std::vector<PerInstPackets*> &insts);
     void updateResources();
     bool areRequestsDone(const InstSeqNum instSeqNum);
 
@@ -95,15 +97,22 @@ class UncoalescedTable
   private:
     GPUCoalescer *coalescer;
 
+    // Per-instruction state. The packets, remaining packet count and
+    // request type of an instruction share a single map entry so that
+    // each packet costs one lookup rather than one per attribute.
+    struct InstEntry
+    {
+        PerInstPackets pkts;
+        // -1 until initPacketsRemaining is called for the instruction
+        int pktsRemaining = -1;
+        RubyRequestType reqType = RubyRequestType_NULL;
+    };
+
     // Maps an instructions unique sequence number to a queue of packets
     // which need responses. This data structure assumes the sequence number
     // is monotonically increasing (which is true for CU class) in order to
     // issue packets in age order.
-    std::map<InstSeqNum, PerInstPackets> instMap;
-
-    std::map<InstSeqNum, int> instPktsRemaining;
-
-    std::map<InstSeqNum, RubyRequestType> reqTypeMap;
+    std::map<InstSeqNum, InstEntry> instMap;
 };
 
 class CoalescedRequest
@@ -115,6 +124,17 @@ class CoalescedRequest
     {}
     ~CoalescedRequest() {}
 
+    // Prepare a recycled request for reuse. The packet vector keeps its
+    // capacity.
+    void
+    reset(uint64_t _seqNum)
+    {
+        seqNum = _seqNum;
+        issueTime = Cycles(0);
+        rubyType = RubyRequestType_NULL;
+        pkts.clear();
+    }
+
     void insertPacket(PacketPtr pkt) { pkts.push_back(pkt); }
     void setSeqNum(uint64_t _seqNum) { seqNum = _seqNum; }
     void setIssueTime(Cycles _issueTime) { issueTime = _issueTime; }
@@ -415,12 +435,26 @@ class GPUCoalescer : public RubyPort
 
     GPUDynInstPtr getDynInst(PacketPtr pkt) const;
 
-    // Attempt to remove a packet from the uncoalescedTable and coalesce
-    // with a previous request from the same instruction. If there is no
-    // previous instruction and the max number of outstanding requests has
-    // not be reached, a new coalesced request is created and added to the
-    // "target" list of the coalescedTable.
-    bool coalescePacket(PacketPtr pkt);
+    // Coalesce the packets of one instruction. Packets are grouped by
+    // cache line and each group is then handled by coalesceLine. Packets
+    // that were coalesced are removed from pkt_list and the others are
+    // left in place, in their original order. Returns the number of
+    // packets coalesced.
+    size_t coalescePackets(PerInstPackets &pkt_list);
+
+    // Attempt to coalesce the packets [begin, end), which all belong to
+    // the same instruction and cache line, with a previous request from
+    // that instruction. If there is no previous request and the max number
+    // of outstanding requests has not be reached, a new coalesced request
+    // is created and added to the "target" list of the coalescedTable.
+    template<typename Iter>
+    bool coalesceLine(Addr line_addr, Iter begin, Iter end);
+
+    // CoalescedRequest objects are created and destroyed for every line
+    // an instruction touches. Retired requests are kept in a free list
+    // and reused instead of going back to the heap.
+    CoalescedRequest *allocCoalescedRequest(uint64_t seq_num);
+    void freeCoalescedRequest(CoalescedRequest *creq);
 
     EventFunctionWrapper issueEvent;
 
@@ -447,10 +481,26 @@ class GPUCoalescer : public RubyPort
     // an address, the are serviced in age order.
     std::map<Addr, std::deque<CoalescedRequest*>> coalescedTable;
     // Map of instruction sequence number to coalesced requests that get
-    // created in coalescePacket, used in completeIssue to send the fully
+    // created in coalescePackets, used in completeIssue to send the fully
     // coalesced request
     std::unordered_map<uint64_t, std::deque<CoalescedRequest*>> coalescedReqs;
 
+    // Free list backing allocCoalescedRequest/freeCoalescedRequest.
+    std::vector<CoalescedRequest*> coalescedReqPool;
+
+    // Scratch space for grouping the packets of an instruction by line in
+    // coalescePackets, kept as members to avoid per-cycle allocation.
+    struct LinePkt
+    {
+        Addr lineAddr;
+        int idx;
+        PacketPtr pkt;
+    };
+    std::vector<LinePkt> linePkts;
+    std::vector<std::pair<int, int>> lineGroups;
+    std::vector<bool> pktCoalesced;
+    std::vector<PerInstPackets*> issueInsts;
+
     // a map btw an instruction sequence number and PendingWriteInst
     // this is used to do a final call back for each write when it is
     // completely done in the memory system
@@ -32,6 +32,8 @@
 #ifndef __MEM_TOKEN_PORT_HH__
 #define __MEM_TOKEN_PORT_HH__
 
+#include <atomic>
+
 #include "mem/port.hh"
 #include "sim/clocked_object.hh"
 
@@ -133,8 +135,11 @@ class TokenManager
     /* Maximum tokens possible */
     int maxTokens;
 
-    /* Number of currently available tokens */
-    int availableTokens;
+    /**
+     * Number of currently available tokens. Atomic because the request
+     * and response sides may run on different event queue threads.
+     */
+    std::atomic<int> availableTokens;
 
   public:
     TokenManager(int init_tokens);
@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/cxx_config_binary.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "base/logging.hh"
+#include "base/str.hh"
+#include "sim/byteswap.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/** Bounds checked reads from the file buffer */
+class Cursor
+{
+  protected:
+    const char *pos;
+    const char *end;
+
+  public:
+    Cursor(const std::vector<char> &buffer) :
+        pos(buffer.data()), end(buffer.data() + buffer.size())
+    { }
+
+    bool atEnd() const { return pos == end; }
+    size_t remaining() const { return end - pos; }
+
+    bool
+    read(uint32_t &value)
+    {
+        if (end - pos < (std::ptrdiff_t)sizeof(value))
+            return false;
+        std::memcpy(&value, pos, sizeof(value));
+        value = letoh(value);
+        pos += sizeof(value);
+        return true;
+    }
+
+    bool
+    read(std::string_view &str, uint32_t length)
+    {
+        if ((size_t)(end - pos) < length)
+            return false;
+        str = std::string_view(pos, length);
+        pos += length;
+        return true;
+    }
+};
+
+void
+writeU32(std::ostream &os, uint32_t value)
+{
+    value = htole(value);
+    os.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+} // anonymous namespace
+
+bool
+CxxBinaryFile::isBinaryConfig(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    char magic[sizeof(Magic)];
+
+    return file.read(magic, sizeof(magic)) &&
+        std::equal(magic, magic + sizeof(magic), Magic);
+}
+
+bool
+CxxBinaryFile::load(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+
+    if (!file)
+        return false;
+
+    std::streamsize size = file.tellg();
+    if (size < 0)
+        return false;
+    file.seekg(0);
+
+    buffer.resize(size);
+    if (!file.read(buffer.data(), size))
+        return false;
+
+    if (!parse()) {
+        warn("Bad binary config file: %s\n", filename);
+        buffer.clear();
+        params.clear();
+        elements.clear();
+        objects.clear();
+        objectNames.clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool
+CxxBinaryFile::parse()
+{
+    Cursor cursor(buffer);
+
+    std::string_view magic;
+    uint32_t version, num_strings, num_objects;
+
+    if (!cursor.read(magic, sizeof(Magic)) ||
+        magic != std::string_view(Magic, sizeof(Magic)) ||
+        !cursor.read(version) || version != Version ||
+        !cursor.read(num_strings) || !cursor.read(num_objects))
+    {
+        return false;
+    }
+
+    /* Every string takes at least its length, so don't trust a count
+     * the rest of the file can't hold before allocating for it. */
+    if (num_strings > cursor.remaining() / sizeof(uint32_t))
+        return false;
+
+    std::vector<std::string_view> strings(num_strings);
+    for (auto &str : strings) {
+        uint32_t length;
+        if (!cursor.read(length) || !cursor.read(str, length))
+            return false;
+    }
+
+    /* Read a string table index into str */
+    auto read_string = [&](std::string_view &str) {
+        uint32_t index;
+        if (!cursor.read(index) || index >= strings.size())
+            return false;
+        str = strings[index];
+        return true;
+    };
+
+    /* Every object takes at least its name and parameter count */
+    if (num_objects > cursor.remaining() / (2 * sizeof(uint32_t)))
+        return false;
+
+    objectNames.reserve(num_objects);
+    objects.reserve(num_objects);
+
+    for (uint32_t o = 0; o < num_objects; o++) {
+        std::string_view object_name;
+        uint32_t num_params;
+
+        if (!read_string(object_name) || !cursor.read(num_params))
+            return false;
+
+        Object object{params.size(), num_params};
+        if (!objects.emplace(object_name, object).second)
+            return false;
+        objectNames.push_back(object_name);
+
+        for (uint32_t p = 0; p < num_params; p++) {
+            Param param;
+            uint32_t num_elements;
+
+            if (!read_string(param.name) || !read_string(param.value) ||
+                !cursor.read(num_elements))
+            {
+                return false;
+            }
+
+            /* Parameters must be sorted for findParam */
+            if (p != 0 && !(params.back().name < param.name))
+                return false;
+
+            param.firstElement = elements.size();
+            param.numElements = num_elements;
+            for (uint32_t e = 0; e < num_elements; e++) {
+                std::string_view element;
+                if (!read_string(element))
+                    return false;
+                elements.push_back(element);
+            }
+
+            params.push_back(param);
+        }
+    }
+
+    return cursor.atEnd();
+}
+
+const CxxBinaryFile::Param *
+CxxBinaryFile::findParam(const std::string &object_name,
+    const std::string &param_name) const
+{
+    auto object = objects.find(object_name);
+
+    if (object == objects.end())
+        return nullptr;
+
+    auto begin = params.begin() + object->second.firstParam;
+    auto end = begin + object->second.numParams;
+    std::string_view name(param_name);
+
+    auto param = std::lower_bound(begin, end, name,
+        [](const Param &param, std::string_view name) {
+            return param.name < name;
+        });
+
+    if (param == end || param->name != name)
+        return nullptr;
+
+    return &*param;
+}
+
+bool
+CxxBinaryFile::getParam(const std::string &object_name,
+    const std::string &param_name,
+    std::string &value) const
+{
+    const Param *param = findParam(object_name, param_name);
+
+    if (!param)
+        return false;
+
+    value = param->value;
+    return true;
+}
+
+bool
+CxxBinaryFile::getParamVector(const std::string &object_name,
+    const std::string &param_name,
+    std::vector<std::string> &values) const
+{
+    const Param *param = findParam(object_name, param_name);
+
+    if (!param)
+        return false;
+
+    auto begin = elements.begin() + param->firstElement;
+    values.insert(values.end(), begin, begin + param->numElements);
+    return true;
+}
+
+bool
+CxxBinaryFile::getParamDict(const std::string &object_name,
+    const std::string &param_name,
+    std::unordered_map<std::string, std::string> &values) const
+{
+    const Param *param = findParam(object_name, param_name);
+
+    if (!param)
+        return false;
+
+    panic_if(param->numElements % 2 != 0,
+        "Dict %s.%s has a key without a value", object_name, param_name);
+
+    for (size_t i = 0; i < param->numElements; i += 2) {
+        std::string key(elements[param->firstElement + i]);
+
+        panic_if(values.find(key) != values.end(),
+            "Key %s already present in Dict", key);
+        values[key] = elements[param->firstElement + i + 1];
+    }
+
+    return true;
+}
+
+bool
+CxxBinaryFile::getPortPeers(const std::string &object_name,
+    const std::string &port_name,
+    std::vector<std::string> &peers) const
+{
+    return getParamVector(object_name, port_name, peers);
+}
+
+bool
+CxxBinaryFile::objectExists(const std::string &object_name) const
+{
+    return objects.find(object_name) != objects.end();
+}
+
+void
+CxxBinaryFile::getAllObjectNames(std::vector<std::string> &list) const
+{
+    list.insert(list.end(), objectNames.begin(), objectNames.end());
+}
+
+void
+CxxBinaryFile::getObjectChildren(const std::string &object_name,
+    std::vector<std::string> &children, bool return_paths) const
+{
+    if (!getParamVector(object_name, "children", children))
+        return;
+
+    if (return_paths && object_name != "root") {
+        for (auto i = children.begin(); i != children.end(); ++i)
+            *i = object_name + "." + *i;
+    }
+}
+
+void
+CxxBinaryFileWriter::addObject(const std::string &object_name)
+{
+    if (objectIndex.emplace(object_name, objects.size()).second) {
+        objects.emplace_back();
+        objects.back().first = object_name;
+    }
+}
+
+void
+CxxBinaryFileWriter::setParam(const std::string &object_name,
+    const std::string &param_name, const std::string &value)
+{
+    addObject(object_name);
+    objects[objectIndex[object_name]].second[param_name] = value;
+}
+
+bool
+CxxBinaryFileWriter::write(const std::string &filename) const
+{
+    /* Intern all the strings, including vector elements */
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, uint32_t> string_index;
+
+    auto intern = [&](const std::string &str) {
+        auto it = string_index.emplace(str, strings.size());
+        if (it.second)
+            strings.push_back(str);
+        return it.first->second;
+    };
+
+    std::vector<uint32_t> object_words;
+
+    for (auto &object : objects) {
+        object_words.push_back(intern(object.first));
+        object_words.push_back(object.second.size());
+
+        /* std::map keeps the parameters sorted by name */
+        for (auto &param : object.second) {
+            std::vector<std::string> param_elements;
+            tokenize(param_elements, param.second, ' ', true);
+
+            object_words.push_back(intern(param.first));
+            object_words.push_back(intern(param.second));
+            object_words.push_back(param_elements.size());
+            for (auto &element : param_elements)
+                object_words.push_back(intern(element));
+        }
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+
+    if (!file)
+        return false;
+
+    file.write(CxxBinaryFile::Magic, sizeof(CxxBinaryFile::Magic));
+    writeU32(file, CxxBinaryFile::Version);
+    writeU32(file, strings.size());
+    writeU32(file, objects.size());
+
+    for (auto &str : strings) {
+        writeU32(file, str.size());
+        file.write(str.data(), str.size());
+    }
+
+    for (auto word : object_words)
+        writeU32(file, word);
+
+    return bool(file);
+}
+
+} // namespace gem5
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *
+ *  Binary config file reading and writing for use with CxxConfigManager
+ *
+ *  The binary format holds the same objects and parameters as a
+ *  config.ini, but with every value already split into its vector
+ *  elements and every string stored once, so it can be loaded without
+ *  any text parsing.  All integers are 32 bit little endian:
+ *
+ *  <pre>
+ *  header:  "gem5cfgb" version num_strings num_objects
+ *  strings: num_strings x (length bytes...)
+ *  objects: num_objects x (name num_params params...)
+ *  param:   name value num_elements elements...
+ *  </pre>
+ *
+ *  Names, values and elements are indices into the string table.  The
+ *  parameters of an object are sorted by name.  util/cxx_config has a
+ *  script which converts a config.ini to this format.
+ */
+
+#ifndef __SIM_CXX_CONFIG_BINARY_HH__
+#define __SIM_CXX_CONFIG_BINARY_HH__
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "sim/cxx_config.hh"
+
+namespace gem5
+{
+
+/** CxxConfigManager interface for using binary config files */
+class CxxBinaryFile : public CxxConfigFileBase
+{
+  public:
+    static constexpr char Magic[8] = {'g', 'e', 'm', '5', 'c', 'f', 'g', 'b'};
+    static constexpr uint32_t Version = 1;
+
+  protected:
+    struct Param
+    {
+        std::string_view name;
+        std::string_view value;
+        /** Index of the first element in elements */
+        size_t firstElement;
+        size_t numElements;
+    };
+
+    struct Object
+    {
+        /** Index of the first parameter in params */
+        size_t firstParam;
+        size_t numParams;
+    };
+
+    /** The contents of the file, which all the string_views point into */
+    std::vector<char> buffer;
+
+    std::vector<Param> params;
+    std::vector<std::string_view> elements;
+    std::unordered_map<std::string_view, Object> objects;
+    /** Object names in the order of the file */
+    std::vector<std::string_view> objectNames;
+
+    const Param *findParam(const std::string &object_name,
+        const std::string &param_name) const;
+
+    /** Parse the file in buffer */
+    bool parse();
+
+  public:
+    CxxBinaryFile() { }
+
+    /** Does the named file start with the binary config magic? */
+    static bool isBinaryConfig(const std::string &filename);
+
+    bool getParam(const std::string &object_name,
+        const std::string &param_name,
+        std::string &value) const;
+
+    bool getParamVector(const std::string &object_name,
+        const std::string &param_name,
+        std::vector<std::string> &values) const;
+
+    bool getParamDict(const std::string &object_name,
+        const std::string &param_name,
+        std::unordered_map<std::string, std::string> &values) const;
+
+    bool getPortPeers(const std::string &object_name,
+        const std::string &port_name,
+        std::vector<std::string> &peers) const;
+
+    bool objectExists(const std::string &object_name) const;
+
+    void getAllObjectNames(std::vector<std::string> &list) const;
+
+    void getObjectChildren(const std::string &object_name,
+        std::vector<std::string> &children,
+        bool return_paths = false) const;
+
+    bool load(const std::string &filename);
+};
+
+/** Builder for binary config files */
+class CxxBinaryFileWriter
+{
+  protected:
+    /** Parameter values by parameter name by object name */
+    std::vector<std::pair<std::string,
+        std::map<std::string, std::string>>> objects;
+    std::unordered_map<std::string, size_t> objectIndex;
+
+  public:
+    /** Add an object, with no parameters if it doesn't exist yet */
+    void addObject(const std::string &object_name);
+
+    /** Set a parameter in the same way as a param=value line in the
+     *  object's section of a config.ini would.  Vector elements are
+     *  separated by spaces */
+    void setParam(const std::string &object_name,
+        const std::string &param_name, const std::string &value);
+
+    /** Write the config to a file.  Returns false if the file can't be
+     *  written */
+    bool write(const std::string &filename) const;
+};
+
+} // namespace gem5
+
+#endif // __SIM_CXX_CONFIG_BINARY_HH__
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "sim/cxx_config_binary.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+class CxxBinaryFileTest : public testing::Test
+{
+  protected:
+    std::string filename;
+    CxxBinaryFile config;
+
+    void
+    SetUp() override
+    {
+        filename = testing::TempDir() + "cxx_config_binary.test.bin";
+
+        CxxBinaryFileWriter writer;
+        writer.setParam("root", "type", "Root");
+        writer.setParam("root", "children", "system");
+        writer.setParam("root", "eventq_index", "0");
+        writer.setParam("system", "type", "System");
+        writer.setParam("system", "children", "cpu  membus");
+        writer.setParam("system", "name", "a  spaced name");
+        writer.setParam("system", "empty", "");
+        writer.setParam("system", "dict", "a 1 b 2");
+        writer.setParam("system", "system_port", "system.membus.cpu_side[0]");
+        writer.addObject("system.cpu");
+        writer.setParam("system.membus", "type", "SystemXBar");
+        ASSERT_TRUE(writer.write(filename));
+
+        ASSERT_TRUE(CxxBinaryFile::isBinaryConfig(filename));
+        ASSERT_TRUE(config.load(filename));
+    }
+
+    void TearDown() override { std::remove(filename.c_str()); }
+};
+
+} // anonymous namespace
+
+TEST_F(CxxBinaryFileTest, Objects)
+{
+    std::vector<std::string> names;
+    config.getAllObjectNames(names);
+    EXPECT_EQ(names, std::vector<std::string>(
+        {"root", "system", "system.cpu", "system.membus"}));
+
+    EXPECT_TRUE(config.objectExists("system.cpu"));
+    EXPECT_FALSE(config.objectExists("system.l2"));
+}
+
+TEST_F(CxxBinaryFileTest, Params)
+{
+    std::string value;
+    EXPECT_TRUE(config.getParam("system", "type", value));
+    EXPECT_EQ(value, "System");
+
+    /* Scalars keep the value exactly as it was written */
+    EXPECT_TRUE(config.getParam("system", "name", value));
+    EXPECT_EQ(value, "a  spaced name");
+    EXPECT_TRUE(config.getParam("system", "empty", value));
+    EXPECT_EQ(value, "");
+
+    EXPECT_FALSE(config.getParam("system", "missing", value));
+    EXPECT_FALSE(config.getParam("system.l2", "type", value));
+    EXPECT_FALSE(config.getParam("system.cpu", "type", value));
+}
+
+TEST_F(CxxBinaryFileTest, Vectors)
+{
+    std::vector<std::string> values;
+    EXPECT_TRUE(config.getParamVector("system", "name", values));
+    EXPECT_EQ(values, std::vector<std::string>({"a", "spaced", "name"}));
+
+    values.clear();
+    EXPECT_TRUE(config.getParamVector("system", "empty", values));
+    EXPECT_TRUE(values.empty());
+
+    std::vector<std::string> peers;
+    EXPECT_TRUE(config.getPortPeers("system", "system_port", peers));
+    EXPECT_EQ(peers,
+        std::vector<std::string>({"system.membus.cpu_side[0]"}));
+}
+
+TEST_F(CxxBinaryFileTest, Dict)
+{
+    std::unordered_map<std::string, std::string> values;
+    EXPECT_TRUE(config.getParamDict("system", "dict", values));
+    EXPECT_EQ(values, (std::unordered_map<std::string, std::string>(
+        {{"a", "1"}, {"b", "2"}})));
+}
+
+TEST_F(CxxBinaryFileTest, Children)
+{
+    std::vector<std::string> children;
+    config.getObjectChildren("root", children, true);
+    EXPECT_EQ(children, std::vector<std::string>({"system"}));
+
+    children.clear();
+    config.getObjectChildren("system", children, true);
+    EXPECT_EQ(children,
+        std::vector<std::string>({"system.cpu", "system.membus"}));
+
+    children.clear();
+    config.getObjectChildren("system", children, false);
+    EXPECT_EQ(children, std::vector<std::string>({"cpu", "membus"}));
+}
+
+TEST_F(CxxBinaryFileTest, Truncated)
+{
+    std::ifstream in(filename, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(in)),
+        std::istreambuf_iterator<char>());
+    in.close();
+
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    out.write(contents.data(), contents.size() - 1);
+    out.close();
+
+    CxxBinaryFile truncated;
+    EXPECT_FALSE(truncated.load(filename));
+    EXPECT_FALSE(truncated.objectExists("root"));
+}
+
+TEST_F(CxxBinaryFileTest, BadCounts)
+{
+    std::ifstream in(filename, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(in)),
+        std::istreambuf_iterator<char>());
+    in.close();
+
+    /* The string and object counts follow the magic and the version */
+    const size_t counts = sizeof(CxxBinaryFile::Magic) + sizeof(uint32_t);
+    for (size_t offset : {counts, counts + sizeof(uint32_t)}) {
+        std::string bad(contents);
+        bad.replace(offset, sizeof(uint32_t), sizeof(uint32_t), '\xff');
+
+        std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+        out.write(bad.data(), bad.size());
+        out.close();
+
+        CxxBinaryFile corrupt;
+        EXPECT_FALSE(corrupt.load(filename));
+    }
+}
+
+TEST_F(CxxBinaryFileTest, NotBinary)
+{
+    std::ofstream out(filename, std::ios::trunc);
+    out << "[root]\ntype=Root\n";
+    out.close();
+
+    EXPECT_FALSE(CxxBinaryFile::isBinaryConfig(filename));
+    CxxBinaryFile ini;
+    EXPECT_FALSE(ini.load(filename));
+}
@@ -37,8 +37,11 @@
 
 #include "sim/cxx_manager.hh"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 
 #include "base/str.hh"
@@ -50,10 +53,44 @@
 namespace gem5
 {
 
+CxxConfigManager::StartupStats::StartupStats() :
+    statistics::Group(nullptr),
+    ADD_STAT(startupHostSeconds, statistics::units::Second::get(),
+        "Host time spent in each phase of instantiation")
+{
+    startupHostSeconds
+        .init(NumStartupPhases)
+        .subname(PhaseParams, "params")
+        .subname(PhaseConstruct, "construct")
+        .subname(PhaseBindPorts, "bindPorts")
+        .subname(PhaseInit, "init")
+        .subname(PhaseRegStats, "regStats")
+        .subname(PhaseRegProbes, "regProbes")
+        .subname(PhaseInitState, "initState")
+        .subname(PhaseStartup, "startup")
+        .precision(6)
+        ;
+}
+
 CxxConfigManager::CxxConfigManager(CxxConfigFileBase &configFile_) :
     configFile(configFile_), flags(configFile_.getFlags()),
-    simObjectResolver(*this)
+    numThreads(1), simObjectResolver(*this)
+{
+}
+
+void
+CxxConfigManager::setNumThreads(unsigned num_threads)
 {
+    numThreads = std::max(num_threads, 1u);
+}
+
+void
+CxxConfigManager::recordPhase(StartupPhase phase,
+    std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    startupStats.startupHostSeconds[phase] += elapsed.count();
 }
 
 const CxxConfigDirectoryEntry &
@@ -66,16 +103,16 @@ CxxConfigManager::findObjectType(const std::string &object_name,
     if (!configFile.getParam(object_name, "type", object_type))
         throw Exception(object_name, "Sim object has no 'type' field");
 
-    if (cxxConfigDirectory().find(object_type) ==
-        cxxConfigDirectory().end())
-    {
+    /* Only use find on the directory, as this may be called from several
+     *  threads at once */
+    auto entry = cxxConfigDirectory().find(object_type);
+
+    if (entry == cxxConfigDirectory().end()) {
         throw Exception(object_name, csprintf(
             "No sim object type %s is available", object_type));
     }
 
-    const CxxConfigDirectoryEntry *entry = cxxConfigDirectory()[object_type];
-
-    return *entry;
+    return *entry->second;
 }
 
 std::string
@@ -371,6 +408,18 @@ CxxConfigManager::findObjectParams(const std::string &object_name)
     if (objectParamsByName.find(instance_name) != objectParamsByName.end())
         return objectParamsByName[instance_name];
 
+    CxxConfigParams *object_params = makeObjectParams(object_name);
+
+    objectParamsByName[instance_name] = object_params;
+
+    return object_params;
+}
+
+CxxConfigParams *
+CxxConfigManager::makeObjectParams(const std::string &object_name)
+{
+    std::string instance_name = rename(object_name);
+
     std::string object_type;
     const CxxConfigDirectoryEntry &entry =
         findObjectType(object_name, object_type);
@@ -462,11 +511,64 @@ CxxConfigManager::findObjectParams(const std::string &object_name)
         throw;
     }
 
-    objectParamsByName[instance_name] = object_params;
-
     return object_params;
 }
 
+void
+CxxConfigManager::findAllObjectParams()
+{
+    /* Objects are built in the same tree walk as findTraversalOrder, so
+     *  only look at the objects it will visit */
+    std::vector<std::string> object_names;
+    std::vector<std::string> to_visit{"root"};
+
+    while (!to_visit.empty()) {
+        std::string object_name = to_visit.back();
+        to_visit.pop_back();
+
+        if (!configFile.objectExists(object_name))
+            continue;
+
+        if (objectParamsByName.find(rename(object_name)) ==
+            objectParamsByName.end())
+        {
+            object_names.push_back(object_name);
+        }
+
+        std::vector<std::string> children;
+        configFile.getObjectChildren(object_name, children, true);
+        to_visit.insert(to_visit.end(), children.begin(), children.end());
+    }
+
+    std::vector<CxxConfigParams *> object_params(object_names.size(),
+        nullptr);
+    std::atomic<size_t> next(0);
+
+    /* Each object's parameters only come from its own section of the
+     *  config file, so threads never look at the same entries */
+    auto build = [&]() {
+        for (size_t i = next++; i < object_names.size(); i = next++) {
+            try {
+                object_params[i] = makeObjectParams(object_names[i]);
+            } catch (Exception &) {
+                /* Left for findObject to report */
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < numThreads; i++)
+        threads.emplace_back(build);
+    build();
+    for (auto &thread : threads)
+        thread.join();
+
+    for (size_t i = 0; i < object_names.size(); i++) {
+        if (object_params[i])
+            objectParamsByName[rename(object_names[i])] = object_params[i];
+    }
+}
+
 void
 CxxConfigManager::findAllObjects()
 {
@@ -651,36 +753,69 @@ CxxConfigManager::forEachObject(void (SimObject::*mem_func)())
 void
 CxxConfigManager::instantiate(bool build_all)
 {
+    auto start = std::chrono::steady_clock::now();
+
     if (build_all) {
+        /* Tracing isn't thread safe, so keep to one thread when the
+         *  configuration is being traced */
+        if (numThreads > 1 && !debug::CxxConfig) {
+            DPRINTF(CxxConfig, "Building all parameters\n");
+            findAllObjectParams();
+        }
+        recordPhase(PhaseParams, start);
+
+        start = std::chrono::steady_clock::now();
         findAllObjects();
+        recordPhase(PhaseConstruct, start);
+
+        start = std::chrono::steady_clock::now();
         bindAllPorts();
+        recordPhase(PhaseBindPorts, start);
+    }
+
+    /* Hang the startup stats off root so that they're dumped along with
+     *  the rest of the stats tree rather than being left parentless */
+    auto root = objectsByName.find(rename("root"));
+    if (root != objectsByName.end() &&
+        !root->second->getStatGroups().count("cxxConfig")) {
+        root->second->addStatGroup("cxxConfig", &startupStats);
     }
 
+    start = std::chrono::steady_clock::now();
     DPRINTF(CxxConfig, "Initialising all objects\n");
     forEachObject(&SimObject::init);
+    recordPhase(PhaseInit, start);
 
+    start = std::chrono::steady_clock::now();
     DPRINTF(CxxConfig, "Registering stats\n");
     forEachObject(&SimObject::regStats);
+    recordPhase(PhaseRegStats, start);
 
+    start = std::chrono::steady_clock::now();
     DPRINTF(CxxConfig, "Registering probe points\n");
     forEachObject(&SimObject::regProbePoints);
 
     DPRINTF(CxxConfig, "Connecting probe listeners\n");
     forEachObject(&SimObject::regProbeListeners);
+    recordPhase(PhaseRegProbes, start);
 }
 
 void
 CxxConfigManager::initState()
 {
+    auto start = std::chrono::steady_clock::now();
     DPRINTF(CxxConfig, "Calling initState on all objects\n");
     forEachObject(&SimObject::initState);
+    recordPhase(PhaseInitState, start);
 }
 
 void
 CxxConfigManager::startup()
 {
+    auto start = std::chrono::steady_clock::now();
     DPRINTF(CxxConfig, "Starting up all objects\n");
     forEachObject(&SimObject::startup);
+    recordPhase(PhaseStartup, start);
 }
 
 unsigned int
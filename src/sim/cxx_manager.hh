@@ -50,6 +50,7 @@
 #ifndef __SIM_CXX_MANAGER_HH__
 #define __SIM_CXX_MANAGER_HH__
 
+#include <chrono>
 #include <list>
 #include <map>
 #include <set>
@@ -57,6 +58,7 @@
 #include <vector>
 
 #include "base/cprintf.hh"
+#include "base/statistics.hh"
 #include "sim/cxx_config.hh"
 
 namespace gem5
@@ -110,7 +112,33 @@ class CxxConfigManager
         { }
     };
 
+    /** The phases of instantiation timed by StartupStats */
+    enum StartupPhase
+    {
+        PhaseParams,
+        PhaseConstruct,
+        PhaseBindPorts,
+        PhaseInit,
+        PhaseRegStats,
+        PhaseRegProbes,
+        PhaseInitState,
+        PhaseStartup,
+        NumStartupPhases
+    };
+
+    /** Host time spent in each phase of instantiation */
+    struct StartupStats : public statistics::Group
+    {
+        StartupStats();
+
+        statistics::Vector startupHostSeconds;
+    };
+
   public:
+    /** Host time taken by instantiate, initState and startup.  This is
+     *  added to root's stats as cxxConfig by instantiate */
+    StartupStats startupStats;
+
     /** SimObject indexed by name */
     std::map<std::string, SimObject *> objectsByName;
 
@@ -128,6 +156,24 @@ class CxxConfigManager
     /** All the renamings applicable when instantiating objects */
     std::list<Renaming> renamings;
 
+    /** Number of host threads used to build ...Params objects */
+    unsigned numThreads;
+
+    /** Make a new ...Params object for the named object from the config
+     *  file.  This doesn't touch any of the manager's maps so it can be
+     *  called for different objects from different threads */
+    CxxConfigParams *makeObjectParams(const std::string &object_name);
+
+    /** Build the ...Params objects of all the objects under root which
+     *  don't have one yet, spreading the work over numThreads threads.
+     *  Objects whose parameters can't be set are skipped, so the errors
+     *  are reported by findObject as usual */
+    void findAllObjectParams();
+
+    /** Add the host time since start to a phase of startupStats */
+    void recordPhase(StartupPhase phase,
+        std::chrono::steady_clock::time_point start);
+
     /** Bind a single connection between two objects' ports */
     void bindPort(SimObject *requestorObject, const std::string &requestPort,
         PortID requestPortIndex, SimObject *responderObject,
@@ -180,6 +226,13 @@ class CxxConfigManager
     const CxxConfigDirectoryEntry &findObjectType(
         const std::string &object_name, std::string &object_type);
 
+    /** Set the number of host threads used by instantiate to set up the
+     *  parameters of the objects.  The SimObjects themselves are always
+     *  constructed and initialised from the calling thread, as they
+     *  register with global structures (the SimObject list, event queues,
+     *  stats) which aren't thread safe */
+    void setNumThreads(unsigned num_threads);
+
     /** Add a name prefix renaming to those currently applied.  Call this
      *  before trying to instantiate any object as the name mappings are
      *  not applied to the config tree read from the config file but are
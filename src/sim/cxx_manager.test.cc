@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include "sim/cxx_config_binary.hh"
+#include "sim/cxx_manager.hh"
+#include "sim/root.hh"
+
+using namespace gem5;
+
+/* statistics.cc resolves stat names through Root, which is too heavy to
+ *  link here.  Nothing in these tests builds a Root */
+Root *Root::_root = nullptr;
+
+namespace
+{
+
+double
+phaseSeconds(CxxConfigManager &manager,
+    CxxConfigManager::StartupPhase phase)
+{
+    return manager.startupStats.startupHostSeconds[phase].value();
+}
+
+} // anonymous namespace
+
+/** Instantiating a config that's already been built times only the
+ *  phases that are run on the existing objects */
+TEST(CxxConfigManagerTest, StartupPhases)
+{
+    CxxBinaryFile config;
+    CxxConfigManager manager(config);
+
+    for (int phase = 0; phase < CxxConfigManager::NumStartupPhases; phase++) {
+        EXPECT_EQ(0.0, phaseSeconds(manager,
+            CxxConfigManager::StartupPhase(phase)));
+    }
+
+    manager.instantiate(false);
+    manager.initState();
+    manager.startup();
+
+    EXPECT_EQ(0.0, phaseSeconds(manager, CxxConfigManager::PhaseParams));
+    EXPECT_EQ(0.0, phaseSeconds(manager, CxxConfigManager::PhaseConstruct));
+    EXPECT_EQ(0.0, phaseSeconds(manager, CxxConfigManager::PhaseBindPorts));
+    EXPECT_GT(phaseSeconds(manager, CxxConfigManager::PhaseInit), 0.0);
+    EXPECT_GT(phaseSeconds(manager, CxxConfigManager::PhaseRegStats), 0.0);
+    EXPECT_GT(phaseSeconds(manager, CxxConfigManager::PhaseRegProbes), 0.0);
+    EXPECT_GT(phaseSeconds(manager, CxxConfigManager::PhaseInitState), 0.0);
+    EXPECT_GT(phaseSeconds(manager, CxxConfigManager::PhaseStartup), 0.0);
+}
+
+/** Phases run more than once accumulate their host time */
+TEST(CxxConfigManagerTest, StartupPhasesAccumulate)
+{
+    CxxBinaryFile config;
+    CxxConfigManager manager(config);
+
+    manager.startup();
+    double first = phaseSeconds(manager, CxxConfigManager::PhaseStartup);
+    manager.startup();
+
+    EXPECT_GT(phaseSeconds(manager, CxxConfigManager::PhaseStartup), first);
+}
+
+/** The per-phase times are visible through the group's stat names */
+TEST(CxxConfigManagerTest, StartupStatsResolve)
+{
+    CxxBinaryFile config;
+    CxxConfigManager manager(config);
+
+    const statistics::Info *info =
+        manager.startupStats.resolveStat("startupHostSeconds");
+    ASSERT_NE(nullptr, info);
+
+    auto vector = dynamic_cast<const statistics::VectorInfo *>(info);
+    ASSERT_NE(nullptr, vector);
+    EXPECT_EQ(CxxConfigManager::NumStartupPhases, vector->size());
+    EXPECT_EQ("init", vector->subnames[CxxConfigManager::PhaseInit]);
+    EXPECT_EQ("startup", vector->subnames[CxxConfigManager::PhaseStartup]);
+}
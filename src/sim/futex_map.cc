@@ -64,17 +64,16 @@ FutexMap::wakeup(Addr addr, uint64_t tgid, int count)
     if (it == end())
         return 0;
 
-    int woken_up = 0;
+    std::vector<ThreadContext *> woken;
     auto &waiterList = it->second;
 
-    while (!waiterList.empty() && woken_up < count) {
+    while (!waiterList.empty() && (int)woken.size() < count) {
         // Threads may be woken up by access to locked
         // memory addresses outside of syscalls, so we
         // must only count threads that were actually
         // woken up by this syscall.
-        auto& tc = waiterList.front().tc;
-        tc->activate();
-        woken_up++;
+        auto tc = waiterList.front().tc;
+        woken.push_back(tc);
         waiterList.pop_front();
         waitingTcs.erase(tc);
     }
@@ -82,7 +81,8 @@ FutexMap::wakeup(Addr addr, uint64_t tgid, int count)
     if (waiterList.empty())
         erase(it);
 
-    return woken_up;
+    activate(woken);
+    return woken.size();
 }
 
 void
@@ -113,7 +113,7 @@ FutexMap::wakeup_bitset(Addr addr, uint64_t tgid, int bitmask)
     if (it == end())
         return 0;
 
-    int woken_up = 0;
+    std::vector<ThreadContext *> woken;
 
     auto &waiterList = it->second;
     auto iter = waiterList.begin();
@@ -122,10 +122,9 @@ FutexMap::wakeup_bitset(Addr addr, uint64_t tgid, int bitmask)
         WaiterState& waiter = *iter;
 
         if (waiter.checkMask(bitmask)) {
-            waiter.tc->activate();
+            woken.push_back(waiter.tc);
             waitingTcs.erase(waiter.tc);
             iter = waiterList.erase(iter);
-            woken_up++;
         } else {
             ++iter;
         }
@@ -134,7 +133,8 @@ FutexMap::wakeup_bitset(Addr addr, uint64_t tgid, int bitmask)
     if (waiterList.empty())
         erase(it);
 
-    return woken_up;
+    activate(woken);
+    return woken.size();
 }
 
 int
@@ -146,13 +146,12 @@ FutexMap::requeue(Addr addr1, uint64_t tgid, int count, int count2, Addr addr2)
     if (it1 == end())
         return 0;
 
-    int woken_up = 0;
+    std::vector<ThreadContext *> woken;
     auto &waiterList1 = it1->second;
 
-    while (!waiterList1.empty() && woken_up < count) {
-        waiterList1.front().tc->activate();
+    while (!waiterList1.empty() && (int)woken.size() < count) {
+        woken.push_back(waiterList1.front().tc);
         waiterList1.pop_front();
-        woken_up++;
     }
 
     WaiterList tmpList;
@@ -178,7 +177,18 @@ FutexMap::requeue(Addr addr1, uint64_t tgid, int count, int count2, Addr addr2)
     if (waiterList1.empty())
         erase(it1);
 
-    return woken_up + requeued;
+    activate(woken);
+    return woken.size() + requeued;
+}
+
+void
+FutexMap::activate(const std::vector<ThreadContext *> &woken)
+{
+    // Waking up a thread context may temporarily migrate to the event
+    // queue of its CPU, letting other system calls run and change the
+    // map, so it is only done once the map is consistent again.
+    for (auto *tc : woken)
+        tc->activate();
 }
 
 bool
@@ -31,6 +31,7 @@
 
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <cpu/thread_context.hh>
 
@@ -139,6 +140,8 @@ class FutexMap : public std::unordered_map<FutexKey, WaiterList>
     bool is_waiting(ThreadContext *tc);
 
   private:
+    /** Wake up the threads removed from the map by an operation */
+    void activate(const std::vector<ThreadContext *> &woken);
 
     std::unordered_set<ThreadContext *> waitingTcs;
 };
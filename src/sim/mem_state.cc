@@ -29,6 +29,8 @@
 #include "sim/mem_state.hh"
 
 #include <cassert>
+#include <utility>
+#include <vector>
 
 #include "arch/generic/mmu.hh"
 #include "debug/Vma.hh"
@@ -82,24 +84,16 @@ bool
 MemState::isUnmapped(Addr start_addr, Addr length)
 {
     Addr end_addr = start_addr + length;
-    const AddrRange range(start_addr, end_addr);
-    for (const auto &vma : _vmaList) {
-        if (vma.intersects(range))
-            return false;
-    }
+    if (_vmaList.intersects(start_addr, length))
+        return false;
 
     /**
      * In case someone skips the VMA interface and just directly maps memory
      * also consult the page tables to make sure that this memory isnt mapped.
      */
-    for (auto start = start_addr; start < end_addr;
-         start += _pageBytes) {
-        if (_ownerProcess->pTable->lookup(start) != nullptr) {
-            panic("Someone allocated physical memory at VA %p without "
-                  "creating a VMA!\n", start);
-            return false;
-        }
-    }
+    panic_if(!_ownerProcess->pTable->isUnmapped(start_addr, length),
+             "Someone allocated physical memory in [%p - %p] without "
+             "creating a VMA!\n", start_addr, end_addr);
     return true;
 }
 
@@ -138,11 +132,8 @@ MemState::updateBrkRegion(Addr old_brk, Addr new_brk)
     /**
      * Create a new mapping for the heap region. We only create a mapping
      * for the extra memory that is requested so we do not create a situation
-     * where there can be overlapping mappings in the regions.
-     *
-     * Since we do not track the type of the region and we also do not
-     * coalesce the regions together, we can create a fragmented set of
-     * heap regions.
+     * where there can be overlapping mappings in the regions. The new
+     * mapping is coalesced with the existing heap region by mapRegion.
      */
     if (page_aligned_new_brk > page_aligned_old_brk) {
         auto length = page_aligned_new_brk - page_aligned_old_brk;
@@ -155,13 +146,6 @@ MemState::updateBrkRegion(Addr old_brk, Addr new_brk)
             return;
         }
 
-        /**
-         * Note that the heap regions are always contiguous but there is
-         * no mechanism right now to coalesce together memory that belongs
-         * to the same region with similar access permissions. This could be
-         * implemented if it actually becomes necessary; probably only
-         * necessary if the list becomes too long to walk.
-         */
         mapRegion(page_aligned_old_brk, length, "heap");
     }
 
@@ -181,81 +165,14 @@ MemState::mapRegion(Addr start_addr, Addr length,
      */
     assert(isUnmapped(start_addr, length));
 
-    /**
-     * Record the region in our list structure.
-     */
-    _vmaList.emplace_back(AddrRange(start_addr, start_addr + length),
-                          _pageBytes, region_name, sim_fd, offset);
+    _vmaList.map(start_addr, length, _pageBytes, region_name, sim_fd,
+                 offset);
 }
 
 void
 MemState::unmapRegion(Addr start_addr, Addr length)
 {
-    Addr end_addr = start_addr + length;
-    const AddrRange range(start_addr, end_addr);
-
-    auto vma = std::begin(_vmaList);
-    while (vma != std::end(_vmaList)) {
-        if (vma->isStrictSuperset(range)) {
-            DPRINTF(Vma, "memstate: split vma [0x%x - 0x%x] into "
-                    "[0x%x - 0x%x] and [0x%x - 0x%x]\n",
-                    vma->start(), vma->end(),
-                    vma->start(), start_addr,
-                    end_addr, vma->end());
-            /**
-             * Need to split into two smaller regions.
-             * Create a clone of the old VMA and slice it to the right.
-             */
-            _vmaList.push_back(*vma);
-            _vmaList.back().sliceRegionRight(start_addr);
-
-            /**
-             * Slice old VMA to encapsulate the left region.
-             */
-            vma->sliceRegionLeft(end_addr);
-
-            /**
-             * Region cannot be in any more VMA, because it is completely
-             * contained in this one!
-             */
-            break;
-        } else if (vma->isSubset(range)) {
-            DPRINTF(Vma, "memstate: destroying vma [0x%x - 0x%x]\n",
-                    vma->start(), vma->end());
-            /**
-             * Need to nuke the existing VMA.
-             */
-            vma = _vmaList.erase(vma);
-
-            continue;
-
-        } else if (vma->intersects(range)) {
-            /**
-             * Trim up the existing VMA.
-             */
-            if (vma->start() < start_addr) {
-                DPRINTF(Vma, "memstate: resizing vma [0x%x - 0x%x] "
-                        "into [0x%x - 0x%x]\n",
-                        vma->start(), vma->end(),
-                        vma->start(), start_addr);
-                /**
-                 * Overlaps from the right.
-                 */
-                vma->sliceRegionRight(start_addr);
-            } else {
-                DPRINTF(Vma, "memstate: resizing vma [0x%x - 0x%x] "
-                        "into [0x%x - 0x%x]\n",
-                        vma->start(), vma->end(),
-                        end_addr, vma->end());
-                /**
-                 * Overlaps from the left.
-                 */
-                vma->sliceRegionLeft(end_addr);
-            }
-        }
-
-        vma++;
-    }
+    _vmaList.unmap(start_addr, length);
 
     /**
      * TLBs need to be flushed to remove any stale mappings from regions
@@ -279,79 +196,19 @@ void
 MemState::remapRegion(Addr start_addr, Addr new_start_addr, Addr length)
 {
     /**
-     * Unmap new virtual region before doing anything else.
+     * The physical pages are moved one at a time, which only works if
+     * the ranges don't overlap. mremap refuses such moves, like Linux.
      */
-    unmapRegion(new_start_addr, length);
+    assert(new_start_addr + length <= start_addr ||
+           start_addr + length <= new_start_addr);
 
-    Addr end_addr = start_addr + length;
-    const AddrRange range(start_addr, end_addr);
-
-    auto vma = std::begin(_vmaList);
-    while (vma != std::end(_vmaList)) {
-        if (vma->isStrictSuperset(range)) {
-            /**
-             * Create clone of the old VMA and slice right.
-             */
-            _vmaList.push_back(*vma);
-            _vmaList.back().sliceRegionRight(start_addr);
-
-            /**
-             * Create clone of the old VMA and slice it left.
-             */
-            _vmaList.push_back(*vma);
-            _vmaList.back().sliceRegionLeft(end_addr);
-
-            /**
-             * Slice the old VMA left and right to adjust the file backing,
-             * then overwrite the virtual addresses!
-             */
-            vma->sliceRegionLeft(start_addr);
-            vma->sliceRegionRight(end_addr);
-            vma->remap(new_start_addr);
-
-            /**
-             * The region cannot be in any more VMAs, because it is
-             * completely contained in this one!
-             */
-            break;
-        } else if (vma->isSubset(range)) {
-            /**
-             * Just go ahead and remap it!
-             */
-            vma->remap(vma->start() - start_addr + new_start_addr);
-        } else if (vma->intersects(range)) {
-            /**
-             * Create a clone of the old VMA.
-             */
-            _vmaList.push_back(*vma);
-
-            if (vma->start() < start_addr) {
-                /**
-                 * Overlaps from the right.
-                 */
-                _vmaList.back().sliceRegionRight(start_addr);
-
-                /**
-                 * Remap the old region.
-                 */
-                vma->sliceRegionLeft(start_addr);
-                vma->remap(new_start_addr);
-            } else {
-                /**
-                 * Overlaps from the left.
-                 */
-                _vmaList.back().sliceRegionLeft(end_addr);
-
-                /**
-                 * Remap the old region.
-                 */
-                vma->sliceRegionRight(end_addr);
-                vma->remap(new_start_addr + vma->start() - start_addr);
-            }
-        }
+    /**
+     * Unmap new virtual region before doing anything else, so the pages
+     * which were mapped there are released.
+     */
+    unmapRegion(new_start_addr, length);
 
-        vma++;
-    }
+    _vmaList.move(start_addr, new_start_addr, length);
 
     /**
      * TLBs need to be flushed to remove any stale mappings from regions
@@ -365,22 +222,15 @@ MemState::remapRegion(Addr start_addr, Addr new_start_addr, Addr length)
         tc->getMMUPtr()->flushAll();
     }
 
-    do {
-        if (!_ownerProcess->pTable->isUnmapped(start_addr, _pageBytes))
-            _ownerProcess->pTable->remap(start_addr, _pageBytes,
-                                         new_start_addr);
-
-        start_addr += _pageBytes;
-        new_start_addr += _pageBytes;
-
-        /**
-         * The regions need to always be page-aligned otherwise the while
-         * condition will loop indefinitely. (The Addr type is currently
-         * defined to be uint64_t in src/base/types.hh; it can underflow
-         * since it is unsigned.)
-         */
-        length -= _pageBytes;
-    } while (length > 0);
+    /**
+     * Only the pages which have been touched have a physical page to move.
+     */
+    std::vector<std::pair<Addr, Addr>> mappings;
+    _ownerProcess->pTable->getMappings(start_addr, length, &mappings);
+    for (const auto &mapping : mappings) {
+        _ownerProcess->pTable->remap(mapping.first, _pageBytes,
+                mapping.first - start_addr + new_start_addr);
+    }
 }
 
 bool
@@ -390,31 +240,31 @@ MemState::fixupFault(Addr vaddr)
      * Check if we are accessing a mapped virtual address. If so then we
      * just haven't allocated it a physical page yet and can do so here.
      */
-    for (const auto &vma : _vmaList) {
-        if (vma.contains(vaddr)) {
-            Addr vpage_start = roundDown(vaddr, _pageBytes);
-            _ownerProcess->allocateMem(vpage_start, _pageBytes);
+    auto it = _vmaList.endingAfter(vaddr);
+    if (it != _vmaList.end() && it->second.contains(vaddr)) {
+        const VMA &vma = it->second;
+        Addr vpage_start = roundDown(vaddr, _pageBytes);
+        _ownerProcess->allocateMem(vpage_start, _pageBytes);
 
+        /**
+         * We are assuming that fresh pages are zero-filled, so there is
+         * no need to zero them out when there is no backing file.
+         * This assumption will not hold true if/when physical pages
+         * are recycled.
+         */
+        if (vma.hasHostBuf()) {
             /**
-             * We are assuming that fresh pages are zero-filled, so there is
-             * no need to zero them out when there is no backing file.
-             * This assumption will not hold true if/when physical pages
-             * are recycled.
+             * Write the memory for the host buffer contents for all
+             * ThreadContexts associated with this process.
              */
-            if (vma.hasHostBuf()) {
-                /**
-                 * Write the memory for the host buffer contents for all
-                 * ThreadContexts associated with this process.
-                 */
-                for (auto &cid : _ownerProcess->contextIds) {
-                    auto *tc = _ownerProcess->system->threads[cid];
-                    SETranslatingPortProxy
-                        virt_mem(tc, SETranslatingPortProxy::Always);
-                    vma.fillMemPages(vpage_start, _pageBytes, virt_mem);
-                }
+            for (auto &cid : _ownerProcess->contextIds) {
+                auto *tc = _ownerProcess->system->threads[cid];
+                SETranslatingPortProxy
+                    virt_mem(tc, SETranslatingPortProxy::Always);
+                vma.fillMemPages(vpage_start, _pageBytes, virt_mem);
             }
-            return true;
         }
+        return true;
     }
 
     /**
@@ -458,14 +308,18 @@ MemState::extendMmap(Addr length)
 
     // Look for a contiguous region of free virtual memory.  We can't assume
     // that the region beyond mmap_end is free because of fixed mappings from
-    // the user.
-    while (!isUnmapped(start, length)) {
+    // the user. Skip straight past any region in the way.
+    auto vma = _vmaList.endingAfter(start);
+    while (vma != _vmaList.end() && vma->second.start() < start + length) {
         DPRINTF(Vma, "memstate: cannot extend vma for mmap region at %p. "
-                "Virtual address range is already reserved! Skipping a page "
-                "and trying again!\n", start);
-        start = (_ownerProcess->mmapGrowsDown()) ? start - _pageBytes :
-            start + _pageBytes;
+                "Virtual address range is already reserved by [%p - %p]! "
+                "Skipping it and trying again!\n", start,
+                vma->second.start(), vma->second.end());
+        start = (_ownerProcess->mmapGrowsDown()) ?
+            vma->second.start() - length : vma->second.end();
+        vma = _vmaList.endingAfter(start);
     }
+    assert(isUnmapped(start, length));
 
     DPRINTF(Vma, "memstate: extending mmap region (old %p) (new %p)\n",
             _mmapEnd,
@@ -481,7 +335,7 @@ MemState::printVmaList()
 {
     std::stringstream file_content;
 
-    for (auto vma : _vmaList) {
+    for (const auto &[start, vma] : _vmaList) {
         std::stringstream line;
         line << std::hex << vma.start() << "-";
         line << std::hex << vma.end() << " ";
@@ -32,7 +32,6 @@
 #include <fcntl.h>
 #include <unistd.h>
 
-#include <list>
 #include <memory>
 #include <string>
 #include <vector>
@@ -42,6 +41,7 @@
 #include "mem/se_translating_port_proxy.hh"
 #include "sim/serialize.hh"
 #include "sim/vma.hh"
+#include "sim/vma_map.hh"
 
 namespace gem5
 {
@@ -199,7 +199,7 @@ class MemState : public Serializable
         ScopedCheckpointSection sec(cp, "vmalist");
         paramOut(cp, "size", _vmaList.size());
         int count = 0;
-        for (auto vma : _vmaList) {
+        for (const auto &[start, vma] : _vmaList) {
             ScopedCheckpointSection sec(cp, csprintf("Vma%d", count++));
             paramOut(cp, "name", vma.getName());
             if (vma.hasHostBuf()) {
@@ -240,8 +240,8 @@ class MemState : public Serializable
             }
             paramIn(cp, "addrRangeStart", start);
             paramIn(cp, "addrRangeEnd", end);
-            _vmaList.emplace_back(AddrRange(start, end), _pageBytes, name,
-                                  host_fd, offset);
+            _vmaList.emplace(start, VMA(AddrRange(start, end), _pageBytes,
+                                        name, host_fd, offset));
             close(host_fd);
         }
     }
@@ -278,18 +278,18 @@ class MemState : public Serializable
     Addr _mmapEnd;
 
     /**
-     * The _vmaList member is a list of virtual memory areas in the target
+     * The _vmaList member holds the virtual memory areas in the target
      * application space that have been allocated by the target. In most
      * operating systems, lazy allocation is used and these structures (or
      * equivalent ones) are used to track the valid address ranges.
      *
-     * This could use a more efficient data structure like an interval
-     * tree, but it is unclear whether the vmas will be modified often enough
-     * for the improvement in lookup time to matter. Unmapping VMAs currently
-     * modifies the list while iterating so the STL container must either
-     * support this or the unmapping method must be changed.
+     * The regions never overlap, so keying them by their start address
+     * is enough to find the region holding an address, and the regions
+     * touched by a (un)mapping, in logarithmic time. Applications such as
+     * language runtimes and custom allocators create thousands of
+     * mappings, which made a linear list a bottleneck.
      */
-    std::list<VMA> _vmaList;
+    VmaMap _vmaList;
 };
 
 } // namespace gem5
@@ -329,7 +329,7 @@ Process::allocateMem(Addr vaddr, int64_t size, bool clobber)
     // a physical page frame to map with the virtual page. Other cores can
     // return if the page has been mapped and `!clobber`.
     if (!clobber) {
-        const EmulationPageTable::Entry *pte = pTable->lookup(page_addr);
+        auto pte = pTable->lookup(page_addr);
         if (pte) {
             warn("Process::allocateMem: addr %#x already mapped\n", vaddr);
             return;
@@ -350,35 +350,33 @@ Process::deallocateMem(Addr vaddr, int64_t size)
     const auto page_size = pTable->pageSize();
     const Addr page_vbase = roundDown(vaddr, page_size);
     const Addr page_vend = roundUp(vaddr + size, page_size);
-    const int npages = (page_vend - page_vbase) / page_size;
 
     // Free any physical pages that were mapped to by this virtual
-    // address range.
-    for (int i = 0; i < npages; ++i) {
-        const Addr page_vaddr = page_vbase + page_size * i;
-        Addr page_paddr;
-        if (pTable->translate(page_vaddr, page_paddr)) {
-            if (zeroPages) {
-                // Zero out the physical page upon deallocation.
-                // Pages that have never been allocated before are already
-                // zero-filled. Zeroing out deallocated pages ensures that
-                // if they're ever reallocated, they will be zero-filled.
-                // Note that zeroing out pages before allocation would
-                // achieve the same result, but would be more expensive
-                // because it would unnecessarily zero out pages that
-                // were allocated for the first time.
-                SETranslatingPortProxy virt_mem(
-                    system->threads[0], SETranslatingPortProxy::Always);
-                const std::vector<uint8_t> zero_page(page_size, 0);
-                virt_mem.writeBlob(page_vaddr, zero_page.data(), page_size);
-            }
+    // address range. Pages are allocated lazily, so only visit the ones
+    // which have actually been touched.
+    std::vector<std::pair<Addr, Addr>> mappings;
+    pTable->getMappings(page_vbase, page_vend - page_vbase, &mappings);
+    for (const auto &[page_vaddr, page_paddr] : mappings) {
+        if (zeroPages) {
+            // Zero out the physical page upon deallocation.
+            // Pages that have never been allocated before are already
+            // zero-filled. Zeroing out deallocated pages ensures that
+            // if they're ever reallocated, they will be zero-filled.
+            // Note that zeroing out pages before allocation would
+            // achieve the same result, but would be more expensive
+            // because it would unnecessarily zero out pages that
+            // were allocated for the first time.
+            SETranslatingPortProxy virt_mem(
+                system->threads[0], SETranslatingPortProxy::Always);
+            const std::vector<uint8_t> zero_page(page_size, 0);
+            virt_mem.writeBlob(page_vaddr, zero_page.data(), page_size);
+        }
 
-            // Unmap the virtual page.
-            pTable->unmap(page_vaddr, page_size);
+        // Unmap the virtual page.
+        pTable->unmap(page_vaddr, page_size);
 
-            // Deallocate the physical page.
-            seWorkload->deallocPhysPage(page_paddr);
-        }
+        // Deallocate the physical page.
+        seWorkload->deallocPhysPage(page_paddr);
     }
 }
 
@@ -404,6 +402,10 @@ Process::replicatePage(Addr vaddr, Addr new_paddr, ThreadContext *old_tc,
 bool
 Process::fixupFault(Addr vaddr)
 {
+    // Faults change the address space just like system calls do, so they
+    // have to be serialized with them when CPUs run in parallel.
+    EventQueue::ScopedMigration migrate(system->eventQueue(),
+                                        inParallelMode);
     return memState->fixupFault(vaddr);
 }
 
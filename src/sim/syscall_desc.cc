@@ -30,17 +30,23 @@
 #include "sim/syscall_desc.hh"
 
 #include "base/types.hh"
+#include "cpu/thread_context.hh"
 #include "sim/eventq.hh"
 #include "sim/syscall_debug_macros.hh"
+#include "sim/system.hh"
 
 namespace gem5
 {
 
-class ThreadContext;
-
 void
 SyscallDesc::doSyscall(ThreadContext *tc)
 {
+    // The emulated kernel state (processes, file descriptors, futexes...)
+    // is shared by all the CPUs. When they run on separate event queues,
+    // system calls are serialized by running them on the system's queue.
+    EventQueue::ScopedMigration migrate(tc->getSystemPtr()->eventQueue(),
+                                        inParallelMode);
+
     DPRINTF_SYSCALL(Base, "Calling %s...\n", dumper(name(), tc));
 
     SyscallReturn retval = executor(this, tc);
@@ -60,6 +66,9 @@ SyscallDesc::doSyscall(ThreadContext *tc)
 void
 SyscallDesc::retrySyscall(ThreadContext *tc)
 {
+    EventQueue::ScopedMigration migrate(tc->getSystemPtr()->eventQueue(),
+                                        inParallelMode);
+
     DPRINTF_SYSCALL(Base, "Retrying %s...\n", dumper(name(), tc));
 
     SyscallReturn retval = executor(this, tc);
@@ -1393,6 +1393,16 @@ mremapFunc(SyscallDesc *desc, ThreadContext *tc,
 
     new_length = roundUp(new_length, page_bytes);
 
+    // Like Linux, refuse to move a region onto a range which overlaps it.
+    // Keeping it where it is with MREMAP_FIXED is still allowed when the
+    // region shrinks, or grows at the end of the mmap area.
+    if (use_provided_address && provided_address != start &&
+        provided_address < start + old_length &&
+        start < provided_address + new_length) {
+        warn("mremap failing: source and destination overlap");
+        return -EINVAL;
+    }
+
     if (new_length > old_length) {
         Addr mmap_end = p->memState->getMmapEnd();
 
@@ -1408,6 +1418,9 @@ mremapFunc(SyscallDesc *desc, ThreadContext *tc,
             if (!use_provided_address && !(flags & OS::TGT_MREMAP_MAYMOVE)) {
                 warn("can't remap here and MREMAP_MAYMOVE flag not set\n");
                 return -ENOMEM;
+            } else if (use_provided_address && provided_address == start) {
+                warn("mremap failing: can't grow in place here\n");
+                return -EINVAL;
             } else {
                 uint64_t new_start = provided_address;
                 if (!use_provided_address) {
@@ -1422,11 +1435,6 @@ mremapFunc(SyscallDesc *desc, ThreadContext *tc,
                      new_start, new_start + new_length,
                      new_length - old_length);
 
-                // add on the remaining unallocated pages
-                p->allocateMem(new_start + old_length,
-                               new_length - old_length,
-                               use_provided_address /* clobber */);
-
                 if (use_provided_address &&
                     ((new_start + new_length > p->memState->getMmapEnd() &&
                       !p->mmapGrowsDown()) ||
@@ -1439,16 +1447,25 @@ mremapFunc(SyscallDesc *desc, ThreadContext *tc,
 
                 warn("returning %08p as start\n", new_start);
                 p->memState->remapRegion(start, new_start, old_length);
+
+                // add on the remaining pages, which are allocated lazily
+                // like those of any other mapping
+                Addr tail_start = new_start + old_length;
+                Addr tail_length = new_length - old_length;
+                if (use_provided_address)
+                    p->memState->unmapRegion(tail_start, tail_length);
+                p->memState->mapRegion(tail_start, tail_length, "remapped");
                 return new_start;
             }
         }
     } else {
-        // Shrink a region
-        if (use_provided_address && provided_address != start)
-            p->memState->remapRegion(start, provided_address, new_length);
+        // Shrink a region, dropping its tail before moving what is left
+        // of it so the tail can't be unmapped from the destination
         if (new_length != old_length)
             p->memState->unmapRegion(start + new_length,
                                      old_length - new_length);
+        if (use_provided_address && provided_address != start)
+            p->memState->remapRegion(start, provided_address, new_length);
         return use_provided_address ? provided_address : (Addr)start;
     }
 }
@@ -1936,10 +1953,23 @@ readvFunc(SyscallDesc *desc, ThreadContext *tc,
 
     SETranslatingPortProxy prox(tc);
     auto tiov = std::make_unique<typename OS::tgt_iovec[]>(count);
-    auto hiov = std::make_unique<struct iovec[]>(count);
     for (typename OS::size_t i = 0; i < count; ++i) {
         prox.readBlob(tiov_base + (i * sizeof(typename OS::tgt_iovec)),
                       &tiov[i], sizeof(typename OS::tgt_iovec));
+    }
+
+    HostIovecArg host_iov(tc, true);
+    for (typename OS::size_t i = 0; i < count && host_iov.valid(); ++i) {
+        host_iov.append(gtoh(tiov[i].iov_base, OS::byteOrder),
+                        gtoh(tiov[i].iov_len, OS::byteOrder));
+    }
+    if (host_iov.valid()) {
+        int result = readv(sim_fd, host_iov.iov(), host_iov.iovcnt());
+        return (result == -1) ? -errno : result;
+    }
+
+    auto hiov = std::make_unique<struct iovec[]>(count);
+    for (typename OS::size_t i = 0; i < count; ++i) {
         hiov[i].iov_len = gtoh(tiov[i].iov_len, OS::byteOrder);
         hiov[i].iov_base = new char [hiov[i].iov_len];
     }
@@ -1973,16 +2003,28 @@ writevFunc(SyscallDesc *desc, ThreadContext *tc,
     int sim_fd = hbfdp->getSimFD();
 
     SETranslatingPortProxy prox(tc);
-    auto hiov = std::make_unique<struct iovec[]>(count);
+    auto tiov = std::make_unique<typename OS::tgt_iovec[]>(count);
     for (typename OS::size_t i = 0; i < count; ++i) {
-        typename OS::tgt_iovec tiov;
-
         prox.readBlob(tiov_base + i*sizeof(typename OS::tgt_iovec),
-                      &tiov, sizeof(typename OS::tgt_iovec));
-        hiov[i].iov_len = gtoh(tiov.iov_len, OS::byteOrder);
+                      &tiov[i], sizeof(typename OS::tgt_iovec));
+    }
+
+    HostIovecArg host_iov(tc, false);
+    for (typename OS::size_t i = 0; i < count && host_iov.valid(); ++i) {
+        host_iov.append(gtoh(tiov[i].iov_base, OS::byteOrder),
+                        gtoh(tiov[i].iov_len, OS::byteOrder));
+    }
+    if (host_iov.valid()) {
+        int result = writev(sim_fd, host_iov.iov(), host_iov.iovcnt());
+        return (result == -1) ? -errno : result;
+    }
+
+    auto hiov = std::make_unique<struct iovec[]>(count);
+    for (typename OS::size_t i = 0; i < count; ++i) {
+        hiov[i].iov_len = gtoh(tiov[i].iov_len, OS::byteOrder);
         hiov[i].iov_base = new char [hiov[i].iov_len];
-        prox.readBlob(gtoh(tiov.iov_base, OS::byteOrder), hiov[i].iov_base,
-                      hiov[i].iov_len);
+        prox.readBlob(gtoh(tiov[i].iov_base, OS::byteOrder),
+                      hiov[i].iov_base, hiov[i].iov_len);
     }
 
     int result = writev(sim_fd, hiov.get(), count);
@@ -2149,6 +2191,13 @@ pread64Func(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
+    HostIovecArg host_iov(tc, bufPtr, nbytes, true);
+    if (host_iov.valid()) {
+        int bytes_read = preadv(sim_fd, host_iov.iov(), host_iov.iovcnt(),
+                                offset);
+        return (bytes_read == -1) ? -errno : bytes_read;
+    }
+
     BufferArg bufArg(bufPtr, nbytes);
 
     int bytes_read = pread(sim_fd, bufArg.bufferPtr(), nbytes, offset);
@@ -2171,6 +2220,13 @@ pwrite64Func(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
+    HostIovecArg host_iov(tc, bufPtr, nbytes, false);
+    if (host_iov.valid()) {
+        int bytes_written = pwritev(sim_fd, host_iov.iov(),
+                                    host_iov.iovcnt(), offset);
+        return (bytes_written == -1) ? -errno : bytes_written;
+    }
+
     BufferArg bufArg(bufPtr, nbytes);
     bufArg.copyIn(SETranslatingPortProxy(tc));
 
@@ -2812,6 +2868,12 @@ readFunc(SyscallDesc *desc, ThreadContext *tc,
         && !(hbfdp->getFlags() & OS::TGT_O_NONBLOCK))
         return SyscallReturn::retry();
 
+    HostIovecArg host_iov(tc, buf_ptr, nbytes, true);
+    if (host_iov.valid()) {
+        int bytes_read = readv(sim_fd, host_iov.iov(), host_iov.iovcnt());
+        return (bytes_read == -1) ? -errno : bytes_read;
+    }
+
     BufferArg buf_arg(buf_ptr, nbytes);
     int bytes_read = read(sim_fd, buf_arg.bufferPtr(), nbytes);
 
@@ -2833,9 +2895,6 @@ writeFunc(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = hbfdp->getSimFD();
 
-    BufferArg buf_arg(buf_ptr, nbytes);
-    buf_arg.copyIn(SETranslatingPortProxy(tc));
-
     struct pollfd pfd;
     pfd.fd = sim_fd;
     pfd.events = POLLOUT;
@@ -2852,7 +2911,15 @@ writeFunc(SyscallDesc *desc, ThreadContext *tc,
             return SyscallReturn::retry();
     }
 
-    int bytes_written = write(sim_fd, buf_arg.bufferPtr(), nbytes);
+    int bytes_written;
+    HostIovecArg host_iov(tc, buf_ptr, nbytes, false);
+    if (host_iov.valid()) {
+        bytes_written = writev(sim_fd, host_iov.iov(), host_iov.iovcnt());
+    } else {
+        BufferArg buf_arg(buf_ptr, nbytes);
+        buf_arg.copyIn(SETranslatingPortProxy(tc));
+        bytes_written = write(sim_fd, buf_arg.bufferPtr(), nbytes);
+    }
 
     if (bytes_written != -1)
         fsync(sim_fd);
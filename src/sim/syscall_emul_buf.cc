@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/syscall_emul_buf.hh"
+
+#include <climits>
+
+#include "base/chunk_generator.hh"
+#include "cpu/thread_context.hh"
+#include "mem/page_table.hh"
+#include "mem/physical.hh"
+#include "sim/process.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+HostIovecArg::HostIovecArg(ThreadContext *tc, bool to_target)
+    : process(tc->getProcessPtr()), toTarget(to_target),
+      _valid(process->system->bypassCaches())
+{
+}
+
+bool
+HostIovecArg::append(Addr addr, uint64_t size)
+{
+    if (!_valid)
+        return false;
+
+    EmulationPageTable *pt = process->pTable;
+    const memory::PhysicalMemory &physmem = process->system->getPhysMem();
+
+    for (ChunkGenerator gen(addr, size, pt->pageSize()); !gen.done();
+            gen.next()) {
+        Addr paddr;
+        if (!pt->translate(gen.addr(), paddr)) {
+            // Only allocate the page if copying out of a BufferArg would
+            // have, otherwise let the slow path deal with the access.
+            if (!toTarget || !process->fixupFault(gen.addr()) ||
+                    !pt->translate(gen.addr(), paddr)) {
+                _valid = false;
+                return false;
+            }
+        }
+
+        uint8_t *host = physmem.toHostAddr(paddr, gen.size());
+        if (!host) {
+            _valid = false;
+            return false;
+        }
+
+        if (!_iov.empty() &&
+                (uint8_t *)_iov.back().iov_base + _iov.back().iov_len ==
+                host) {
+            _iov.back().iov_len += gen.size();
+        } else if (_iov.size() < IOV_MAX) {
+            _iov.push_back({host, gen.size()});
+        } else {
+            _valid = false;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace gem5
@@ -35,7 +35,10 @@
 /// This file defines buffer classes used to handle pointer arguments
 /// in emulated syscalls.
 
+#include <sys/uio.h>
+
 #include <cstring>
+#include <vector>
 
 #include "base/types.hh"
 #include "mem/se_translating_port_proxy.hh"
@@ -43,6 +46,9 @@
 namespace gem5
 {
 
+class Process;
+class ThreadContext;
+
 /**
  * Base class for BufferArg and TypedBufferArg, Not intended to be
  * used directly.
@@ -168,6 +174,59 @@ class TypedBufferArg : public BaseBufferArg
     T &operator[](int i) { return ((T *)bufPtr)[i]; }
 };
 
+/**
+ * HostIovecArg resolves buffers in target user space to the host memory
+ * backing them, so an emulated system call can hand them straight to
+ * readv()/writev() and friends instead of going through a BufferArg and
+ * copying the data a second time.
+ *
+ * This is only possible when the memory system holds no copy of the
+ * data outside of the backing store, i.e. when the system bypasses the
+ * caches, and when every page of the buffers is mapped. Callers must
+ * check valid() and fall back to a BufferArg otherwise.
+ */
+class HostIovecArg
+{
+  public:
+    /**
+     * @param tc The thread context of the calling thread.
+     * @param to_target Whether the system call writes to the buffers.
+     *        Pages which haven't been touched yet are then allocated as
+     *        they would be when copying out of a BufferArg.
+     */
+    HostIovecArg(ThreadContext *tc, bool to_target);
+
+    /**
+     * Convenience constructor for a single buffer.
+     */
+    HostIovecArg(ThreadContext *tc, Addr addr, uint64_t size,
+                 bool to_target)
+        : HostIovecArg(tc, to_target)
+    {
+        append(addr, size);
+    }
+
+    /**
+     * Add the buffer at target address addr to the end of the vector.
+     *
+     * @return Whether the vector is still valid.
+     */
+    bool append(Addr addr, uint64_t size);
+
+    bool valid() const { return _valid; }
+
+    const struct iovec *iov() const { return _iov.data(); }
+    int iovcnt() const { return _iov.size(); }
+
+  private:
+    Process *process;
+    const bool toTarget;
+    bool _valid;
+
+    /** Host buffers, with physically contiguous pages merged */
+    std::vector<struct iovec> _iov;
+};
+
 } // namespace gem5
 
 #endif // __SIM_SYSCALL_EMUL_BUF_HH__
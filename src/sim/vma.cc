@@ -97,6 +97,21 @@ VMA::sliceRegionLeft(Addr slice_addr)
     sanityCheck();
 }
 
+void
+VMA::extendRegion(const AddrRange &r)
+{
+    assert(!hasHostBuf());
+    assert(r.start() == _addrRange.end() || r.end() == _addrRange.start());
+
+    _addrRange = AddrRange(std::min(r.start(), _addrRange.start()),
+                           std::max(r.end(), _addrRange.end()));
+
+    DPRINTF(Vma, "extend vma start %#x end %#x\n", _addrRange.start(),
+            _addrRange.end());
+
+    sanityCheck();
+}
+
 void
 VMA::sanityCheck()
 {
@@ -104,7 +104,15 @@ class VMA
      */
     void sliceRegionLeft(Addr slice_addr);
 
-    const std::string& getName() { return _vmaName; }
+    /**
+     * Grow an anonymous region so that it also covers the adjacent range
+     * r. This is used to coalesce neighbouring regions, which keeps the
+     * number of regions down for processes that grow their heap or their
+     * mmap area in small steps.
+     */
+    void extendRegion(const AddrRange &r);
+
+    const std::string& getName() const { return _vmaName; }
     off_t getFileMappingOffset() const
     {
         return hasHostBuf() ? _origHostBuf->getOffset() : 0;
@@ -113,9 +121,9 @@ class VMA
     /**
      * Defer AddrRange related calls to the AddrRange.
      */
-    Addr size() { return _addrRange.size(); }
-    Addr start() { return _addrRange.start(); }
-    Addr end() { return _addrRange.end(); }
+    Addr size() const { return _addrRange.size(); }
+    Addr start() const { return _addrRange.start(); }
+    Addr end() const { return _addrRange.end(); }
 
     bool
     mergesWith(const AddrRange& r) const
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/vma_map.hh"
+
+#include <cassert>
+#include <iterator>
+#include <vector>
+
+#include "base/trace.hh"
+#include "debug/Vma.hh"
+
+namespace gem5
+{
+
+VmaMap::iterator
+VmaMap::endingAfter(Addr addr)
+{
+    auto vma = upper_bound(addr);
+    if (vma != begin() && std::prev(vma)->second.end() > addr)
+        return std::prev(vma);
+    return vma;
+}
+
+bool
+VmaMap::intersects(Addr start_addr, Addr length)
+{
+    auto vma = endingAfter(start_addr);
+    return vma != end() && vma->second.start() < start_addr + length;
+}
+
+void
+VmaMap::map(Addr start_addr, Addr length, Addr page_bytes,
+            const std::string &name, int sim_fd, Addr offset)
+{
+    assert(!intersects(start_addr, length));
+
+    const AddrRange range(start_addr, start_addr + length);
+
+    if (sim_fd == -1) {
+        auto next = lower_bound(start_addr);
+        auto mergeable = [&](const VMA &vma) {
+            return !vma.hasHostBuf() && vma.getName() == name;
+        };
+
+        if (next != begin()) {
+            VMA &prev = std::prev(next)->second;
+            if (prev.end() == start_addr && mergeable(prev)) {
+                prev.extendRegion(range);
+                if (next != end() && next->second.start() == prev.end() &&
+                        mergeable(next->second)) {
+                    prev.extendRegion(AddrRange(next->second.start(),
+                                                next->second.end()));
+                    erase(next);
+                }
+                return;
+            }
+        }
+
+        if (next != end() && next->second.start() == range.end() &&
+                mergeable(next->second)) {
+            auto node = extract(next);
+            node.key() = start_addr;
+            node.mapped().extendRegion(range);
+            insert(std::move(node));
+            return;
+        }
+    }
+
+    [[maybe_unused]] bool inserted = emplace(start_addr,
+        VMA(range, page_bytes, name, sim_fd, offset)).second;
+    assert(inserted);
+}
+
+void
+VmaMap::unmap(Addr start_addr, Addr length)
+{
+    Addr end_addr = start_addr + length;
+    const AddrRange range(start_addr, end_addr);
+
+    auto vma = endingAfter(start_addr);
+    while (vma != end() && vma->second.start() < end_addr) {
+        VMA &region = vma->second;
+        if (region.isStrictSuperset(range)) {
+            DPRINTF(Vma, "memstate: split vma [0x%x - 0x%x] into "
+                    "[0x%x - 0x%x] and [0x%x - 0x%x]\n",
+                    region.start(), region.end(),
+                    region.start(), start_addr,
+                    end_addr, region.end());
+            /**
+             * Need to split into two smaller regions.
+             * Create a clone of the old VMA and slice it to the left.
+             */
+            VMA right(region);
+            right.sliceRegionLeft(end_addr);
+
+            /**
+             * Slice old VMA to encapsulate the left region.
+             */
+            region.sliceRegionRight(start_addr);
+            emplace_hint(std::next(vma), end_addr, std::move(right));
+
+            /**
+             * Region cannot be in any more VMA, because it is completely
+             * contained in this one!
+             */
+            break;
+        } else if (region.isSubset(range)) {
+            DPRINTF(Vma, "memstate: destroying vma [0x%x - 0x%x]\n",
+                    region.start(), region.end());
+            /**
+             * Need to nuke the existing VMA.
+             */
+            vma = erase(vma);
+
+            continue;
+
+        } else if (region.start() < start_addr) {
+            DPRINTF(Vma, "memstate: resizing vma [0x%x - 0x%x] "
+                    "into [0x%x - 0x%x]\n",
+                    region.start(), region.end(),
+                    region.start(), start_addr);
+            /**
+             * Overlaps from the right.
+             */
+            region.sliceRegionRight(start_addr);
+        } else {
+            DPRINTF(Vma, "memstate: resizing vma [0x%x - 0x%x] "
+                    "into [0x%x - 0x%x]\n",
+                    region.start(), region.end(),
+                    end_addr, region.end());
+            /**
+             * Overlaps from the left. The region now starts at the end
+             * of the unmapped range, so it has to be rekeyed, and no
+             * region above it can intersect the range.
+             */
+            auto node = extract(vma);
+            node.key() = end_addr;
+            node.mapped().sliceRegionLeft(end_addr);
+            insert(std::move(node));
+            break;
+        }
+
+        vma++;
+    }
+}
+
+void
+VmaMap::move(Addr start_addr, Addr new_start_addr, Addr length)
+{
+    Addr end_addr = start_addr + length;
+
+    /**
+     * Take the parts of the regions which are inside the range out of the
+     * map, leaving the parts outside of it where they are.
+     */
+    std::vector<VMA> moved;
+    auto vma = endingAfter(start_addr);
+    while (vma != end() && vma->second.start() < end_addr) {
+        VMA region = std::move(vma->second);
+        vma = erase(vma);
+
+        if (region.start() < start_addr) {
+            /**
+             * Overlaps from the right, keep the part left of the range.
+             */
+            VMA left(region);
+            left.sliceRegionRight(start_addr);
+            emplace_hint(vma, left.start(), std::move(left));
+            region.sliceRegionLeft(start_addr);
+        }
+
+        if (region.end() > end_addr) {
+            /**
+             * Overlaps from the left, keep the part right of the range.
+             */
+            VMA right(region);
+            right.sliceRegionLeft(end_addr);
+            vma = emplace_hint(vma, end_addr, std::move(right));
+            region.sliceRegionRight(end_addr);
+        }
+
+        region.remap(region.start() - start_addr + new_start_addr);
+        moved.push_back(std::move(region));
+    }
+
+    /**
+     * Clear the destination, then put the regions back. Nothing can be
+     * in their way anymore, so they can't collide with anything.
+     */
+    unmap(new_start_addr, length);
+    for (auto &region : moved) {
+        [[maybe_unused]] bool inserted =
+            emplace(region.start(), std::move(region)).second;
+        assert(inserted);
+    }
+}
+
+} // namespace gem5
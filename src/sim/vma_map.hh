@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_VMA_MAP_HH__
+#define __SIM_VMA_MAP_HH__
+
+#include <map>
+#include <string>
+
+#include "base/types.hh"
+#include "sim/vma.hh"
+
+namespace gem5
+{
+
+/**
+ * The virtual memory areas of an address space, keyed by their start
+ * address. The regions never overlap, so the region holding an address,
+ * and the regions touched by a (un)mapping, are found in logarithmic
+ * time.
+ */
+class VmaMap : public std::map<Addr, VMA>
+{
+  public:
+    /**
+     * Find the region containing addr or, if there is none, the first
+     * region above it.
+     *
+     * @param addr The virtual address to look for.
+     * @return An iterator to the region, or end().
+     */
+    iterator endingAfter(Addr addr);
+
+    /** Whether any region intersects the range. */
+    bool intersects(Addr start_addr, Addr length);
+
+    /**
+     * Add a region over a range no region intersects. Anonymous regions
+     * are coalesced with the anonymous regions of the same name they are
+     * adjacent to, like Linux does. This keeps the heap in a single
+     * region no matter how many times brk grows it.
+     */
+    void map(Addr start_addr, Addr length, Addr page_bytes,
+             const std::string &name, int sim_fd, Addr offset);
+
+    /**
+     * Remove a range, splitting, trimming or removing the regions it
+     * intersects.
+     */
+    void unmap(Addr start_addr, Addr length);
+
+    /**
+     * Move the parts of the regions inside a range to new_start_addr,
+     * replacing whatever was mapped at the destination. The two ranges
+     * may overlap.
+     */
+    void move(Addr start_addr, Addr new_start_addr, Addr length);
+};
+
+} // namespace gem5
+
+#endif // __SIM_VMA_MAP_HH__
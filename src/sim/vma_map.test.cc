@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "sim/vma_map.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const Addr PageBytes = 0x1000;
+
+struct Region
+{
+    Addr start;
+    Addr end;
+    std::string name;
+
+    bool
+    operator==(const Region &r) const
+    {
+        return start == r.start && end == r.end && name == r.name;
+    }
+};
+
+std::ostream &
+operator<<(std::ostream &os, const Region &r)
+{
+    return os << std::hex << "[" << r.start << "-" << r.end << " " <<
+        r.name << "]";
+}
+
+/**
+ * The regions of a map, after checking they are keyed by their start
+ * and sorted without overlapping.
+ */
+std::vector<Region>
+regions(const VmaMap &vmas)
+{
+    std::vector<Region> result;
+    Addr last_end = 0;
+    for (const auto &[start, vma] : vmas) {
+        EXPECT_EQ(start, vma.start());
+        EXPECT_LE(last_end, vma.start());
+        last_end = vma.end();
+        result.push_back({vma.start(), vma.end(), vma.getName()});
+    }
+    return result;
+}
+
+void
+map(VmaMap &vmas, Addr start, Addr end, const std::string &name)
+{
+    vmas.map(start, end - start, PageBytes, name, -1, 0);
+}
+
+} // anonymous namespace
+
+TEST(VmaMapTest, MapCoalesces)
+{
+    VmaMap vmas;
+    map(vmas, 0x10000, 0x12000, "heap");
+    map(vmas, 0x14000, 0x16000, "heap");
+    map(vmas, 0x12000, 0x14000, "heap");
+    map(vmas, 0x16000, 0x17000, "other");
+
+    EXPECT_EQ(regions(vmas), std::vector<Region>({
+        {0x10000, 0x16000, "heap"}, {0x16000, 0x17000, "other"}}));
+}
+
+TEST(VmaMapTest, EndingAfter)
+{
+    VmaMap vmas;
+    map(vmas, 0x10000, 0x12000, "a");
+    map(vmas, 0x14000, 0x16000, "b");
+
+    EXPECT_EQ(vmas.endingAfter(0x0)->first, 0x10000);
+    EXPECT_EQ(vmas.endingAfter(0x11fff)->first, 0x10000);
+    EXPECT_EQ(vmas.endingAfter(0x12000)->first, 0x14000);
+    EXPECT_EQ(vmas.endingAfter(0x16000), vmas.end());
+
+    EXPECT_TRUE(vmas.intersects(0x11000, 0x1000));
+    EXPECT_TRUE(vmas.intersects(0x12000, 0x3000));
+    EXPECT_FALSE(vmas.intersects(0x12000, 0x2000));
+}
+
+TEST(VmaMapTest, Unmap)
+{
+    VmaMap vmas;
+    map(vmas, 0x10000, 0x18000, "a");
+    map(vmas, 0x20000, 0x24000, "b");
+    map(vmas, 0x30000, 0x34000, "c");
+
+    // Split a, trim b from the left and remove c
+    vmas.unmap(0x12000, 0x2000);
+    vmas.unmap(0x1f000, 0x2000);
+    vmas.unmap(0x2f000, 0x6000);
+
+    EXPECT_EQ(regions(vmas), std::vector<Region>({
+        {0x10000, 0x12000, "a"}, {0x14000, 0x18000, "a"},
+        {0x21000, 0x24000, "b"}}));
+}
+
+TEST(VmaMapTest, ShrinkInPlace)
+{
+    VmaMap vmas;
+    map(vmas, 0x10000, 0x18000, "a");
+    map(vmas, 0x18000, 0x1a000, "b");
+
+    vmas.unmap(0x14000, 0x4000);
+
+    EXPECT_EQ(regions(vmas), std::vector<Region>({
+        {0x10000, 0x14000, "a"}, {0x18000, 0x1a000, "b"}}));
+}
+
+TEST(VmaMapTest, MoveOntoOccupied)
+{
+    VmaMap vmas;
+    map(vmas, 0x10000, 0x14000, "a");
+    map(vmas, 0x20000, 0x24000, "b");
+
+    // The region moved over b replaces it
+    vmas.move(0x10000, 0x20000, 0x4000);
+
+    EXPECT_EQ(regions(vmas), std::vector<Region>({
+        {0x20000, 0x24000, "a"}}));
+}
+
+TEST(VmaMapTest, MovePartialOverlap)
+{
+    VmaMap vmas;
+    map(vmas, 0x10000, 0x14000, "a");
+    map(vmas, 0x20000, 0x24000, "b");
+    map(vmas, 0x24000, 0x28000, "c");
+
+    // The destination covers the end of b and the start of c, and the
+    // start of a stays where it is
+    vmas.move(0x11000, 0x22000, 0x3000);
+    EXPECT_EQ(regions(vmas), std::vector<Region>({
+        {0x10000, 0x11000, "a"}, {0x20000, 0x22000, "b"},
+        {0x22000, 0x25000, "a"}, {0x25000, 0x28000, "c"}}));
+
+    // The moved region starts where a region already does
+    vmas.move(0x22000, 0x10000, 0x1000);
+    EXPECT_EQ(regions(vmas), std::vector<Region>({
+        {0x10000, 0x11000, "a"}, {0x20000, 0x22000, "b"},
+        {0x23000, 0x25000, "a"}, {0x25000, 0x28000, "c"}}));
+}
+
+TEST(VmaMapTest, MoveOverlappingSelf)
+{
+    VmaMap vmas;
+    map(vmas, 0x10000, 0x14000, "a");
+    map(vmas, 0x14000, 0x18000, "b");
+
+    vmas.move(0x10000, 0x12000, 0x4000);
+
+    EXPECT_EQ(regions(vmas), std::vector<Region>({
+        {0x12000, 0x16000, "a"}, {0x16000, 0x18000, "b"}}));
+}
@@ -37,3 +37,9 @@ class OutgoingRequestBridge(SimObject):
     physical_address_ranges = VectorParam.AddrRange(
         [AddrRange(0x80000000, MaxAddr)], "Physical address ranges."
     )
+    max_batch_size = Param.Unsigned(
+        1,
+        "Maximum number of timing requests forwarded to SST at once. "
+        "Requests received during a tick are batched up to this number, "
+        "1 forwards each request as soon as it is received.",
+    )
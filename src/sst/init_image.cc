@@ -0,0 +1,66 @@
+// Copyright (c) 2026 The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met: redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer;
+// redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution;
+// neither the name of the copyright holders nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "sst/init_image.hh"
+
+namespace gem5
+{
+
+void
+SSTInitImage::add(Addr addr, const uint8_t *data, uint64_t size)
+{
+    if (records != 0) {
+        RecordHeader last;
+        std::memcpy(&last, image.data() + lastRecord, sizeof(last));
+        if (last.addr + last.size == addr) {
+            // Extend the last record, which is at the end of the image.
+            size_t data_start = lastRecord + sizeof(last);
+            last.size += size;
+            image.resize(data_start + paddedSize(last.size));
+            std::memcpy(image.data() + data_start + last.size - size,
+                        data, size);
+            std::memcpy(image.data() + lastRecord, &last, sizeof(last));
+            return;
+        }
+    }
+
+    RecordHeader header{addr, size};
+    lastRecord = image.size();
+    image.resize(lastRecord + sizeof(header) + paddedSize(size));
+    std::memcpy(image.data() + lastRecord, &header, sizeof(header));
+    std::memcpy(image.data() + lastRecord + sizeof(header), data, size);
+    records++;
+}
+
+void
+SSTInitImage::clear()
+{
+    image.clear();
+    records = 0;
+    lastRecord = 0;
+}
+
+} // namespace gem5
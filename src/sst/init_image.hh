@@ -0,0 +1,107 @@
+// Copyright (c) 2026 The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met: redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer;
+// redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution;
+// neither the name of the copyright holders nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef __SST_INIT_IMAGE_HH__
+#define __SST_INIT_IMAGE_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * SSTInitImage holds the memory contents gem5 writes functionally before
+ * the SST memory hierarchy is connected, so they can be replayed into SST
+ * at init time.
+ *
+ * The contents are packed in a single buffer as a sequence of records,
+ * each made of a 64 bit address, a 64 bit size and the data, padded to 8
+ * bytes. A write which starts where the previous one ended is appended to
+ * its record, so loading a binary one block at a time ends up as a few
+ * large records rather than many small ones. Records are kept in the
+ * order they were written, so replaying them in order gives the same
+ * memory contents as the original writes.
+ */
+class SSTInitImage
+{
+  public:
+    struct RecordHeader
+    {
+        uint64_t addr;
+        uint64_t size;
+    };
+
+    /** Add the data of a functional write to the image. */
+    void add(Addr addr, const uint8_t *data, uint64_t size);
+
+    /**
+     * Call f(addr, data, size) for each record of the image, in the order
+     * they were written.
+     */
+    template <class F>
+    void
+    forEachRecord(F &&f) const
+    {
+        size_t offset = 0;
+        while (offset < image.size()) {
+            RecordHeader header;
+            std::memcpy(&header, image.data() + offset, sizeof(header));
+            offset += sizeof(header);
+            f(header.addr, image.data() + offset, header.size);
+            offset += paddedSize(header.size);
+        }
+    }
+
+    /** The packed image. */
+    const std::vector<uint8_t> &buffer() const { return image; }
+
+    size_t numRecords() const { return records; }
+    bool empty() const { return records == 0; }
+
+    void clear();
+
+  private:
+    static uint64_t
+    paddedSize(uint64_t size)
+    {
+        return (size + 7) & ~uint64_t(7);
+    }
+
+    std::vector<uint8_t> image;
+    size_t records = 0;
+
+    /** Offset of the header of the last record in the image */
+    size_t lastRecord = 0;
+};
+
+} // namespace gem5
+
+#endif // __SST_INIT_IMAGE_HH__
@@ -0,0 +1,110 @@
+// Copyright (c) 2026 The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met: redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer;
+// redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution;
+// neither the name of the copyright holders nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <vector>
+
+#include "sst/init_image.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+using Record = std::tuple<Addr, std::vector<uint8_t>>;
+
+std::vector<Record>
+records(const SSTInitImage &image)
+{
+    std::vector<Record> result;
+    image.forEachRecord([&](Addr addr, const uint8_t *data, uint64_t size) {
+        result.emplace_back(addr, std::vector<uint8_t>(data, data + size));
+    });
+    return result;
+}
+
+} // anonymous namespace
+
+TEST(SSTInitImageTest, Empty)
+{
+    SSTInitImage image;
+    EXPECT_TRUE(image.empty());
+    EXPECT_TRUE(image.buffer().empty());
+    EXPECT_TRUE(records(image).empty());
+}
+
+TEST(SSTInitImageTest, ContiguousWritesAreCoalesced)
+{
+    SSTInitImage image;
+    const uint8_t a[] = {1, 2, 3};
+    const uint8_t b[] = {4, 5, 6, 7, 8, 9};
+    image.add(0x1000, a, sizeof(a));
+    image.add(0x1003, b, sizeof(b));
+
+    EXPECT_EQ(image.numRecords(), 1);
+    // One header and 9 bytes of data padded to 16.
+    EXPECT_EQ(image.buffer().size(), sizeof(SSTInitImage::RecordHeader) + 16);
+
+    auto recs = records(image);
+    ASSERT_EQ(recs.size(), 1);
+    EXPECT_EQ(std::get<0>(recs[0]), 0x1000);
+    EXPECT_EQ(std::get<1>(recs[0]),
+              std::vector<uint8_t>({1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST(SSTInitImageTest, RecordsKeepWriteOrder)
+{
+    SSTInitImage image;
+    const uint8_t a[] = {1, 2};
+    const uint8_t b[] = {3};
+    const uint8_t c[] = {4, 5, 6, 7, 8, 9, 10, 11, 12};
+    image.add(0x2000, a, sizeof(a));
+    image.add(0x1000, b, sizeof(b));
+    image.add(0x2000, c, sizeof(c));
+
+    auto recs = records(image);
+    ASSERT_EQ(recs.size(), 3);
+    EXPECT_EQ(recs[0], Record(0x2000, {1, 2}));
+    EXPECT_EQ(recs[1], Record(0x1000, {3}));
+    EXPECT_EQ(recs[2], Record(0x2000, {4, 5, 6, 7, 8, 9, 10, 11, 12}));
+}
+
+TEST(SSTInitImageTest, Clear)
+{
+    SSTInitImage image;
+    const uint8_t a[] = {1, 2};
+    image.add(0x2000, a, sizeof(a));
+    image.clear();
+    EXPECT_TRUE(image.empty());
+
+    // A write following the old record must not be merged into it.
+    image.add(0x2002, a, sizeof(a));
+    auto recs = records(image);
+    ASSERT_EQ(recs.size(), 1);
+    EXPECT_EQ(recs[0], Record(0x2002, {1, 2}));
+}
@@ -30,6 +30,7 @@
 #include <iomanip>
 #include <sstream>
 
+#include "base/logging.hh"
 #include "base/trace.hh"
 
 namespace gem5
@@ -41,8 +42,14 @@ OutgoingRequestBridge::OutgoingRequestBridge(
     outgoingPort(std::string(name()), this),
     sstResponder(nullptr),
     physicalAddressRanges(params.physical_address_ranges.begin(),
-                          params.physical_address_ranges.end())
+                          params.physical_address_ranges.end()),
+    maxBatchSize(params.max_batch_size),
+    flushRequestsEvent([this]{ flushRequests(); }, name() + ".flushRequests",
+                       false, Event::Sim_Exit_Pri - 1)
 {
+    fatal_if(maxBatchSize == 0, "%s: max_batch_size must be at least 1.",
+             name());
+    pendingRequests.reserve(maxBatchSize);
 }
 
 OutgoingRequestBridge::~OutgoingRequestBridge()
@@ -84,7 +91,14 @@ OutgoingRequestBridge::getAddrRanges() const
 std::vector<std::pair<Addr, std::vector<uint8_t>>>
 OutgoingRequestBridge::getInitData() const
 {
-    return initData;
+    std::vector<std::pair<Addr, std::vector<uint8_t>>> init_data;
+    init_data.reserve(initImage.numRecords());
+    initImage.forEachRecord(
+        [&](Addr addr, const uint8_t *data, uint64_t size) {
+            init_data.emplace_back(
+                addr, std::vector<uint8_t>(data, data + size));
+        });
+    return init_data;
 }
 
 void
@@ -108,10 +122,41 @@ OutgoingRequestBridge::sendTimingSnoopReq(gem5::PacketPtr pkt)
 void
 OutgoingRequestBridge::handleRecvFunctional(PacketPtr pkt)
 {
-    uint8_t* ptr = pkt->getPtr<uint8_t>();
-    uint64_t size = pkt->getSize();
-    std::vector<uint8_t> data(ptr, ptr+size);
-    initData.push_back(std::make_pair(pkt->getAddr(), data));
+    initImage.add(pkt->getAddr(), pkt->getConstPtr<uint8_t>(),
+                  pkt->getSize());
+}
+
+void
+OutgoingRequestBridge::handleRecvTimingReq(PacketPtr pkt)
+{
+    if (maxBatchSize == 1) {
+        sstResponder->handleRecvTimingReq(pkt);
+        return;
+    }
+
+    pendingRequests.push_back(pkt);
+    if (pendingRequests.size() == maxBatchSize) {
+        flushRequests();
+    } else if (!flushRequestsEvent.scheduled()) {
+        // Forward the batch once every other event of this tick had the
+        // chance to add to it, but before the simulation loop exits so
+        // SST sees the requests in the same cycle.
+        schedule(flushRequestsEvent, curTick());
+    }
+}
+
+void
+OutgoingRequestBridge::flushRequests()
+{
+    if (flushRequestsEvent.scheduled())
+        deschedule(flushRequestsEvent);
+    if (pendingRequests.empty())
+        return;
+
+    std::vector<PacketPtr> batch;
+    batch.reserve(maxBatchSize);
+    batch.swap(pendingRequests);
+    sstResponder->handleRecvTimingReqs(batch);
 }
 
 Tick
@@ -133,7 +178,7 @@ bool
 OutgoingRequestBridge::
 OutgoingRequestPort::recvTimingReq(PacketPtr pkt)
 {
-    owner->sstResponder->handleRecvTimingReq(pkt);
+    owner->handleRecvTimingReq(pkt);
     return true;
 }
 
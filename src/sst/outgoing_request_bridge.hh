@@ -32,7 +32,9 @@
 
 #include "mem/port.hh"
 #include "params/OutgoingRequestBridge.hh"
+#include "sim/eventq.hh"
 #include "sim/sim_object.hh"
+#include "sst/init_image.hh"
 #include "sst/sst_responder_interface.hh"
 
 /**
@@ -74,11 +76,18 @@ class OutgoingRequestBridge: public SimObject
     OutgoingRequestPort outgoingPort;
     // pointer to the corresponding SST responder
     SSTResponderInterface* sstResponder;
-    // this vector holds the initialization data sent by gem5
-    std::vector<std::pair<Addr, std::vector<uint8_t>>> initData;
+    // this image holds the initialization data sent by gem5
+    SSTInitImage initImage;
 
     AddrRangeList physicalAddressRanges;
 
+    // the maximum number of requests forwarded to SST at once
+    const unsigned maxBatchSize;
+    // the timing requests received during the current tick
+    std::vector<PacketPtr> pendingRequests;
+    // forwards the pending requests at the end of the tick
+    EventFunctionWrapper flushRequestsEvent;
+
   public:
     OutgoingRequestBridge(const OutgoingRequestBridgeParams &params);
     ~OutgoingRequestBridge();
@@ -99,6 +108,9 @@ class OutgoingRequestBridge: public SimObject
     // the connection in SST Memory Hierarchy has not been constructed yet.
     std::vector<std::pair<Addr, std::vector<uint8_t>>> getInitData() const;
 
+    // Returns the buffered data for initialization, without copying it.
+    const SSTInitImage &getInitImage() const { return initImage; }
+
     // gem5 Component (from SST) will call this function to let set the
     // bridge's corresponding SSTResponderSubComponent (which implemented
     // SSTResponderInterface). I.e., this will connect this bridge to the
@@ -115,6 +127,14 @@ class OutgoingRequestBridge: public SimObject
     // to SST. Should only be called during the SST construction phase, i.e.
     // not at the simulation time.
     void handleRecvFunctional(PacketPtr pkt);
+
+    // This function is called when gem5 sends a timing request to SST. The
+    // request is either forwarded right away or batched with the other
+    // requests of the tick.
+    void handleRecvTimingReq(PacketPtr pkt);
+
+    // Forward the batched requests to SST.
+    void flushRequests();
 };
 
 }; // namespace gem5
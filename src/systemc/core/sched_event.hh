@@ -28,8 +28,8 @@
 #ifndef __SYSTEMC_CORE_SCHED_EVENT_HH__
 #define __SYSTEMC_CORE_SCHED_EVENT_HH__
 
+#include <cassert>
 #include <functional>
-#include <list>
 
 #include "base/types.hh"
 
@@ -38,7 +38,28 @@ namespace sc_gem5
 
 class ScEvent;
 
-typedef std::list<ScEvent *> ScEvents;
+/*
+ * An intrusive list of ScEvents. The links live in the events themselves, so
+ * scheduling and descheduling an event never allocates.
+ */
+class ScEvents
+{
+  private:
+    ScEvent *_front = nullptr;
+    ScEvent *_back = nullptr;
+
+  public:
+    ScEvents() = default;
+    ScEvents(const ScEvents &) = delete;
+    ScEvents &operator=(const ScEvents &) = delete;
+
+    bool empty() const { return _front == nullptr; }
+    ScEvent *front() const { return _front; }
+    ScEvent *back() const { return _back; }
+
+    inline void pushLast(ScEvent *event);
+    inline void remove(ScEvent *event);
+};
 
 class ScEvent
 {
@@ -46,9 +67,11 @@ class ScEvent
     std::function<void()> work;
     gem5::Tick _when;
     ScEvents *_events;
-    ScEvents::iterator _it;
+    ScEvent *prevEvent;
+    ScEvent *nextEvent;
 
     friend class Scheduler;
+    friend class ScEvents;
 
     void
     schedule(ScEvents &events, gem5::Tick w)
@@ -56,21 +79,20 @@ class ScEvent
         when(w);
         assert(!scheduled());
         _events = &events;
-        _events->push_back(this);
-        _it = _events->end();
-        _it--;
+        _events->pushLast(this);
     }
 
     void
     deschedule()
     {
         assert(scheduled());
-        _events->erase(_it);
+        _events->remove(this);
         _events = nullptr;
     }
   public:
     ScEvent(std::function<void()> work) :
-        work(work), _when(gem5::MaxTick), _events(nullptr)
+        work(work), _when(gem5::MaxTick), _events(nullptr),
+        prevEvent(nullptr), nextEvent(nullptr)
     {}
 
     ~ScEvent();
@@ -84,6 +106,33 @@ class ScEvent
     void run() { deschedule(); work(); }
 };
 
+inline void
+ScEvents::pushLast(ScEvent *event)
+{
+    event->prevEvent = _back;
+    event->nextEvent = nullptr;
+    if (_back)
+        _back->nextEvent = event;
+    else
+        _front = event;
+    _back = event;
+}
+
+inline void
+ScEvents::remove(ScEvent *event)
+{
+    if (event->prevEvent)
+        event->prevEvent->nextEvent = event->nextEvent;
+    else
+        _front = event->nextEvent;
+    if (event->nextEvent)
+        event->nextEvent->prevEvent = event->prevEvent;
+    else
+        _back = event->prevEvent;
+    event->prevEvent = nullptr;
+    event->nextEvent = nullptr;
+}
+
 } // namespace sc_gem5
 
 #endif // __SYSTEMC_CORE_SCHED_EVENT_HH__
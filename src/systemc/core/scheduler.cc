@@ -72,11 +72,12 @@ Scheduler::clear()
 
     // Timed notifications.
     for (auto &ts: timeSlots) {
-        while (!ts->events.empty())
-            ts->events.front()->deschedule();
-        deschedule(ts);
+        while (!ts.second->events.empty())
+            ts.second->events.front()->deschedule();
+        deschedule(ts.second);
     }
     timeSlots.clear();
+    timeSlotTicks = {};
 
     // gem5 events.
     if (readyEvent.scheduled())
@@ -30,10 +30,10 @@
 
 #include <atomic>
 #include <functional>
-#include <list>
-#include <map>
 #include <mutex>
+#include <queue>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include "base/logging.hh"
@@ -147,8 +147,6 @@ typedef NodeList<Channel> ChannelList;
 class Scheduler
 {
   public:
-    typedef std::list<ScEvent *> ScEvents;
-
     class TimeSlot : public gem5::Event
     {
       public:
@@ -172,8 +170,6 @@ class Scheduler
 
     };
 
-    typedef std::list<TimeSlot *> TimeSlots;
-
     Scheduler();
     ~Scheduler();
 
@@ -265,14 +261,13 @@ class Scheduler
         }
 
         // Timed notification/timeout.
-        auto it = timeSlots.begin();
-        while (it != timeSlots.end() && (*it)->targeted_when < tick)
-            it++;
-        if (it == timeSlots.end() || (*it)->targeted_when != tick) {
-            it = timeSlots.emplace(it, acquireTimeSlot(tick));
-            schedule(*it, tick);
+        TimeSlot *&ts = timeSlots[tick];
+        if (!ts) {
+            ts = acquireTimeSlot(tick);
+            timeSlotTicks.push(tick);
+            schedule(ts, tick);
         }
-        event->schedule((*it)->events, tick);
+        event->schedule(ts->events, tick);
     }
 
     // For descheduling delayed/timed notifications/timeouts.
@@ -289,31 +284,33 @@ class Scheduler
         }
 
         // Timed notification/timeout.
-        auto tsit = timeSlots.begin();
-        while (tsit != timeSlots.end() &&
-               (*tsit)->targeted_when < event->when())
-            tsit++;
+        auto tsit = timeSlots.find(event->when());
 
-        panic_if(tsit == timeSlots.end() ||
-                 (*tsit)->targeted_when != event->when(),
+        panic_if(tsit == timeSlots.end(),
                 "Descheduling event at time with no events.");
-        TimeSlot *ts = *tsit;
+        TimeSlot *ts = tsit->second;
         ScEvents &events = ts->events;
         assert(on == &events);
         event->deschedule();
 
         // If no more events are happening at this time slot, get rid of it.
+        // Its tick is left in timeSlotTicks and skipped when it comes up.
         if (events.empty()) {
             deschedule(ts);
             timeSlots.erase(tsit);
+            if (timeSlotTicks.size() > 2 * timeSlots.size() + 64)
+                rebuildTimeSlotTicks();
         }
     }
 
     void
     completeTimeSlot(TimeSlot *ts)
     {
-        assert(ts == timeSlots.front());
-        timeSlots.erase(timeSlots.begin());
+        // This also makes sure the top of the heap is this slot's time.
+        [[maybe_unused]] TimeSlot *first = firstTimeSlot();
+        assert(ts == first);
+        timeSlots.erase(ts->targeted_when);
+        timeSlotTicks.pop();
         if (!runToTime && starved())
             scheduleStarvationEvent();
         scheduleTimeAdvancesEvent();
@@ -348,7 +345,7 @@ class Scheduler
         if (pendingCurr())
             return 0;
         if (pendingFuture())
-            return timeSlots.front()->targeted_when - getCurTick();
+            return firstTimeSlot()->targeted_when - getCurTick();
         return gem5::MaxTick - getCurTick();
     }
 
@@ -409,7 +406,7 @@ class Scheduler
             ts = new TimeSlot(this);
         }
         ts->targeted_when = tick;
-        ts->events.clear();
+        assert(ts->events.empty());
         return ts;
     }
 
@@ -454,9 +451,42 @@ class Scheduler
     }
 
     ScEvents deltas;
-    TimeSlots timeSlots;
+
+    // Pending time slots, indexed by the time they're for so timed
+    // notifications find their slot in constant time. The times are also
+    // kept in a heap to find the earliest slot. Times of slots which went
+    // away early are only removed from the heap when they reach its top.
+    std::unordered_map<gem5::Tick, TimeSlot *> timeSlots;
+    std::priority_queue<gem5::Tick, std::vector<gem5::Tick>,
+                        std::greater<gem5::Tick>> timeSlotTicks;
     std::stack<TimeSlot*> freeTimeSlots;
 
+    // Return the earliest pending time slot, if any.
+    TimeSlot *
+    firstTimeSlot()
+    {
+        while (!timeSlotTicks.empty()) {
+            auto it = timeSlots.find(timeSlotTicks.top());
+            if (it != timeSlots.end())
+                return it->second;
+            timeSlotTicks.pop();
+        }
+        return nullptr;
+    }
+
+    // Drop the times of the slots which went away from the heap, so it
+    // doesn't grow with slots which are repeatedly created and cancelled.
+    void
+    rebuildTimeSlotTicks()
+    {
+        std::vector<gem5::Tick> ticks;
+        ticks.reserve(timeSlots.size());
+        for (auto &ts: timeSlots)
+            ticks.push_back(ts.first);
+        timeSlotTicks = decltype(timeSlotTicks)(
+                std::greater<gem5::Tick>(), std::move(ticks));
+    }
+
     Process *
     getNextReady()
     {
@@ -481,7 +511,7 @@ class Scheduler
         return (readyListMethods.empty() && readyListThreads.empty() &&
                 updateList.empty() && deltas.empty() &&
                 (timeSlots.empty() ||
-                 timeSlots.front()->targeted_when > maxTick) &&
+                 firstTimeSlot()->targeted_when > maxTick) &&
                 initList.empty());
     }
     gem5::MemberEventWrapper<&Scheduler::pause> starvationEvent;
@@ -533,7 +563,7 @@ class Scheduler
     std::mutex asyncListMutex;
     std::atomic<bool> hasAsyncUpdate;
 
-    std::map<gem5::Event *, gem5::Tick> eventsToSchedule;
+    std::unordered_map<gem5::Event *, gem5::Tick> eventsToSchedule;
 
     std::set<TraceFile *> traceFiles;
 
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Stress and benchmark test of timed notifications. A number of modules
+ * notify events at pseudo random times, some of which are cancelled and
+ * moved, while waiting on them with timeouts. This makes the kernel keep
+ * many distinct time slots pending at once, and create and tear down time
+ * slots at a high rate.
+ *
+ * The default size runs quickly as part of the test suite. For
+ * benchmarking, the number of notifications per module can be passed as
+ * the first argument.
+ */
+
+#include <cstdlib>
+
+#include "systemc.h"
+
+SC_MODULE( notifier )
+{
+    sc_event e;
+    sc_event moved;
+
+    unsigned iterations;
+    unsigned seed;
+
+    unsigned notified;
+    unsigned timeouts;
+    unsigned triggered;
+
+    unsigned
+    next()
+    {
+        // A small LCG keeps the sequence the same on every host.
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) & 0x7fff;
+    }
+
+    void
+    sender()
+    {
+        for (unsigned i = 0; i < iterations; i++) {
+            e.notify( 1 + next() % 997, SC_NS );
+
+            // Move a notification, descheduling it from its time slot.
+            moved.notify( 1 + next() % 1009, SC_NS );
+            if (next() % 4 == 0) {
+                moved.cancel();
+                moved.notify( 1 + next() % 1013, SC_NS );
+            }
+
+            wait( 1 + next() % 991, SC_NS, e );
+            if (e.triggered())
+                notified++;
+            else
+                timeouts++;
+        }
+    }
+
+    void
+    receiver()
+    {
+        triggered++;
+    }
+
+    SC_CTOR( notifier ) : iterations(0), seed(0), notified(0), timeouts(0),
+                          triggered(0)
+    {
+        SC_THREAD( sender );
+        SC_METHOD( receiver );
+        sensitive << moved;
+        dont_initialize();
+    }
+};
+
+int
+sc_main( int argc, char *argv[] )
+{
+    const unsigned num_modules = 64;
+    unsigned iterations = 2000;
+    if (argc > 1)
+        iterations = std::strtoul( argv[1], nullptr, 0 );
+
+    notifier *mods[num_modules];
+    for (unsigned i = 0; i < num_modules; i++) {
+        mods[i] = new notifier( sc_gen_unique_name( "notifier" ) );
+        mods[i]->iterations = iterations;
+        mods[i]->seed = i + 1;
+    }
+
+    sc_start();
+
+    unsigned long notified = 0, timeouts = 0, triggered = 0;
+    for (unsigned i = 0; i < num_modules; i++) {
+        notified += mods[i]->notified;
+        timeouts += mods[i]->timeouts;
+        triggered += mods[i]->triggered;
+    }
+
+    cout << "notified " << notified << ", timeouts " << timeouts
+         << ", triggered " << triggered << "\n";
+    cout << "finished at " << sc_time_stamp() << "\n";
+
+    return 0;
+}
@@ -44,6 +44,12 @@ class Gem5ToTlmBridgeBase(SystemC_ScModule):
     addr_ranges = VectorParam.AddrRange(
         [], "Addresses served by this port's TLM side"
     )
+    dmi_transport = Param.Bool(
+        False,
+        "Serve atomic and functional accesses covered by a DMI region "
+        "granted by the TLM target from that region, without calling "
+        "b_transport or transport_dbg",
+    )
 
 
 class TlmToGem5BridgeBase(SystemC_ScModule):
@@ -55,6 +61,11 @@ class TlmToGem5BridgeBase(SystemC_ScModule):
     system = Param.System(Parent.any, "system")
 
     gem5 = RequestPort("gem5 request port")
+    backdoor_transport = Param.Bool(
+        False,
+        "Serve b_transport and transport_dbg calls covered by a gem5 "
+        "backdoor from that backdoor, without sending a packet into gem5",
+    )
 
 
 class Gem5ToTlmBridge32(Gem5ToTlmBridgeBase):
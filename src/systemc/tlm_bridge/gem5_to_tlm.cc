@@ -275,7 +275,7 @@ Gem5ToTlmBridge<BITWIDTH>::getBackdoor(tlm::tlm_generic_payload &trans)
     AddrRange r(start, end);
     auto it = backdoorMap.contains(r);
     if (it != backdoorMap.end())
-        return it->second;
+        return it->second.backdoor;
 
     // If not, ask the target for one.
     tlm::tlm_dmi dmi_data;
@@ -290,11 +290,48 @@ Gem5ToTlmBridge<BITWIDTH>::getBackdoor(tlm::tlm_generic_payload &trans)
     backdoor->readable(dmi_data.is_read_allowed());
     backdoor->writeable(dmi_data.is_write_allowed());
 
-    backdoorMap.insert(dmi_r, backdoor);
+    DmiRegion dmi{backdoor, dmi_data.get_read_latency().value(),
+                  dmi_data.get_write_latency().value()};
+    backdoorMap.insert(dmi_r, dmi);
 
     return backdoor;
 }
 
+template <unsigned int BITWIDTH>
+bool
+Gem5ToTlmBridge<BITWIDTH>::accessDmi(PacketPtr packet, Tick &latency)
+{
+    // Only plain reads and writes can bypass the target.
+    if (packet->isRead() == packet->isWrite() || packet->isAtomicOp() ||
+            packet->isLLSC() ||
+            (packet->req->getFlags() & Request::NO_ACCESS)) {
+        return false;
+    }
+
+    auto it = backdoorMap.contains(packet->getAddrRange());
+    if (it == backdoorMap.end())
+        return false;
+
+    const DmiRegion &dmi = it->second;
+    uint8_t *host_addr = dmi.backdoor->ptr() +
+        (packet->getAddr() - dmi.backdoor->range().start());
+    if (packet->isRead()) {
+        if (!dmi.backdoor->readable())
+            return false;
+        packet->setData(host_addr);
+        latency = dmi.readLatency;
+    } else {
+        if (!dmi.backdoor->writeable())
+            return false;
+        packet->writeData(host_addr);
+        latency = dmi.writeLatency;
+    }
+
+    if (packet->needsResponse())
+        packet->makeResponse();
+    return true;
+}
+
 // Similar to TLM's blocking transport (LT)
 template <unsigned int BITWIDTH>
 Tick
@@ -303,6 +340,10 @@ Gem5ToTlmBridge<BITWIDTH>::recvAtomic(PacketPtr packet)
     panic_if(packet->cacheResponding(),
              "Should not see packets where cache is responding");
 
+    Tick latency;
+    if (dmiTransport && accessDmi(packet, latency))
+        return latency;
+
     // Prepare the transaction.
     auto *trans = packet2payload(packet);
 
@@ -311,6 +352,10 @@ Gem5ToTlmBridge<BITWIDTH>::recvAtomic(PacketPtr packet)
     if (trans->get_command() != tlm::TLM_IGNORE_COMMAND) {
         // Execute b_transport:
         socket->b_transport(*trans, delay);
+        // Set up DMI if the target allows it, so the next accesses to
+        // this region don't have to go through b_transport.
+        if (dmiTransport && trans->is_dmi_allowed())
+            getBackdoor(*trans);
     }
 
     if (packet->needsResponse())
@@ -500,6 +545,10 @@ template <unsigned int BITWIDTH>
 void
 Gem5ToTlmBridge<BITWIDTH>::recvFunctional(PacketPtr packet)
 {
+    Tick latency;
+    if (dmiTransport && accessDmi(packet, latency))
+        return;
+
     // Prepare the transaction.
     auto *trans = packet2payload(packet);
 
@@ -562,8 +611,8 @@ Gem5ToTlmBridge<BITWIDTH>::invalidate_direct_mem_ptr(
         if (it == backdoorMap.end())
             break;
 
-        it->second->invalidate();
-        delete it->second;
+        it->second.backdoor->invalidate();
+        delete it->second.backdoor;
         backdoorMap.erase(it);
     };
 }
@@ -577,7 +626,8 @@ Gem5ToTlmBridge<BITWIDTH>::Gem5ToTlmBridge(
     wrapper(socket, std::string(name()) + ".tlm", InvalidPortID),
     system(params.system), blockingRequest(nullptr),
     needToSendRequestRetry(false), blockingResponse(nullptr),
-    addrRanges(params.addr_ranges.begin(), params.addr_ranges.end())
+    addrRanges(params.addr_ranges.begin(), params.addr_ranges.end()),
+    dmiTransport(params.dmi_transport)
 {
 }
 
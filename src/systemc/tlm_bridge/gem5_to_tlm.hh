@@ -185,8 +185,31 @@ class Gem5ToTlmBridge : public Gem5ToTlmBridgeBase
   protected:
     void pec(tlm::tlm_generic_payload &trans, const tlm::tlm_phase &phase);
 
+    /** A DMI region granted by the TLM target */
+    struct DmiRegion
+    {
+        gem5::MemBackdoorPtr backdoor;
+        gem5::Tick readLatency;
+        gem5::Tick writeLatency;
+    };
+
     gem5::MemBackdoorPtr getBackdoor(tlm::tlm_generic_payload &trans);
-    gem5::AddrRangeMap<gem5::MemBackdoorPtr> backdoorMap;
+    gem5::AddrRangeMap<DmiRegion> backdoorMap;
+
+    /**
+     * Whether accesses covered by a known DMI region are served from it
+     * instead of being sent to the TLM target.
+     */
+    const bool dmiTransport;
+
+    /**
+     * Serve a plain read or write from a DMI region the TLM target has
+     * already granted, if there is one covering it.
+     *
+     * @param latency Set to the DMI latency of the access.
+     * @return Whether the access was done.
+     */
+    bool accessDmi(gem5::PacketPtr packet, gem5::Tick &latency);
 
     // The gem5 port interface.
     gem5::Tick recvAtomic(gem5::PacketPtr packet);
@@ -57,6 +57,7 @@
 
 #include "systemc/tlm_bridge/tlm_to_gem5.hh"
 
+#include <cstring>
 #include <utility>
 
 #include "base/trace.hh"
@@ -221,11 +222,16 @@ TlmToGem5Bridge<BITWIDTH>::sendBeginResp(tlm::tlm_generic_payload &trans,
     }
     Addr start_addr = trans.get_address();
     Addr length = trans.get_data_length();
-
-    MemBackdoorReq req({start_addr, start_addr + length}, flags);
-    MemBackdoorPtr backdoor = nullptr;
-
-    bmp.sendMemBackdoorReq(req, backdoor);
+    AddrRange range(start_addr, start_addr + length);
+
+    // Only ask gem5 for a backdoor if we don't know of one already.
+    MemBackdoorPtr backdoor =
+        findBackdoor(range, flags == MemBackdoor::Writeable);
+    if (!backdoor) {
+        MemBackdoorReq req(range, flags);
+        bmp.sendMemBackdoorReq(req, backdoor);
+        cacheBackdoor(backdoor);
+    }
 
     if (backdoor)
         trans.set_dmi_allowed(true);
@@ -314,7 +320,69 @@ TlmToGem5Bridge<BITWIDTH>::cacheBackdoor(gem5::MemBackdoorPtr backdoor)
             }
         );
         requestedBackdoors.emplace(backdoor);
+        // If this overlaps a backdoor we already know of, it is still
+        // usable through get_direct_mem_ptr but won't be found by
+        // findBackdoor.
+        backdoorMap.insert(backdoor->range(), backdoor);
+    }
+}
+
+template <unsigned int BITWIDTH>
+MemBackdoorPtr
+TlmToGem5Bridge<BITWIDTH>::findBackdoor(const AddrRange &range, bool write)
+{
+    auto it = backdoorMap.contains(range);
+    if (it == backdoorMap.end())
+        return nullptr;
+    MemBackdoorPtr backdoor = it->second;
+    if (write ? !backdoor->writeable() : !backdoor->readable())
+        return nullptr;
+    return backdoor;
+}
+
+template <unsigned int BITWIDTH>
+bool
+TlmToGem5Bridge<BITWIDTH>::accessBackdoor(tlm::tlm_generic_payload &trans)
+{
+    // Transactions from gem5 carry a packet which has to see the access,
+    // and atomic operations and extra conversion steps need a packet too.
+    Gem5SystemC::Gem5Extension *extension = nullptr;
+    trans.get_extension(extension);
+    Gem5SystemC::AtomicExtension *atomic_ex = nullptr;
+    trans.get_extension(atomic_ex);
+    if (extension || atomic_ex || !extraPayloadToPacketSteps.empty())
+        return false;
+
+    bool write;
+    switch (trans.get_command()) {
+      case tlm::TLM_READ_COMMAND:
+        write = false;
+        break;
+      case tlm::TLM_WRITE_COMMAND:
+        write = true;
+        break;
+      default:
+        return false;
     }
+
+    unsigned len = trans.get_data_length();
+    if (trans.get_byte_enable_ptr() || trans.get_streaming_width() < len)
+        return false;
+
+    Addr addr = trans.get_address();
+    MemBackdoorPtr backdoor = findBackdoor(AddrRange(addr, addr + len), write);
+    if (!backdoor)
+        return false;
+
+    uint8_t *host_addr = backdoor->ptr() + (addr - backdoor->range().start());
+    if (write)
+        std::memcpy(host_addr, trans.get_data_ptr(), len);
+    else
+        std::memcpy(trans.get_data_ptr(), host_addr, len);
+
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    trans.set_dmi_allowed(true);
+    return true;
 }
 
 template <unsigned int BITWIDTH>
@@ -324,6 +392,9 @@ TlmToGem5Bridge<BITWIDTH>::invalidateDmi(const gem5::MemBackdoor &backdoor)
     socket->invalidate_direct_mem_ptr(
             backdoor.range().start(), backdoor.range().end());
     requestedBackdoors.erase(const_cast<gem5::MemBackdoorPtr>(&backdoor));
+    auto it = backdoorMap.contains(backdoor.range());
+    if (it != backdoorMap.end() && it->second == &backdoor)
+        backdoorMap.erase(it);
 }
 
 template <unsigned int BITWIDTH>
@@ -374,21 +445,19 @@ void
 TlmToGem5Bridge<BITWIDTH>::b_transport(tlm::tlm_generic_payload &trans,
                                        sc_core::sc_time &t)
 {
+    // Like an access through DMI, this doesn't add any delay.
+    if (backdoorTransport && accessBackdoor(trans))
+        return;
+
     auto [pkt, pkt_created] = payload2packet(_id, trans);
     pkt->pushSenderState(new Gem5SystemC::TlmSenderState(trans));
 
-    MemBackdoorPtr backdoor = nullptr;
     Tick ticks = 0;
 
     // Check if we have a backdoor meet the request. If yes, we can just hints
     // the requestor the DMI is supported.
-    for (auto& b : requestedBackdoors) {
-        if (pkt->getAddrRange().isSubset(b->range()) &&
-            ((!pkt->isWrite() && b->readable()) ||
-             (pkt->isWrite() && b->writeable()))) {
-            backdoor = b;
-        }
-    }
+    MemBackdoorPtr backdoor = findBackdoor(pkt->getAddrRange(),
+                                           pkt->isWrite());
 
     if (backdoor) {
         ticks = bmp.sendAtomic(pkt);
@@ -430,6 +499,9 @@ template <unsigned int BITWIDTH>
 unsigned int
 TlmToGem5Bridge<BITWIDTH>::transport_dbg(tlm::tlm_generic_payload &trans)
 {
+    if (backdoorTransport && accessBackdoor(trans))
+        return trans.get_data_length();
+
     auto [pkt, pkt_created] = payload2packet(_id, trans);
     if (pkt != nullptr) {
         pkt->pushSenderState(new Gem5SystemC::TlmSenderState(trans));
@@ -599,6 +671,7 @@ TlmToGem5Bridge<BITWIDTH>::TlmToGem5Bridge(
     TlmToGem5BridgeBase(mn), peq(this, &TlmToGem5Bridge<BITWIDTH>::peq_cb),
     waitForRetry(false), pendingRequest(nullptr), pendingPacket(nullptr),
     needToSendRetry(false), responseInProgress(false),
+    backdoorTransport(params.backdoor_transport),
     bmp(std::string(name()) + "master", *this), socket("tlm_socket"),
     wrapper(socket, std::string(name()) + ".tlm", InvalidPortID),
     system(params.system),
@@ -62,6 +62,7 @@
 #include <unordered_set>
 #include <utility>
 
+#include "base/addr_range_map.hh"
 #include "mem/port.hh"
 #include "params/TlmToGem5BridgeBase.hh"
 #include "systemc/ext/core/sc_module.hh"
@@ -124,6 +125,14 @@ class TlmToGem5Bridge : public TlmToGem5BridgeBase
     bool responseInProgress;
 
     std::unordered_set<gem5::MemBackdoorPtr> requestedBackdoors;
+    /** The requested backdoors, indexed by the range they cover */
+    gem5::AddrRangeMap<gem5::MemBackdoorPtr> backdoorMap;
+
+    /**
+     * Whether transactions covered by a requested backdoor are served
+     * from it instead of being sent into gem5.
+     */
+    const bool backdoorTransport;
 
     BridgeRequestPort bmp;
     tlm_utils::simple_target_socket<
@@ -145,6 +154,24 @@ class TlmToGem5Bridge : public TlmToGem5BridgeBase
 
     void cacheBackdoor(gem5::MemBackdoorPtr backdoor);
 
+    /**
+     * Find a requested backdoor covering an address range.
+     *
+     * @param write Whether the backdoor needs to be writeable, rather
+     *        than readable.
+     * @return The backdoor, or nullptr if there is none.
+     */
+    gem5::MemBackdoorPtr findBackdoor(const gem5::AddrRange &range,
+                                      bool write);
+
+    /**
+     * Serve a plain read or write transaction from a requested backdoor,
+     * without creating a packet for it.
+     *
+     * @return Whether the transaction was done.
+     */
+    bool accessBackdoor(tlm::tlm_generic_payload &trans);
+
   protected:
     // payload event call back
     void peq_cb(tlm::tlm_generic_payload &trans, const tlm::tlm_phase &phase);
@@ -0,0 +1,131 @@
+#! /usr/bin/env python3
+#
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Convert a gem5 config.ini to the binary config format read by
+CxxBinaryFile (src/sim/cxx_config_binary.hh).
+
+The binary file holds the same objects and parameters as the .ini file
+with every value already split into its vector elements, so a
+C++-configured gem5 can load it without parsing any text.
+
+The functions here can also be imported by a config script to write a
+binary config after m5.instantiate() has written config.ini.
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = b"gem5cfgb"
+VERSION = 1
+
+
+def read_ini(filename):
+    """Read a .ini file the same way as gem5's IniFile. Returns a dict of
+    sections in file order, each a dict of parameter values."""
+    sections = {}
+    section = None
+
+    with open(filename, "rb") as ini:
+        for line in ini:
+            line = line.decode("utf-8").lstrip().rstrip("\n").rstrip(" ")
+            if not line:
+                continue
+
+            if line[0] == "[" and line[-1] == "]":
+                section = sections.setdefault(line[1:-1].strip(" "), {})
+                continue
+
+            if section is None:
+                continue
+
+            offset = line.find("=")
+            if offset == -1:
+                raise ValueError(f"Can't parse .ini line {line}")
+
+            append = line[offset - 1] == "+"
+            name = line[: offset - 1 if append else offset].strip(" ")
+            value = line[offset + 1 :].strip(" ")
+
+            if append and name in section:
+                section[name] += " " + value
+            else:
+                section[name] = value
+
+    return sections
+
+
+def write_binary(sections, filename):
+    """Write a dict of sections, as returned by read_ini, to a binary
+    config file."""
+    strings = []
+    string_index = {}
+
+    def intern(string):
+        data = string.encode("utf-8")
+        if data not in string_index:
+            string_index[data] = len(strings)
+            strings.append(data)
+        return string_index[data]
+
+    words = []
+    for object_name, params in sections.items():
+        words += [intern(object_name), len(params)]
+        # The reader looks parameters up with a binary search, so they
+        # are sorted in the same byte order as std::string compares them.
+        for name in sorted(params, key=lambda name: name.encode("utf-8")):
+            value = params[name]
+            elements = [element for element in value.split(" ") if element]
+            words += [intern(name), intern(value), len(elements)]
+            words += [intern(element) for element in elements]
+
+    with open(filename, "wb") as out:
+        out.write(MAGIC)
+        out.write(struct.pack("<III", VERSION, len(strings), len(sections)))
+        for string in strings:
+            out.write(struct.pack("<I", len(string)))
+            out.write(string)
+        out.write(struct.pack(f"<{len(words)}I", *words))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("ini", help="config.ini to read")
+    parser.add_argument("binary", help="binary config file to write")
+    args = parser.parse_args()
+
+    try:
+        write_binary(read_ini(args.ini), args.binary)
+    except (OSError, ValueError) as err:
+        print(f"{sys.argv[0]}: {err}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
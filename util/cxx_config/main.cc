@@ -62,6 +62,7 @@
 #include "base/str.hh"
 #include "base/trace.hh"
 #include "cpu/base.hh"
+#include "sim/cxx_config_binary.hh"
 #include "sim/cxx_config_ini.hh"
 #include "sim/cxx_manager.hh"
 #include "sim/init_signals.hh"
@@ -78,7 +79,7 @@ void
 usage(const std::string &prog_name)
 {
     std::cerr << "Usage: " << prog_name << (
-        " <config-file.ini> [ <option> ]\n\n"
+        " <config-file.ini | config-file.bin> [ <option> ]\n\n"
         "OPTIONS:\n"
         "    -p <object> <param> <value>  -- set a parameter\n"
         "    -v <object> <param> <values> -- set a vector parameter from"
@@ -93,6 +94,9 @@ usage(const std::string &prog_name)
         "    -c <from> <to> <ticks>       -- switch from cpu 'from' to cpu"
         " 'to' after\n"
         "                                    the given number of ticks\n"
+        "    -j <threads>                 -- number of threads used to"
+        " set up the\n"
+        "                                    objects' parameters\n"
         "\n"
         );
 
@@ -123,7 +127,12 @@ main(int argc, char **argv)
 
     const std::string config_file(argv[arg_ptr]);
 
-    CxxConfigFileBase *conf = new CxxIniFile();
+    /* Binary configs made by ini_to_binary.py load without any parsing */
+    CxxConfigFileBase *conf;
+    if (CxxBinaryFile::isBinaryConfig(config_file))
+        conf = new CxxBinaryFile();
+    else
+        conf = new CxxIniFile();
 
     if (!conf->load(config_file.c_str())) {
         std::cerr << "Can't open config file: " << config_file << '\n';
@@ -184,6 +193,14 @@ main(int argc, char **argv)
                 std::istringstream(argv[arg_ptr + 1]) >> pre_run_time;
                 checkpoint_save = true;
                 arg_ptr += 2;
+            } else if (option == "-j") {
+                unsigned num_threads = 1;
+
+                if (num_args < 1)
+                    usage(prog_name);
+                std::istringstream(argv[arg_ptr]) >> num_threads;
+                config_manager->setNumThreads(num_threads);
+                arg_ptr++;
             } else if (option == "-c") {
                 if (num_args < 3)
                     usage(prog_name);
@@ -207,11 +224,11 @@ main(int argc, char **argv)
         return EXIT_FAILURE;
     }
 
-    CxxConfig::statsEnable();
     getEventQueue(0)->dump();
 
     try {
         config_manager->instantiate();
+        CxxConfig::statsEnable();
         if (!checkpoint_restore) {
             config_manager->initState();
             config_manager->startup();
@@ -43,22 +43,53 @@
  *  Register with: gem5::statistics::registerHandlers(statsReset, statsDump)
  */
 
+#include <functional>
 #include <iostream>
 #include <list>
+#include <string>
 
 #include "base/statistics.hh"
+#include "sim/root.hh"
 #include "stats.hh"
 
 namespace CxxConfig
 {
 
-void statsPrepare()
+namespace
+{
+
+typedef std::function<void(const std::string &name,
+    gem5::statistics::Info *stat)> StatVisitor;
+
+/** Visit the stats of group and its subgroups, naming each stat with its
+ *  path below the group */
+void visitGroup(const std::string &prefix,
+    const gem5::statistics::Group &group, const StatVisitor &visit)
+{
+    for (auto stat : group.getStats())
+        visit(prefix + stat->name, stat);
+
+    for (auto &child : group.getStatGroups())
+        visitGroup(prefix + child.first + ".", *child.second, visit);
+}
+
+/** Visit the old-style global stats and then the stats hanging off
+ *  root, as Python's stats.visit does */
+void visitStats(const StatVisitor &visit)
 {
-    std::list<gem5::statistics::Info *> stats = gem5::statistics::statsList();
+    for (auto stat : gem5::statistics::statsList())
+        visit(stat->name, stat);
 
+    visitGroup("", *gem5::Root::root(), visit);
+}
+
+} // anonymous namespace
+
+void statsPrepare()
+{
     /* gather_stats -> prepare */
-    for (auto i = stats.begin(); i != stats.end(); ++i)
-        (*i)->prepare();
+    visitStats([](const std::string &name, gem5::statistics::Info *stat)
+        { stat->prepare(); });
 }
 
 void statsDump()
@@ -67,37 +98,33 @@ void statsDump()
 
     gem5::statistics::processDumpQueue();
 
-    std::list<gem5::statistics::Info *> stats = gem5::statistics::statsList();
-
     statsPrepare();
 
     /* gather_stats -> convert_value */
-    for (auto i = stats.begin(); i != stats.end(); ++i) {
-        gem5::statistics::Info *stat = *i;
-
+    visitStats([](const std::string &name, gem5::statistics::Info *stat) {
         gem5::statistics::ScalarInfo *scalar =
             dynamic_cast<gem5::statistics::ScalarInfo *>(stat);
         gem5::statistics::VectorInfo *vector =
             dynamic_cast<gem5::statistics::VectorInfo *>(stat);
 
         if (scalar) {
-            std::cerr << "SCALAR " << stat->name << ' '
+            std::cerr << "SCALAR " << name << ' '
                 << scalar->value() << '\n';
         } else if (vector) {
             gem5::statistics::VResult results = vector->value();
 
             unsigned int index = 0;
             for (auto e = results.begin(); e != results.end(); ++e) {
-                std::cerr << "VECTOR " << stat->name << '[' << index
+                std::cerr << "VECTOR " << name << '[' << index
                     << "] " << (*e) << '\n';
                 index++;
             }
-            std::cerr << "VTOTAL " << stat->name << ' '
+            std::cerr << "VTOTAL " << name << ' '
                 << vector->total() << '\n';
         } else {
-            std::cerr << "?????? " << stat->name << '\n';
+            std::cerr << "?????? " << name << '\n';
         }
-    }
+    });
 }
 
 void statsReset()
@@ -109,10 +136,8 @@ void statsReset()
 
 void statsEnable()
 {
-    std::list<gem5::statistics::Info *> stats = gem5::statistics::statsList();
-
-    for (auto i = stats.begin(); i != stats.end(); ++i)
-        (*i)->enable();
+    visitStats([](const std::string &name, gem5::statistics::Info *stat)
+        { stat->enable(); });
 }
 
 }
@@ -49,6 +49,9 @@
 namespace CxxConfig
 {
 
+/** Stats are visited from statistics::statsList and then down the stats
+ *  tree from Root, so these must only be called once the config has
+ *  been instantiated */
 void statsDump();
 void statsReset();
 void statsEnable();
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Compare two binary Tarmac traces, as written by the TarmacTracer with
+ * format="binary", and print the first mismatches between them.
+ */
+
+#include <getopt.h>
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "arch/arm/tracers/tarmac_binary.hh"
+
+using namespace gem5::trace;
+
+namespace
+{
+
+void
+usage(const char *prog)
+{
+    std::cerr <<
+        "Usage: " << prog << " [options] <trace a> <trace b>\n"
+        "\n"
+        "  -j, --jobs N          compare with N threads (default: all)\n"
+        "  -n, --max-diffs N     stop after N mismatches, 0 for all "
+        "(default: 1)\n"
+        "  -c, --chunk N         records compared by a thread at a time\n"
+        "      --ticks           compare instruction ticks\n"
+        "      --paddr           compare physical addresses\n"
+        "      --no-mem          don't compare memory accesses\n";
+    std::exit(2);
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char *argv[])
+{
+    enum { OptTicks = 256, OptPaddr, OptNoMem };
+    static const option long_opts[] = {
+        {"jobs", required_argument, nullptr, 'j'},
+        {"max-diffs", required_argument, nullptr, 'n'},
+        {"chunk", required_argument, nullptr, 'c'},
+        {"ticks", no_argument, nullptr, OptTicks},
+        {"paddr", no_argument, nullptr, OptPaddr},
+        {"no-mem", no_argument, nullptr, OptNoMem},
+        {nullptr, 0, nullptr, 0},
+    };
+
+    TarmacBinaryDiffOptions opts;
+    int opt;
+    while ((opt = getopt_long(argc, argv, "j:n:c:", long_opts,
+                              nullptr)) != -1) {
+        switch (opt) {
+          case 'j':
+            opts.threads = std::strtoul(optarg, nullptr, 0);
+            break;
+          case 'n':
+            opts.maxMismatches = std::strtoull(optarg, nullptr, 0);
+            break;
+          case 'c':
+            opts.chunkRecords = std::strtoull(optarg, nullptr, 0);
+            break;
+          case OptTicks:
+            opts.compareTicks = true;
+            break;
+          case OptPaddr:
+            opts.comparePaddr = true;
+            break;
+          case OptNoMem:
+            opts.compareMem = false;
+            break;
+          default:
+            usage(argv[0]);
+        }
+    }
+    if (argc - optind != 2)
+        usage(argv[0]);
+
+    TarmacBinaryReader a, b;
+    if (!a.open(argv[optind])) {
+        std::cerr << a.error() << "\n";
+        return 2;
+    }
+    if (!b.open(argv[optind + 1])) {
+        std::cerr << b.error() << "\n";
+        return 2;
+    }
+
+    std::string error;
+    auto mismatches = diffTarmacBinary(a, b, opts, error);
+    if (!error.empty()) {
+        std::cerr << error << "\n";
+        return 2;
+    }
+
+    for (const auto &mismatch : mismatches) {
+        std::cout << "record " << std::dec << mismatch.record
+                  << " pc 0x" << std::hex << std::setfill('0')
+                  << std::setw(8) << mismatch.addr << ": "
+                  << mismatch.description << "\n";
+    }
+    std::cout << std::dec << a.numRecords() << " records compared, "
+              << (mismatches.empty() ? "traces match" : "traces differ")
+              << "\n";
+
+    return mismatches.empty() ? 0 : 1;
+}